@@ -0,0 +1,536 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_bench.c
+ *
+ * Description: Microbenchmarks of the XENSIV™ PAS GAS driver API running against the
+ *              sensor emulator. For every entry point it reports the bus transactions,
+ *              the bytes on the wire, the cumulative platform delay and the CPU time
+ *              per call as JSON on stdout.
+ *
+ *              Usage: xensiv_pas_gas_bench [name filter]
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "src/xensiv_pas_gas.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_r290.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_emul.h"
+
+#define XENSIV_PAS_GAS_BENCH_ITERATIONS          (100U)
+#define XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW     (5U)
+
+/* Benchmark case. prepare runs before every iteration and is not measured. */
+typedef struct
+{
+    const char *name;
+    xensiv_pas_gas_variant_t variant;
+    xensiv_pas_gas_interface_t itf;
+    uint32_t iterations;
+    void (*prepare)(xensiv_pas_gas_emul_t *emul);
+    int32_t (*run)(xensiv_pas_gas_t *dev);
+} xensiv_pas_gas_bench_case_t;
+
+/* Totals of a benchmark case */
+typedef struct
+{
+    uint64_t transactions;
+    uint64_t bytes;
+    uint64_t delay_ms;
+    uint64_t bus_ns;
+    uint64_t cpu_ns;
+    uint32_t errors;
+    int32_t last_res;
+} xensiv_pas_gas_bench_result_t;
+
+static uint64_t xensiv_pas_gas_bench_cpu_ns(void) {
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/********************************* Preparation steps *************************************/
+
+static void xensiv_pas_gas_bench_set_drdy(xensiv_pas_gas_emul_t *emul) {
+    xensiv_pas_gas_emul_set_bits(emul, XENSIV_PAS_GAS_REG_MEAS_STS, XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK);
+}
+
+/*********************************** Common API ******************************************/
+
+static int32_t xensiv_pas_gas_bench_get_id(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_id_t id;
+    return xensiv_pas_gas_get_id(dev, &id);
+}
+
+static int32_t xensiv_pas_gas_bench_get_status(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_status_t status;
+    return xensiv_pas_gas_get_status(dev, &status);
+}
+
+static int32_t xensiv_pas_gas_bench_clear_status(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_clear_status(dev, XENSIV_PAS_GAS_REG_SENS_STS_ICCER_CLR_MSK);
+}
+
+static int32_t xensiv_pas_gas_bench_get_interrupt_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_interrupt_config_t int_config;
+    return xensiv_pas_gas_get_interrupt_config(dev, &int_config);
+}
+
+static int32_t xensiv_pas_gas_bench_set_interrupt_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_interrupt_config_t int_config = { .u = 0U };
+    int_config.b.int_func = XENSIV_PAS_GAS_INTERRUPT_FUNCTION_DRDY;
+    int_config.b.int_typ = XENSIV_PAS_GAS_INTERRUPT_TYPE_HIGH_ACTIVE;
+    return xensiv_pas_gas_set_interrupt_config(dev, int_config);
+}
+
+static int32_t xensiv_pas_gas_bench_get_measurement_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_measurement_config_t meas_config;
+    return xensiv_pas_gas_get_measurement_config(dev, &meas_config);
+}
+
+static int32_t xensiv_pas_gas_bench_set_measurement_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_measurement_config_t meas_config = { .u = 0U };
+    meas_config.b.boc_cfg = XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC;
+    return xensiv_pas_gas_set_measurement_config(dev, meas_config);
+}
+
+static int32_t xensiv_pas_gas_bench_get_result(xensiv_pas_gas_t *dev) {
+    uint16_t val;
+    return xensiv_pas_gas_get_result(dev, &val);
+}
+
+static int32_t xensiv_pas_gas_bench_set_measurement_rate(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_set_measurement_rate(dev, 60U);
+}
+
+static int32_t xensiv_pas_gas_bench_get_measurement_status(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_meas_status_t status;
+    return xensiv_pas_gas_get_measurement_status(dev, &status);
+}
+
+static int32_t xensiv_pas_gas_bench_clear_measurement_status(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_clear_measurement_status(dev, XENSIV_PAS_GAS_REG_MEAS_STS_INT_STS_CLR_MSK);
+}
+
+static int32_t xensiv_pas_gas_bench_set_alarm_threshold(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_set_alarm_threshold(dev, 1000U);
+}
+
+static int32_t xensiv_pas_gas_bench_set_pressure_compensation(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_set_pressure_compensation(dev, 1013U);
+}
+
+static int32_t xensiv_pas_gas_bench_set_offset_compensation(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_set_offset_compensation(dev, 400U);
+}
+
+static int32_t xensiv_pas_gas_bench_set_scratch_pad(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_set_scratch_pad(dev, 0x5AU);
+}
+
+static int32_t xensiv_pas_gas_bench_get_scratch_pad(xensiv_pas_gas_t *dev) {
+    uint8_t val;
+    return xensiv_pas_gas_get_scratch_pad(dev, &val);
+}
+
+static int32_t xensiv_pas_gas_bench_cmd_soft_reset(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_cmd(dev, XENSIV_PAS_GAS_CMD_SOFT_RESET);
+}
+
+static int32_t xensiv_pas_gas_bench_start_single_mode(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_start_single_mode(dev);
+}
+
+static int32_t xensiv_pas_gas_bench_start_continuous_mode(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_start_continuous_mode(dev, 10U);
+}
+
+static int32_t xensiv_pas_gas_bench_perform_forced_compensation(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_perform_forced_compensation(dev, 400U);
+}
+
+static int32_t xensiv_pas_gas_bench_co2_init(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_co2_init(dev, XENSIV_PAS_GAS_INTERFACE_I2C, dev->ctx);
+}
+
+static int32_t xensiv_pas_gas_bench_co2_init_uart(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_co2_init(dev, XENSIV_PAS_GAS_INTERFACE_UART, dev->ctx);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_init(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_r290_init(dev, XENSIV_PAS_GAS_INTERFACE_I2C, dev->ctx);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_init(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_a2l_init(dev, XENSIV_PAS_GAS_INTERFACE_I2C, dev->ctx);
+}
+
+/************************************* R290 API ******************************************/
+
+static int32_t xensiv_pas_gas_bench_r290_get_device_id(xensiv_pas_gas_t *dev) {
+    uint8_t dev_id;
+    return xensiv_pas_gas_r290_get_device_id(dev, &dev_id);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_aboc_prefill(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_r290_aboc_prefill(dev, 1U);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_set_alarm_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_alarm_config_t alarm_config = { .u = 0U };
+    return xensiv_pas_gas_r290_set_alarm_config(dev, alarm_config);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_get_alarm_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_alarm_config_t alarm_config;
+    return xensiv_pas_gas_r290_get_alarm_config(dev, &alarm_config);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_set_aboc_cycle(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_aboc_cycle_config_t aboc_cycle = { .u = 7U };
+    return xensiv_pas_gas_r290_set_aboc_cycle(dev, aboc_cycle);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_get_aboc_cycle(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_aboc_cycle_config_t aboc_cycle;
+    return xensiv_pas_gas_r290_get_aboc_cycle(dev, &aboc_cycle);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_set_denoise_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_denoise_config_t denoise_config = { .u = 4U };
+    return xensiv_pas_gas_r290_set_denoise_config(dev, denoise_config);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_get_denoise_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_denoise_config_t denoise_config;
+    return xensiv_pas_gas_r290_get_denoise_config(dev, &denoise_config);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_get_self_test(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_self_test_t self_test;
+    return xensiv_pas_gas_r290_get_self_test(dev, &self_test);
+}
+
+static int32_t xensiv_pas_gas_bench_r290_clr_self_test(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_r290_self_test_clr_t self_test_clr = { .u = 0x1FU };
+    return xensiv_pas_gas_r290_clr_self_test(dev, self_test_clr);
+}
+
+/************************************* A2L API *******************************************/
+
+static int32_t xensiv_pas_gas_bench_a2l_get_dev_idx(xensiv_pas_gas_t *dev) {
+    uint8_t dev_idx;
+    return xensiv_pas_gas_a2l_get_dev_idx(dev, &dev_idx);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_device_id(xensiv_pas_gas_t *dev) {
+    uint8_t dev_id;
+    return xensiv_pas_gas_a2l_get_device_id(dev, &dev_id);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_aboc_prefill(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_a2l_aboc_prefill(dev, 1U);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_alarm_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_alarm_config_t alarm_config = { .u = 0U };
+    return xensiv_pas_gas_a2l_set_alarm_config(dev, alarm_config);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_alarm_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_alarm_config_t alarm_config;
+    return xensiv_pas_gas_a2l_get_alarm_config(dev, &alarm_config);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_aboc_cycle(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_aboc_cycle_config_t aboc_cycle = { .u = 7U };
+    return xensiv_pas_gas_a2l_set_aboc_cycle(dev, aboc_cycle);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_aboc_cycle(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_aboc_cycle_config_t aboc_cycle;
+    return xensiv_pas_gas_a2l_get_aboc_cycle(dev, &aboc_cycle);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_denoise_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_denoise_config_t denoise_config = { .u = 4U };
+    return xensiv_pas_gas_a2l_set_denoise_config(dev, denoise_config);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_denoise_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_denoise_config_t denoise_config;
+    return xensiv_pas_gas_a2l_get_denoise_config(dev, &denoise_config);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_self_test(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_self_test_t self_test;
+    return xensiv_pas_gas_a2l_get_self_test(dev, &self_test);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_clr_self_test(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_self_test_clr_t self_test_clr = { .u = 0x1FU };
+    return xensiv_pas_gas_a2l_clr_self_test(dev, self_test_clr);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_gas_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_gas_config_t gas_config = { .u = 0U };
+    gas_config.b.gas_select = XENSIV_PAS_GAS_A2L_GAS_R32;
+    return xensiv_pas_gas_a2l_set_gas_config(dev, gas_config);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_gas_config(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_gas_config_t gas_config;
+    return xensiv_pas_gas_a2l_get_gas_config(dev, &gas_config);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_gas_selection(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_gas_selection_t gas;
+    return xensiv_pas_gas_a2l_get_gas_selection(dev, &gas);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_available_gases(xensiv_pas_gas_t *dev) {
+    uint8_t gas_avail;
+    return xensiv_pas_gas_a2l_get_available_gases(dev, &gas_avail);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_alarm_hysteresis(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_a2l_set_alarm_hysteresis(dev, 100U);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_alarm_hysteresis(xensiv_pas_gas_t *dev) {
+    uint16_t alarm_hys;
+    return xensiv_pas_gas_a2l_get_alarm_hysteresis(dev, &alarm_hys);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_absolute_humidity_ref(xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_a2l_set_absolute_humidity_ref(dev, 115U);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_absolute_humidity_ref(xensiv_pas_gas_t *dev) {
+    uint16_t abs_hum_ref;
+    return xensiv_pas_gas_a2l_get_absolute_humidity_ref(dev, &abs_hum_ref);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_set_humidity_control(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_humidity_control_t hc_control = { .u = 0U };
+    hc_control.b.hc_enable = 1U;
+    return xensiv_pas_gas_a2l_set_humidity_control(dev, hc_control);
+}
+
+static int32_t xensiv_pas_gas_bench_a2l_get_humidity_control(xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_a2l_humidity_control_t hc_control;
+    return xensiv_pas_gas_a2l_get_humidity_control(dev, &hc_control);
+}
+
+/********************************** Benchmark cases **************************************/
+
+#define XENSIV_PAS_GAS_BENCH_CO2_I2C   XENSIV_PAS_GAS_VARIANT_CO2, XENSIV_PAS_GAS_INTERFACE_I2C
+#define XENSIV_PAS_GAS_BENCH_CO2_UART  XENSIV_PAS_GAS_VARIANT_CO2, XENSIV_PAS_GAS_INTERFACE_UART
+#define XENSIV_PAS_GAS_BENCH_R290_I2C  XENSIV_PAS_GAS_VARIANT_R290, XENSIV_PAS_GAS_INTERFACE_I2C
+#define XENSIV_PAS_GAS_BENCH_A2L_I2C   XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_I2C
+
+static const xensiv_pas_gas_bench_case_t xensiv_pas_gas_bench_cases[] =
+{
+    { "co2_init", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_co2_init },
+    { "get_id", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_id },
+    { "get_status", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_status },
+    { "clear_status", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_clear_status },
+    { "get_interrupt_config", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_interrupt_config },
+    { "set_interrupt_config", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_interrupt_config },
+    { "get_measurement_config", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_measurement_config },
+    { "set_measurement_config", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_measurement_config },
+    { "get_result", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, xensiv_pas_gas_bench_set_drdy, xensiv_pas_gas_bench_get_result },
+    { "get_result_not_ready", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_result },
+    { "set_measurement_rate", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_measurement_rate },
+    { "get_measurement_status", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_measurement_status },
+    { "clear_measurement_status", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_clear_measurement_status },
+    { "set_alarm_threshold", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_alarm_threshold },
+    { "set_pressure_compensation", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_pressure_compensation },
+    { "set_offset_compensation", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_offset_compensation },
+    { "set_scratch_pad", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_scratch_pad },
+    { "get_scratch_pad", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_scratch_pad },
+    { "cmd_soft_reset", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_cmd_soft_reset },
+    { "start_single_mode", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_start_single_mode },
+    { "start_continuous_mode", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_start_continuous_mode },
+    { "perform_forced_compensation", XENSIV_PAS_GAS_BENCH_CO2_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_perform_forced_compensation },
+
+    { "uart_co2_init", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_co2_init_uart },
+    { "uart_get_status", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_get_status },
+    { "uart_get_result", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS, xensiv_pas_gas_bench_set_drdy, xensiv_pas_gas_bench_get_result },
+    { "uart_set_measurement_rate", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_measurement_rate },
+    { "uart_set_pressure_compensation", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_set_pressure_compensation },
+    { "uart_cmd_soft_reset", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_cmd_soft_reset },
+    { "uart_start_continuous_mode", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_start_continuous_mode },
+    { "uart_perform_forced_compensation", XENSIV_PAS_GAS_BENCH_CO2_UART, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_perform_forced_compensation },
+
+    { "r290_init", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_r290_init },
+    { "r290_get_device_id", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_get_device_id },
+    { "r290_aboc_prefill", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_aboc_prefill },
+    { "r290_set_alarm_config", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_set_alarm_config },
+    { "r290_get_alarm_config", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_get_alarm_config },
+    { "r290_set_aboc_cycle", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_set_aboc_cycle },
+    { "r290_get_aboc_cycle", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_get_aboc_cycle },
+    { "r290_set_denoise_config", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_set_denoise_config },
+    { "r290_get_denoise_config", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_get_denoise_config },
+    { "r290_get_self_test", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_get_self_test },
+    { "r290_clr_self_test", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_r290_clr_self_test },
+    { "r290_perform_forced_compensation", XENSIV_PAS_GAS_BENCH_R290_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_perform_forced_compensation },
+
+    { "a2l_init", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_a2l_init },
+    { "a2l_get_dev_idx", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_dev_idx },
+    { "a2l_get_device_id", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_device_id },
+    { "a2l_aboc_prefill", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_aboc_prefill },
+    { "a2l_set_alarm_config", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_alarm_config },
+    { "a2l_get_alarm_config", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_alarm_config },
+    { "a2l_set_aboc_cycle", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_aboc_cycle },
+    { "a2l_get_aboc_cycle", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_aboc_cycle },
+    { "a2l_set_denoise_config", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_denoise_config },
+    { "a2l_get_denoise_config", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_denoise_config },
+    { "a2l_get_self_test", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_self_test },
+    { "a2l_clr_self_test", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_clr_self_test },
+    { "a2l_set_gas_config", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_gas_config },
+    { "a2l_get_gas_config", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_gas_config },
+    { "a2l_get_gas_selection", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_gas_selection },
+    { "a2l_get_available_gases", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_available_gases },
+    { "a2l_set_alarm_hysteresis", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_alarm_hysteresis },
+    { "a2l_get_alarm_hysteresis", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_alarm_hysteresis },
+    { "a2l_set_absolute_humidity_ref", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_absolute_humidity_ref },
+    { "a2l_get_absolute_humidity_ref", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_absolute_humidity_ref },
+    { "a2l_set_humidity_control", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_set_humidity_control },
+    { "a2l_get_humidity_control", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS, NULL, xensiv_pas_gas_bench_a2l_get_humidity_control },
+    { "a2l_perform_forced_compensation", XENSIV_PAS_GAS_BENCH_A2L_I2C, XENSIV_PAS_GAS_BENCH_ITERATIONS_SLOW, NULL, xensiv_pas_gas_bench_perform_forced_compensation },
+};
+
+static const char *xensiv_pas_gas_bench_variant_name(xensiv_pas_gas_variant_t variant) {
+    switch (variant)
+    {
+        case XENSIV_PAS_GAS_VARIANT_CO2:
+            return "co2";
+        case XENSIV_PAS_GAS_VARIANT_R290:
+            return "r290";
+        case XENSIV_PAS_GAS_VARIANT_A2L:
+            return "a2l";
+        default:
+            return "base";
+    }
+}
+
+static int32_t xensiv_pas_gas_bench_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_variant_t variant, xensiv_pas_gas_interface_t itf, void *ctx) {
+    switch (variant)
+    {
+        case XENSIV_PAS_GAS_VARIANT_R290:
+            return xensiv_pas_gas_r290_init(dev, itf, ctx);
+        case XENSIV_PAS_GAS_VARIANT_A2L:
+            return xensiv_pas_gas_a2l_init(dev, itf, ctx);
+        default:
+            return xensiv_pas_gas_co2_init(dev, itf, ctx);
+    }
+}
+
+static int32_t xensiv_pas_gas_bench_run(const xensiv_pas_gas_bench_case_t *bench, xensiv_pas_gas_bench_result_t *result) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+
+    (void)memset(result, 0, sizeof(*result));
+    (void)memset(&dev, 0, sizeof(dev));
+    xensiv_pas_gas_emul_init(&emul, bench->variant);
+
+    int32_t res = xensiv_pas_gas_bench_init(&dev, bench->variant, bench->itf, &emul);
+
+    for (uint32_t i = 0U; (XENSIV_PAS_GAS_OK == res) && (i < bench->iterations); ++i)
+    {
+        xensiv_pas_gas_emul_bus_stats_t before;
+        xensiv_pas_gas_emul_bus_stats_t after;
+
+        if (bench->prepare != NULL) {
+            bench->prepare(&emul);
+        }
+
+        xensiv_pas_gas_emul_get_bus_stats(&before);
+        uint64_t cpu_start = xensiv_pas_gas_bench_cpu_ns();
+        result->last_res = bench->run(&dev);
+        uint64_t cpu_end = xensiv_pas_gas_bench_cpu_ns();
+        xensiv_pas_gas_emul_get_bus_stats(&after);
+
+        result->transactions += (uint64_t)(after.i2c_transfers - before.i2c_transfers) + (after.uart_writes - before.uart_writes);
+        result->bytes += after.bytes - before.bytes;
+        result->delay_ms += after.delay_ms - before.delay_ms;
+        result->bus_ns += after.bus_ns - before.bus_ns;
+        result->cpu_ns += cpu_end - cpu_start;
+        if (XENSIV_PAS_GAS_OK != result->last_res) {
+            result->errors++;
+        }
+    }
+
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    return res;
+}
+
+int main(int argc, char *argv[]) {
+    const char *filter = (argc > 1) ? argv[1] : NULL;
+    bool first = true;
+    int ret = 0;
+
+    (void)printf("{\n  \"benchmarks\": [");
+
+    for (size_t i = 0U; i < (sizeof(xensiv_pas_gas_bench_cases) / sizeof(xensiv_pas_gas_bench_cases[0])); ++i)
+    {
+        const xensiv_pas_gas_bench_case_t *bench = &xensiv_pas_gas_bench_cases[i];
+        xensiv_pas_gas_bench_result_t result;
+
+        if ((filter != NULL) && (strstr(bench->name, filter) == NULL)) {
+            continue;
+        }
+
+        int32_t res = xensiv_pas_gas_bench_run(bench, &result);
+        if (XENSIV_PAS_GAS_OK != res) {
+            (void)fprintf(stderr, "%s: sensor initialization failed (%d)\n", bench->name, (int)res);
+            ret = 1;
+            continue;
+        }
+
+        double n = (double)bench->iterations;
+        (void)printf("%s\n    {\"name\": \"%s\", \"variant\": \"%s\", \"interface\": \"%s\", \"iterations\": %u, "
+                     "\"result\": %d, \"errors\": %u, "
+                     "\"transactions\": %.2f, \"bytes\": %.2f, \"delay_ms\": %.2f, \"bus_us\": %.2f, \"cpu_ns\": %.0f}",
+                     first ? "" : ",",
+                     bench->name,
+                     xensiv_pas_gas_bench_variant_name(bench->variant),
+                     (XENSIV_PAS_GAS_INTERFACE_I2C == bench->itf) ? "i2c" : "uart",
+                     (unsigned)bench->iterations,
+                     (int)result.last_res,
+                     (unsigned)result.errors,
+                     (double)result.transactions / n,
+                     (double)result.bytes / n,
+                     (double)result.delay_ms / n,
+                     ((double)result.bus_ns / 1000.0) / n,
+                     (double)result.cpu_ns / n);
+        first = false;
+    }
+
+    (void)printf("\n  ]\n}\n");
+
+    return ret;
+}
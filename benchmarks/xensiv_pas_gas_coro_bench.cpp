@@ -0,0 +1,196 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_coro_bench.cpp
+ *
+ * Description: Benchmark of the C++20 coroutine layer driving many emulated sensors from a single
+ *              thread, against the blocking functions called one sensor after the other. For every
+ *              operation it reports the elapsed virtual time and the bus transfers as JSON on stdout.
+ *
+ *              Usage: xensiv_pas_gas_coro_bench [number of sensors]
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "src/xensiv_pas_gas.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_coro.hpp"
+#include "src/xensiv_pas_gas_emul.h"
+
+#define XENSIV_PAS_GAS_CORO_BENCH_SENSORS        (256U)
+#define XENSIV_PAS_GAS_CORO_BENCH_RATE_S         (10U)
+#define XENSIV_PAS_GAS_CORO_BENCH_GAS            (400U)
+
+namespace
+{
+
+/* Elapsed virtual time and bus traffic of one operation on all sensors */
+struct xensiv_pas_gas_coro_bench_result
+{
+    uint64_t elapsed_us;
+    uint32_t transfers;
+    uint32_t errors;
+};
+
+class xensiv_pas_gas_coro_bench_meter
+{
+public:
+    xensiv_pas_gas_coro_bench_meter() : start_us_(xensiv_pas_gas_emul_now_us()) {
+        xensiv_pas_gas_emul_reset_bus_stats();
+    }
+
+    xensiv_pas_gas_coro_bench_result stop(uint32_t errors) const {
+        xensiv_pas_gas_emul_bus_stats_t stats;
+        xensiv_pas_gas_emul_get_bus_stats(&stats);
+        return { xensiv_pas_gas_emul_now_us() - start_us_, stats.i2c_transfers, errors };
+    }
+
+private:
+    uint64_t start_us_;
+};
+
+/* Coroutine layer: the waits of all sensors overlap */
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_bench_init(xensiv_pas_gas::sensor &sensor, xensiv_pas_gas_emul_t *emul, uint32_t &errors) {
+    int32_t res = co_await sensor.init(XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_I2C, emul);
+    if (XENSIV_PAS_GAS_OK != res) {
+        errors++;
+    }
+}
+
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_bench_fcs(xensiv_pas_gas::sensor &sensor, uint32_t &errors) {
+    int32_t res = co_await sensor.forced_compensation(XENSIV_PAS_GAS_CORO_BENCH_GAS);
+    if (XENSIV_PAS_GAS_OK != res) {
+        errors++;
+    }
+}
+
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_bench_read(xensiv_pas_gas::sensor &sensor, uint32_t &errors) {
+    auto [res, val] = co_await sensor.read_result();
+    if ((XENSIV_PAS_GAS_OK != res) || (XENSIV_PAS_GAS_CORO_BENCH_GAS != val)) {
+        errors++;
+    }
+}
+
+void xensiv_pas_gas_coro_bench_print(const char *name, const char *mode, size_t count, const xensiv_pas_gas_coro_bench_result &result, bool first) {
+    (void)std::printf("%s\n    {\"name\": \"%s\", \"mode\": \"%s\", \"sensors\": %u, \"errors\": %u, "
+                      "\"elapsed_ms\": %.1f, \"transfers\": %u}",
+                      first ? "" : ",", name, mode, (unsigned)count, (unsigned)result.errors,
+                      (double)result.elapsed_us / 1000.0, (unsigned)result.transfers);
+}
+
+} /* namespace */
+
+int main(int argc, char *argv[]) {
+    size_t count = (argc > 1) ? (size_t)std::strtoul(argv[1], nullptr, 10) : XENSIV_PAS_GAS_CORO_BENCH_SENSORS;
+    std::vector<xensiv_pas_gas_emul_t> emuls(count);
+    int ret = 0;
+
+    for (xensiv_pas_gas_emul_t &emul : emuls)
+    {
+        xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+        xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_CORO_BENCH_GAS);
+    }
+
+    (void)std::printf("{\n  \"benchmarks\": [");
+
+    /* Blocking functions, one sensor after the other */
+    {
+        std::vector<xensiv_pas_gas_t> devs(count);
+        uint32_t errors = 0U;
+        xensiv_pas_gas_coro_bench_meter meter;
+        for (size_t i = 0U; i < count; ++i)
+        {
+            errors += (XENSIV_PAS_GAS_OK != xensiv_pas_gas_a2l_init(&devs[i], XENSIV_PAS_GAS_INTERFACE_I2C, &emuls[i])) ? 1U : 0U;
+        }
+        xensiv_pas_gas_coro_bench_print("init", "blocking", count, meter.stop(errors), true);
+
+        errors = 0U;
+        meter = xensiv_pas_gas_coro_bench_meter();
+        for (size_t i = 0U; i < count; ++i)
+        {
+            errors += (XENSIV_PAS_GAS_OK != xensiv_pas_gas_perform_forced_compensation(&devs[i], XENSIV_PAS_GAS_CORO_BENCH_GAS)) ? 1U : 0U;
+        }
+        xensiv_pas_gas_coro_bench_print("forced_compensation", "blocking", count, meter.stop(errors), false);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            (void)xensiv_pas_gas_start_single_mode(&devs[i]);
+        }
+        xensiv_pas_gas_emul_advance_us((uint64_t)XENSIV_PAS_GAS_CORO_BENCH_RATE_S * 1000000U);
+
+        errors = 0U;
+        meter = xensiv_pas_gas_coro_bench_meter();
+        for (size_t i = 0U; i < count; ++i)
+        {
+            uint16_t val;
+            errors += ((XENSIV_PAS_GAS_OK != xensiv_pas_gas_get_result(&devs[i], &val)) || (XENSIV_PAS_GAS_CORO_BENCH_GAS != val)) ? 1U : 0U;
+        }
+        xensiv_pas_gas_coro_bench_print("read_result", "blocking", count, meter.stop(errors), false);
+        ret |= (errors != 0U) ? 1 : 0;
+    }
+
+    /* Coroutine layer, all sensors on one executor */
+    {
+        xensiv_pas_gas::executor exec;
+        std::vector<xensiv_pas_gas::sensor> sensors(count, xensiv_pas_gas::sensor(exec));
+        uint32_t errors = 0U;
+        xensiv_pas_gas_coro_bench_meter meter;
+        for (size_t i = 0U; i < count; ++i)
+        {
+            exec.spawn(xensiv_pas_gas_coro_bench_init(sensors[i], &emuls[i], errors));
+        }
+        exec.run();
+        xensiv_pas_gas_coro_bench_print("init", "coroutine", count, meter.stop(errors), false);
+
+        errors = 0U;
+        meter = xensiv_pas_gas_coro_bench_meter();
+        for (size_t i = 0U; i < count; ++i)
+        {
+            exec.spawn(xensiv_pas_gas_coro_bench_fcs(sensors[i], errors));
+        }
+        exec.run();
+        xensiv_pas_gas_coro_bench_print("forced_compensation", "coroutine", count, meter.stop(errors), false);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            (void)xensiv_pas_gas_start_single_mode(sensors[i].get());
+        }
+        xensiv_pas_gas_emul_advance_us((uint64_t)XENSIV_PAS_GAS_CORO_BENCH_RATE_S * 1000000U);
+
+        errors = 0U;
+        meter = xensiv_pas_gas_coro_bench_meter();
+        for (size_t i = 0U; i < count; ++i)
+        {
+            exec.spawn(xensiv_pas_gas_coro_bench_read(sensors[i], errors));
+        }
+        exec.run();
+        xensiv_pas_gas_coro_bench_print("read_result", "coroutine", count, meter.stop(errors), false);
+        ret |= (errors != 0U) ? 1 : 0;
+    }
+
+    (void)std::printf("\n  ]\n}\n");
+
+    for (xensiv_pas_gas_emul_t &emul : emuls)
+    {
+        xensiv_pas_gas_emul_deinit(&emul);
+    }
+
+    return ret;
+}
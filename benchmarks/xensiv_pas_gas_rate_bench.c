@@ -0,0 +1,308 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_rate_bench.c
+ *
+ * Description: Benchmark of the adaptive measurement rate controller against fixed measurement
+ *              rates on emulated gas concentration traces. For every trace and strategy it reports
+ *              the bus traffic and the latency from the concentration crossing the alarm threshold
+ *              to the application reading a value above it, as JSON on stdout.
+ *
+ *              Usage: xensiv_pas_gas_rate_bench [name filter]
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "src/xensiv_pas_gas.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_rate.h"
+#include "src/xensiv_pas_gas_emul.h"
+
+#define XENSIV_PAS_GAS_RATE_BENCH_DURATION_MS    (8UL * 3600UL * 1000UL)
+#define XENSIV_PAS_GAS_RATE_BENCH_STEP_MS        (20000UL)
+#define XENSIV_PAS_GAS_RATE_BENCH_MAX_POINTS     (2048U)
+#define XENSIV_PAS_GAS_RATE_BENCH_BASELINE       (100U)
+#define XENSIV_PAS_GAS_RATE_BENCH_NOISE          (8U)
+#define XENSIV_PAS_GAS_RATE_BENCH_ALARM_TH       (1000U)
+
+/* Gas concentration trace */
+typedef struct
+{
+    const char *name;
+    xensiv_pas_gas_emul_trace_point_t points[XENSIV_PAS_GAS_RATE_BENCH_MAX_POINTS];
+    size_t len;
+} xensiv_pas_gas_rate_bench_trace_t;
+
+/* Measurement rate strategy; a fixed rate if adaptive is false */
+typedef struct
+{
+    const char *name;
+    bool adaptive;
+    uint16_t rate_s;
+} xensiv_pas_gas_rate_bench_strategy_t;
+
+/* Totals of a run */
+typedef struct
+{
+    uint64_t transactions;
+    uint64_t bytes;
+    uint64_t bus_ns;
+    uint32_t samples;
+    uint32_t rate_changes;
+    int64_t detection_ms;
+    int32_t res;
+} xensiv_pas_gas_rate_bench_result_t;
+
+static xensiv_pas_gas_rate_bench_trace_t xensiv_pas_gas_rate_bench_traces[4];
+
+static const xensiv_pas_gas_rate_bench_strategy_t xensiv_pas_gas_rate_bench_strategies[] =
+{
+    { "fixed_3s", false, XENSIV_PAS_GAS_A2L_MEAS_RATE_MIN },
+    { "fixed_60s", false, 60U },
+    { "fixed_600s", false, 600U },
+    { "adaptive_60s", true, 60U },
+    { "adaptive_600s", true, 600U },
+};
+
+/********************************* Trace generation **************************************/
+
+static uint32_t xensiv_pas_gas_rate_bench_seed;
+
+static uint16_t xensiv_pas_gas_rate_bench_noise(void) {
+    xensiv_pas_gas_rate_bench_seed = (xensiv_pas_gas_rate_bench_seed * 1103515245UL) + 12345UL;
+    return (uint16_t)((xensiv_pas_gas_rate_bench_seed >> 16U) % ((2U * XENSIV_PAS_GAS_RATE_BENCH_NOISE) + 1U));
+}
+
+/* Fills the trace with the noisy baseline plus the shape evaluated every step */
+static void xensiv_pas_gas_rate_bench_make_trace(xensiv_pas_gas_rate_bench_trace_t *trace, const char *name, uint16_t (*shape)(uint32_t t_ms)) {
+    trace->name = name;
+    trace->len = 0U;
+    xensiv_pas_gas_rate_bench_seed = 1U;
+
+    for (uint32_t t_ms = 0U; t_ms <= XENSIV_PAS_GAS_RATE_BENCH_DURATION_MS; t_ms += XENSIV_PAS_GAS_RATE_BENCH_STEP_MS)
+    {
+        xensiv_pas_gas_emul_trace_point_t *point = &trace->points[trace->len++];
+        point->t_ms = t_ms;
+        point->val = (uint16_t)(XENSIV_PAS_GAS_RATE_BENCH_BASELINE - XENSIV_PAS_GAS_RATE_BENCH_NOISE + xensiv_pas_gas_rate_bench_noise() + shape(t_ms));
+    }
+}
+
+static uint16_t xensiv_pas_gas_rate_bench_quiet(uint32_t t_ms) {
+    (void)t_ms;
+    return 0U;
+}
+
+/* Sudden leak after 5 hours, reaching 3000 within one minute */
+static uint16_t xensiv_pas_gas_rate_bench_leak_step(uint32_t t_ms) {
+    const uint32_t start_ms = 5UL * 3600UL * 1000UL;
+    if (t_ms < start_ms) {
+        return 0U;
+    }
+    return (t_ms >= (start_ms + 60000UL)) ? 3000U : (uint16_t)(((t_ms - start_ms) * 3000UL) / 60000UL);
+}
+
+/* Slow leak from 2 hours on, rising by 1400 over 4 hours */
+static uint16_t xensiv_pas_gas_rate_bench_slow_leak(uint32_t t_ms) {
+    const uint32_t start_ms = 2UL * 3600UL * 1000UL;
+    const uint32_t ramp_ms = 4UL * 3600UL * 1000UL;
+    if (t_ms < start_ms) {
+        return 0U;
+    }
+    return (t_ms >= (start_ms + ramp_ms)) ? 1400U : (uint16_t)(((uint64_t)(t_ms - start_ms) * 1400U) / ramp_ms);
+}
+
+/* Excursions to 500 above the baseline lasting 3 minutes every 90 minutes, below the alarm threshold */
+static uint16_t xensiv_pas_gas_rate_bench_transients(uint32_t t_ms) {
+    uint32_t phase_ms = (t_ms + (60UL * 60UL * 1000UL)) % (90UL * 60UL * 1000UL);
+    return (phase_ms < (3UL * 60UL * 1000UL)) ? 500U : 0U;
+}
+
+/* Time at which the trace first exceeds the alarm threshold; -1 if never */
+static int64_t xensiv_pas_gas_rate_bench_crossing_ms(const xensiv_pas_gas_rate_bench_trace_t *trace) {
+    for (size_t i = 1U; i < trace->len; ++i)
+    {
+        const xensiv_pas_gas_emul_trace_point_t *prev = &trace->points[i - 1U];
+        const xensiv_pas_gas_emul_trace_point_t *point = &trace->points[i];
+
+        if ((point->val > XENSIV_PAS_GAS_RATE_BENCH_ALARM_TH) && (prev->val <= XENSIV_PAS_GAS_RATE_BENCH_ALARM_TH)) {
+            uint32_t dv = (uint32_t)point->val - prev->val;
+            uint32_t off = (uint32_t)XENSIV_PAS_GAS_RATE_BENCH_ALARM_TH + 1U - prev->val;
+            return (int64_t)prev->t_ms + (int64_t)(((uint64_t)(point->t_ms - prev->t_ms) * off) / dv);
+        }
+    }
+
+    return -1;
+}
+
+/************************************* Runner ********************************************/
+
+static bool xensiv_pas_gas_rate_bench_drdy;
+
+static void xensiv_pas_gas_rate_bench_int_cb(xensiv_pas_gas_emul_t *emul, bool level, uint64_t time_us, void *arg) {
+    (void)emul;
+    (void)time_us;
+    (void)arg;
+
+    if (level) {
+        xensiv_pas_gas_rate_bench_drdy = true;
+    }
+}
+
+static int32_t xensiv_pas_gas_rate_bench_run(const xensiv_pas_gas_rate_bench_trace_t *trace, const xensiv_pas_gas_rate_bench_strategy_t *strategy,
+                                             xensiv_pas_gas_rate_bench_result_t *result) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_rate_ctrl_t ctrl;
+
+    (void)memset(result, 0, sizeof(*result));
+    result->detection_ms = -1;
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_set_int_callback(&emul, xensiv_pas_gas_rate_bench_int_cb, NULL);
+    xensiv_pas_gas_rate_bench_drdy = false;
+
+    /* Application setup, not counted */
+    int32_t res = xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul);
+    if (XENSIV_PAS_GAS_OK == res) {
+        xensiv_pas_gas_interrupt_config_t int_cfg = { .u = 0U };
+        int_cfg.b.int_func = XENSIV_PAS_GAS_INTERRUPT_FUNCTION_DRDY;
+        int_cfg.b.int_typ = XENSIV_PAS_GAS_INTERRUPT_TYPE_HIGH_ACTIVE;
+        int_cfg.b.alarm_typ = XENSIV_PAS_GAS_ALARM_TYPE_LOW_TO_HIGH;
+        res = xensiv_pas_gas_set_interrupt_config(&dev, int_cfg);
+    }
+    if (XENSIV_PAS_GAS_OK == res) {
+        res = xensiv_pas_gas_set_alarm_threshold(&dev, XENSIV_PAS_GAS_RATE_BENCH_ALARM_TH);
+    }
+
+    xensiv_pas_gas_emul_reset_bus_stats();
+    xensiv_pas_gas_emul_play_trace(&emul, trace->points, trace->len, false);
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    uint64_t end_us = start_us + ((uint64_t)XENSIV_PAS_GAS_RATE_BENCH_DURATION_MS * 1000U);
+    int64_t crossing_ms = xensiv_pas_gas_rate_bench_crossing_ms(trace);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        if (strategy->adaptive) {
+            xensiv_pas_gas_rate_ctrl_config_t config;
+            xensiv_pas_gas_rate_ctrl_get_default_config(&config);
+            config.rate_slow_s = strategy->rate_s;
+            res = xensiv_pas_gas_rate_ctrl_init(&ctrl, &dev, &config);
+        } else {
+            res = xensiv_pas_gas_start_continuous_mode(&dev, strategy->rate_s);
+        }
+    }
+
+    while ((XENSIV_PAS_GAS_OK == res) && (xensiv_pas_gas_emul_now_us() < end_us))
+    {
+        uint64_t now_us = xensiv_pas_gas_emul_now_us();
+        uint64_t next_us = xensiv_pas_gas_emul_next_event_us();
+        xensiv_pas_gas_emul_advance_us((next_us < end_us) ? ((next_us > now_us) ? (next_us - now_us) : 0U) : (end_us - now_us));
+
+        if (!xensiv_pas_gas_rate_bench_drdy) {
+            continue;
+        }
+        xensiv_pas_gas_rate_bench_drdy = false;
+
+        uint16_t val;
+        res = xensiv_pas_gas_get_result(&dev, &val);
+        if (XENSIV_PAS_GAS_OK != res) {
+            break;
+        }
+        result->samples++;
+
+        int64_t t_ms = (int64_t)((xensiv_pas_gas_emul_now_us() - start_us) / 1000U);
+        if ((result->detection_ms < 0) && (crossing_ms >= 0) && (val > XENSIV_PAS_GAS_RATE_BENCH_ALARM_TH)) {
+            result->detection_ms = t_ms - crossing_ms;
+        }
+
+        if (strategy->adaptive) {
+            uint16_t rate_s = xensiv_pas_gas_rate_ctrl_get_rate(&ctrl);
+            res = xensiv_pas_gas_rate_ctrl_update(&ctrl, val);
+            if (xensiv_pas_gas_rate_ctrl_get_rate(&ctrl) != rate_s) {
+                result->rate_changes++;
+            }
+        }
+    }
+
+    xensiv_pas_gas_emul_bus_stats_t stats;
+    xensiv_pas_gas_emul_get_bus_stats(&stats);
+    result->transactions = stats.i2c_transfers;
+    result->bytes = stats.bytes;
+    result->bus_ns = stats.bus_ns;
+    result->res = res;
+
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    return res;
+}
+
+int main(int argc, char *argv[]) {
+    const char *filter = (argc > 1) ? argv[1] : NULL;
+    const double hours = (double)XENSIV_PAS_GAS_RATE_BENCH_DURATION_MS / 3600000.0;
+    char name[64];
+    bool first = true;
+    int ret = 0;
+
+    xensiv_pas_gas_rate_bench_make_trace(&xensiv_pas_gas_rate_bench_traces[0], "quiet", xensiv_pas_gas_rate_bench_quiet);
+    xensiv_pas_gas_rate_bench_make_trace(&xensiv_pas_gas_rate_bench_traces[1], "leak_step", xensiv_pas_gas_rate_bench_leak_step);
+    xensiv_pas_gas_rate_bench_make_trace(&xensiv_pas_gas_rate_bench_traces[2], "slow_leak", xensiv_pas_gas_rate_bench_slow_leak);
+    xensiv_pas_gas_rate_bench_make_trace(&xensiv_pas_gas_rate_bench_traces[3], "transients", xensiv_pas_gas_rate_bench_transients);
+
+    (void)printf("{\n  \"benchmarks\": [");
+
+    for (size_t i = 0U; i < (sizeof(xensiv_pas_gas_rate_bench_traces) / sizeof(xensiv_pas_gas_rate_bench_traces[0])); ++i)
+    {
+        for (size_t j = 0U; j < (sizeof(xensiv_pas_gas_rate_bench_strategies) / sizeof(xensiv_pas_gas_rate_bench_strategies[0])); ++j)
+        {
+            const xensiv_pas_gas_rate_bench_trace_t *trace = &xensiv_pas_gas_rate_bench_traces[i];
+            const xensiv_pas_gas_rate_bench_strategy_t *strategy = &xensiv_pas_gas_rate_bench_strategies[j];
+            xensiv_pas_gas_rate_bench_result_t result;
+
+            (void)snprintf(name, sizeof(name), "%s/%s", trace->name, strategy->name);
+            if ((filter != NULL) && (strstr(name, filter) == NULL)) {
+                continue;
+            }
+
+            if (XENSIV_PAS_GAS_OK != xensiv_pas_gas_rate_bench_run(trace, strategy, &result)) {
+                (void)fprintf(stderr, "%s: failed (%d)\n", name, (int)result.res);
+                ret = 1;
+                continue;
+            }
+
+            (void)printf("%s\n    {\"name\": \"%s\", \"trace\": \"%s\", \"strategy\": \"%s\", \"hours\": %.1f, "
+                         "\"samples\": %u, \"rate_changes\": %u, "
+                         "\"transactions_per_hour\": %.1f, \"bytes_per_hour\": %.1f, \"bus_us_per_hour\": %.1f, ",
+                         first ? "" : ",",
+                         name, trace->name, strategy->name, hours,
+                         (unsigned)result.samples,
+                         (unsigned)result.rate_changes,
+                         (double)result.transactions / hours,
+                         (double)result.bytes / hours,
+                         ((double)result.bus_ns / 1000.0) / hours);
+            if (result.detection_ms >= 0) {
+                (void)printf("\"detection_latency_s\": %.1f}", (double)result.detection_ms / 1000.0);
+            } else {
+                (void)printf("\"detection_latency_s\": null}");
+            }
+            first = false;
+        }
+    }
+
+    (void)printf("\n  ]\n}\n");
+
+    return ret;
+}
@@ -23,12 +23,13 @@
  **************************************************************************************************/
 
 #include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_stats.h"
+#include "xensiv_pas_gas_trace.h"
+#include "xensiv_pas_gas_record.h"
+#include "xensiv_pas_gas_a2l_regs.h"
 
-#define XENSIV_PAS_GAS_COMM_DELAY_MS             (5U)
 #define XENSIV_PAS_GAS_COMM_TEST_VAL             (0xA5U)
 
-#define XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS       (2000U)
-
 #define XENSIV_PAS_GAS_I2C_WRITE_BUFFER_LEN      (17U)
 #define XENSIV_PAS_GAS_UART_WRITE_XFER_BUF_SIZE  (8U)
 #define XENSIV_PAS_GAS_UART_READ_XFER_BUF_SIZE   (5U)
@@ -38,6 +39,61 @@
 #define XENSIV_PAS_GAS_UART_ACK                  (0x06U)
 #define XENSIV_PAS_GAS_UART_NAK                  (0x15U)
 
+#define XENSIV_PAS_GAS_RETRY_MAX_ATTEMPTS        (3U)
+#define XENSIV_PAS_GAS_RETRY_BACKOFF_MS          (10U)
+#define XENSIV_PAS_GAS_RETRY_BACKOFF_MULTIPLIER  (2U)
+#define XENSIV_PAS_GAS_RETRY_BACKOFF_MAX_MS      (100U)
+
+#if !XENSIV_PAS_GAS_DISPATCH_FCS && XENSIV_PAS_GAS_ENABLE_CO2
+/** Forced compensation of the CO2 variant, called directly when it is the only procedure compiled in */
+extern int32_t xensiv_pas_gas_co2_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref);
+#endif
+
+static inline bool xensiv_pas_gas_is_instrumented(const xensiv_pas_gas_t *dev) {
+    bool res = false;
+#if XENSIV_PAS_GAS_ENABLE_STATS
+    res = res || (dev->stats != NULL);
+#endif
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+    res = res || (dev->trace != NULL) || (dev->record != NULL);
+#endif
+    (void)dev;
+    return res;
+}
+
+static inline uint64_t xensiv_pas_gas_instr_start(const xensiv_pas_gas_t *dev) {
+    return xensiv_pas_gas_is_instrumented(dev) ? xensiv_pas_gas_plat_get_time_us() : 0U;
+}
+
+static void xensiv_pas_gas_instr_access(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t start_us) {
+    if (xensiv_pas_gas_is_instrumented(dev)) {
+        uint64_t end_us = xensiv_pas_gas_plat_get_time_us();
+        xensiv_pas_gas_stats_record_access(dev, op, reg_addr, data, len, res, (end_us > start_us) ? (end_us - start_us) : 0U);
+        xensiv_pas_gas_trace_record(dev,
+                                    (XENSIV_PAS_GAS_STATS_OP_READ == op) ? XENSIV_PAS_GAS_TRACE_EVENT_READ : XENSIV_PAS_GAS_TRACE_EVENT_WRITE,
+                                    reg_addr, len, res, start_us, end_us);
+        xensiv_pas_gas_record_access(dev, XENSIV_PAS_GAS_STATS_OP_WRITE == op, reg_addr, data, len, res, start_us, end_us);
+    }
+}
+
+static void xensiv_pas_gas_delay(const xensiv_pas_gas_t *dev, uint32_t ms) {
+    uint64_t start_us = xensiv_pas_gas_instr_start(dev);
+
+    xensiv_pas_gas_plat_delay(ms);
+
+    if (xensiv_pas_gas_is_instrumented(dev)) {
+        xensiv_pas_gas_stats_record_delay(dev, ms);
+        xensiv_pas_gas_trace_record(dev, XENSIV_PAS_GAS_TRACE_EVENT_DELAY, 0U, 0U, XENSIV_PAS_GAS_OK, start_us, xensiv_pas_gas_plat_get_time_us());
+    }
+}
+
+void xensiv_pas_gas_base_delay(const xensiv_pas_gas_t *dev, uint32_t ms) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    xensiv_pas_gas_delay(dev, ms);
+}
+
+#if XENSIV_PAS_GAS_ENABLE_UART
 static inline uint8_t xensiv_pas_gas_digit_to_ascii(uint8_t digit) {
     xensiv_pas_gas_plat_assert(digit <= 0xFU);
 
@@ -57,6 +113,9 @@ static inline uint8_t xensiv_pas_gas_ascii_to_digit(uint8_t ascii) {
         return (uint8_t)(10u + (uint8_t)(ascii - (uint8_t)'A'));
     }
 }
+#endif /* XENSIV_PAS_GAS_ENABLE_UART */
+
+#if XENSIV_PAS_GAS_ENABLE_I2C
 
 static int32_t xensiv_pas_gas_i2c_read(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len) {
     xensiv_pas_gas_plat_assert(dev != NULL);
@@ -83,13 +142,24 @@ static int32_t xensiv_pas_gas_i2c_write(const xensiv_pas_gas_t *dev, uint8_t reg
 
     return xensiv_pas_gas_plat_i2c_transfer(dev->ctx, XENSIV_PAS_GAS_I2C_ADDR, w_data, w_len, NULL, 0);
 }
+#endif /* XENSIV_PAS_GAS_ENABLE_I2C */
+
+#if XENSIV_PAS_GAS_ENABLE_UART
+
+/* The UART interface addresses the registers up to SENS_RST only, the variant registers from 0x20 on are I2C only */
+static inline bool xensiv_pas_gas_uart_reaches(uint8_t reg_addr, uint8_t len) {
+    return ((uint16_t)reg_addr + len) <= ((uint16_t)XENSIV_PAS_GAS_REG_SENS_RST + 1U);
+}
 
 static int32_t xensiv_pas_gas_uart_read(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(dev->ctx != NULL);
-    xensiv_pas_gas_plat_assert(reg_addr <= XENSIV_PAS_GAS_REG_SENS_RST);
     xensiv_pas_gas_plat_assert(data != NULL);
 
+    if (!xensiv_pas_gas_uart_reaches(reg_addr, len)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
     int32_t res = XENSIV_PAS_GAS_OK;
 
     for (uint8_t i = 0; i < len; ++i)
@@ -125,9 +195,12 @@ static int32_t xensiv_pas_gas_uart_read(const xensiv_pas_gas_t *dev, uint8_t reg
 static int32_t xensiv_pas_gas_uart_write(const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(dev->ctx != NULL);
-    xensiv_pas_gas_plat_assert(reg_addr <= XENSIV_PAS_GAS_REG_SENS_RST);
     xensiv_pas_gas_plat_assert(data != NULL);
 
+    if (!xensiv_pas_gas_uart_reaches(reg_addr, len)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
     int32_t res = XENSIV_PAS_GAS_OK;
 
     for (uint8_t i = 0; i < len; ++i)
@@ -148,7 +221,12 @@ static int32_t xensiv_pas_gas_uart_write(const xensiv_pas_gas_t *dev, uint8_t re
             res = xensiv_pas_gas_plat_uart_read(dev->ctx, uart_buf, XENSIV_PAS_GAS_UART_WRITE_XFER_RESP_LEN);
 
             /* If command triggers a software reset ignores the sensor response */
-            if ((XENSIV_PAS_GAS_REG_SENS_RST != reg_addr) || ((uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET != data[i])) {
+            if (XENSIV_PAS_GAS_PENDING == res) {
+                /* A non-blocking platform has not received the response yet */
+            } else if ((XENSIV_PAS_GAS_REG_SENS_RST != reg_addr) || ((uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET != data[i])) {
+                if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_UART_NAK == uart_buf[0])) {
+                    xensiv_pas_gas_stats_record_nak(dev);
+                }
                 res = (XENSIV_PAS_GAS_OK == res) ?
                     ((XENSIV_PAS_GAS_UART_ACK == uart_buf[0]) ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_ERR_COMM) :
                     XENSIV_PAS_GAS_ERR_COMM;
@@ -166,12 +244,20 @@ static int32_t xensiv_pas_gas_uart_write(const xensiv_pas_gas_t *dev, uint8_t re
 
     return res;
 }
+#endif /* XENSIV_PAS_GAS_ENABLE_UART */
 
-int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
-    xensiv_pas_gas_plat_assert(dev != NULL);
-    xensiv_pas_gas_plat_assert(ctx != NULL);
-
+void xensiv_pas_gas_base_setup(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
     dev->ctx = ctx;
+    dev->retry = NULL;
+    dev->unique_id.len = 0U;
+#if XENSIV_PAS_GAS_ENABLE_STATS
+    dev->stats = NULL;
+#endif
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+    dev->trace = NULL;
+    dev->record = NULL;
+#endif
+#if XENSIV_PAS_GAS_DISPATCH_INTERFACE
     if (itf == XENSIV_PAS_GAS_INTERFACE_I2C) {
         dev->read = xensiv_pas_gas_i2c_read;
         dev->write = xensiv_pas_gas_i2c_write;
@@ -179,6 +265,53 @@ int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface
         dev->read = xensiv_pas_gas_uart_read;
         dev->write = xensiv_pas_gas_uart_write;
     }
+#elif XENSIV_PAS_GAS_ENABLE_I2C
+    xensiv_pas_gas_plat_assert(itf == XENSIV_PAS_GAS_INTERFACE_I2C);
+    (void)itf;
+#else
+    xensiv_pas_gas_plat_assert(itf == XENSIV_PAS_GAS_INTERFACE_UART);
+    (void)itf;
+#endif
+}
+
+/* Whether the registers can be accessed over the interface of the device */
+bool xensiv_pas_gas_base_reaches(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len) {
+#if XENSIV_PAS_GAS_DISPATCH_INTERFACE
+    return (dev->read != xensiv_pas_gas_uart_read) || xensiv_pas_gas_uart_reaches(reg_addr, len);
+#elif XENSIV_PAS_GAS_ENABLE_I2C
+    (void)dev;
+    (void)reg_addr;
+    (void)len;
+    return true;
+#else
+    (void)dev;
+    return xensiv_pas_gas_uart_reaches(reg_addr, len);
+#endif
+}
+
+int32_t xensiv_pas_gas_base_check_ready(uint8_t sens_sts) {
+    int32_t res;
+
+    if ((sens_sts & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U) {
+        res = XENSIV_PAS_GAS_ICCERR;
+    } else if ((sens_sts & XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK) != 0U) {
+        res = XENSIV_PAS_GAS_ORVS;
+    } else if ((sens_sts & XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK) != 0U) {
+        res = XENSIV_PAS_GAS_ORTMP;
+    } else if ((sens_sts & XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK) == 0U) {
+        res = XENSIV_PAS_GAS_ERR_NOT_READY;
+    } else {
+        res = XENSIV_PAS_GAS_OK;
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    xensiv_pas_gas_base_setup(dev, itf, ctx);
 
     /* Check communication */
     uint8_t data = XENSIV_PAS_GAS_COMM_TEST_VAL;
@@ -192,7 +325,7 @@ int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface
     if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_COMM_TEST_VAL == data)) {
         /* Soft reset */
         res = xensiv_pas_gas_cmd(dev, XENSIV_PAS_GAS_CMD_SOFT_RESET);
-        xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS);
+        xensiv_pas_gas_delay(dev, XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS);
 
         if (XENSIV_PAS_GAS_OK == res) {
             /* Read the sensor status and verify if the sensor is ready */
@@ -200,17 +333,7 @@ int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface
         }
 
         if (XENSIV_PAS_GAS_OK == res) {
-            if ((data & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U) {
-                res = XENSIV_PAS_GAS_ICCERR;
-            } else if ((data & XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK) != 0U) {
-                res = XENSIV_PAS_GAS_ORVS;
-            } else if ((data & XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK) != 0U) {
-                res = XENSIV_PAS_GAS_ORTMP;
-            } else if ((data & XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK) == 0U) {
-                res = XENSIV_PAS_GAS_ERR_NOT_READY;
-            } else {
-                res = XENSIV_PAS_GAS_OK;
-            }
+            res = xensiv_pas_gas_base_check_ready(data);
         }
     } else {
         res = XENSIV_PAS_GAS_ERR_COMM;
@@ -219,6 +342,56 @@ int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface
     return res;
 }
 
+int32_t xensiv_pas_gas_base_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    xensiv_pas_gas_base_setup(dev, itf, ctx);
+
+    /* Reading back the signature also verifies the communication */
+    uint8_t data;
+    int32_t res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_SCRATCH_PAD, &data, 1U);
+
+    if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_ATTACH_SIGNATURE == data)) {
+        res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, &data, 1U);
+    } else {
+        res = XENSIV_PAS_GAS_ERR_NOT_READY;
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        res = xensiv_pas_gas_base_check_ready(data);
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        /* Keep the running configuration if the measurement rate is valid for the variant */
+        uint8_t meas[2];
+        res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H, meas, 2U);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            uint16_t rate = (uint16_t)(((uint16_t)meas[0] << 8) | meas[1]);
+            if ((rate < dev->meas_rate_min) || (rate > XENSIV_PAS_GAS_MEAS_RATE_MAX)) {
+                res = XENSIV_PAS_GAS_ERR_NOT_READY;
+            }
+        }
+    }
+
+    if (warm != NULL) {
+        *warm = (XENSIV_PAS_GAS_OK == res);
+    }
+
+    if (XENSIV_PAS_GAS_OK != res) {
+        res = xensiv_pas_gas_base_init(dev, itf, ctx);
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_mark_configured(const xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    return xensiv_pas_gas_set_scratch_pad(dev, XENSIV_PAS_GAS_ATTACH_SIGNATURE);
+}
+
 int32_t xensiv_pas_gas_base_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
@@ -260,24 +433,148 @@ int32_t xensiv_pas_gas_base_perform_forced_compensation(const xensiv_pas_gas_t *
     return res;
 }
 
+/* Register access without the subsequent delay, also used by the non-blocking operations */
+int32_t xensiv_pas_gas_base_transfer(const xensiv_pas_gas_t *dev, bool write, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    xensiv_pas_gas_stats_op_t op = write ? XENSIV_PAS_GAS_STATS_OP_WRITE : XENSIV_PAS_GAS_STATS_OP_READ;
+    uint64_t start_us = xensiv_pas_gas_instr_start(dev);
+#if XENSIV_PAS_GAS_DISPATCH_INTERFACE
+    int32_t res = write ? dev->write(dev, reg_addr, data, len) : dev->read(dev, reg_addr, data, len);
+#elif XENSIV_PAS_GAS_ENABLE_I2C
+    int32_t res = write ? xensiv_pas_gas_i2c_write(dev, reg_addr, data, len) : xensiv_pas_gas_i2c_read(dev, reg_addr, data, len);
+#else
+    int32_t res = write ? xensiv_pas_gas_uart_write(dev, reg_addr, data, len) : xensiv_pas_gas_uart_read(dev, reg_addr, data, len);
+#endif
+    /* An access whose UART response is still awaited is recorded once it completed */
+    if (XENSIV_PAS_GAS_PENDING != res) {
+        xensiv_pas_gas_instr_access(dev, op, reg_addr, data, len, res, start_us);
+    }
+
+    return res;
+}
+
+static int32_t xensiv_pas_gas_access(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    int32_t res = xensiv_pas_gas_base_transfer(dev, XENSIV_PAS_GAS_STATS_OP_WRITE == op, reg_addr, data, len);
+    xensiv_pas_gas_delay(dev, XENSIV_PAS_GAS_COMM_DELAY_MS);
+
+    return res;
+}
+
+static inline bool xensiv_pas_gas_covers_reg(uint8_t reg_addr, uint8_t len, uint8_t reg) {
+    return (reg_addr <= reg) && ((reg_addr + len) > reg);
+}
+
+static inline bool xensiv_pas_gas_is_iccerr_read(xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, const uint8_t *data, uint8_t len) {
+    return (XENSIV_PAS_GAS_STATS_OP_READ == op) && xensiv_pas_gas_covers_reg(reg_addr, len, XENSIV_PAS_GAS_REG_SENS_STS) &&
+           ((data[XENSIV_PAS_GAS_REG_SENS_STS - reg_addr] & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U);
+}
+
+/* Writes which are checked for SENS_STS.ICCERR and written again if rejected; SENS_STS itself is written to clear it */
+static inline bool xensiv_pas_gas_is_checked_write(const xensiv_pas_gas_t *dev, xensiv_pas_gas_retry_safe_fptr_t is_safe, uint8_t reg_addr, uint8_t len) {
+    return !xensiv_pas_gas_covers_reg(reg_addr, len, XENSIV_PAS_GAS_REG_SENS_STS) && is_safe(dev, reg_addr, len, true);
+}
+
+/* Reads SENS_STS after a write; a failed read leaves the write as successful */
+static bool xensiv_pas_gas_is_write_rejected(const xensiv_pas_gas_t *dev) {
+    uint8_t sens_sts;
+
+    return (XENSIV_PAS_GAS_OK == xensiv_pas_gas_access(dev, XENSIV_PAS_GAS_STATS_OP_READ, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, &sens_sts, 1U)) &&
+           ((sens_sts & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U);
+}
+
+static int32_t xensiv_pas_gas_access_retry(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    const xensiv_pas_gas_retry_policy_t *policy = dev->retry;
+    int32_t res = xensiv_pas_gas_access(dev, op, reg_addr, data, len);
+
+    if (policy == NULL) {
+        return res;
+    }
+
+    xensiv_pas_gas_retry_safe_fptr_t is_safe = (policy->is_safe != NULL) ? policy->is_safe : xensiv_pas_gas_retry_is_safe_default;
+    uint32_t backoff_ms = policy->backoff_ms;
+
+    for (uint8_t attempt = 1U; attempt < policy->max_attempts; ++attempt)
+    {
+        if (XENSIV_PAS_GAS_OK == res) {
+            if (!policy->clear_iccerr) {
+                break;
+            }
+            if (XENSIV_PAS_GAS_STATS_OP_WRITE == op) {
+                /* A write rejected as an invalid command, e.g. after a corrupted frame, only shows in SENS_STS.ICCERR */
+                if (!xensiv_pas_gas_is_checked_write(dev, is_safe, reg_addr, len) || !xensiv_pas_gas_is_write_rejected(dev)) {
+                    break;
+                }
+            } else if (!xensiv_pas_gas_is_iccerr_read(op, reg_addr, data, len)) {
+                break;
+            }
+            /* The sensor flagged an invalid command, e.g. a corrupted frame of a previous access */
+            res = xensiv_pas_gas_clear_status(dev, XENSIV_PAS_GAS_REG_SENS_STS_ICCER_CLR_MSK);
+            if (XENSIV_PAS_GAS_OK != res) {
+                break;
+            }
+        } else {
+            if (((res < 0) || (res >= 32) || ((policy->retryable & XENSIV_PAS_GAS_RETRY_MASK(res)) == 0U)) ||
+                !is_safe(dev, reg_addr, len, XENSIV_PAS_GAS_STATS_OP_WRITE == op)) {
+                break;
+            }
+            if (backoff_ms > 0U) {
+                xensiv_pas_gas_delay(dev, backoff_ms);
+                backoff_ms *= policy->backoff_multiplier;
+                if (backoff_ms > policy->backoff_max_ms) {
+                    backoff_ms = policy->backoff_max_ms;
+                }
+            }
+        }
+
+        xensiv_pas_gas_stats_record_retry(dev);
+        res = xensiv_pas_gas_access(dev, op, reg_addr, data, len);
+    }
+
+    return res;
+}
+
+void xensiv_pas_gas_set_retry_policy(xensiv_pas_gas_t *dev, const xensiv_pas_gas_retry_policy_t *policy) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    dev->retry = policy;
+}
+
+void xensiv_pas_gas_get_default_retry_policy(xensiv_pas_gas_retry_policy_t *policy) {
+    xensiv_pas_gas_plat_assert(policy != NULL);
+
+    policy->max_attempts = XENSIV_PAS_GAS_RETRY_MAX_ATTEMPTS;
+    policy->backoff_ms = XENSIV_PAS_GAS_RETRY_BACKOFF_MS;
+    policy->backoff_multiplier = XENSIV_PAS_GAS_RETRY_BACKOFF_MULTIPLIER;
+    policy->backoff_max_ms = XENSIV_PAS_GAS_RETRY_BACKOFF_MAX_MS;
+    policy->retryable = XENSIV_PAS_GAS_RETRY_MASK(XENSIV_PAS_GAS_ERR_COMM);
+    policy->clear_iccerr = false;
+    policy->is_safe = NULL;
+}
+
+bool xensiv_pas_gas_retry_is_safe_default(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len, bool write) {
+    (void)dev;
+
+    if (write) {
+        /* Commands and non-volatile memory writes must not be executed twice */
+        return !xensiv_pas_gas_covers_reg(reg_addr, len, XENSIV_PAS_GAS_REG_SENS_RST) &&
+               !xensiv_pas_gas_covers_reg(reg_addr, len, XENSIV_PAS_GAS_A2L_REG_CFG_SAVE);
+    }
+
+    /* Reading MEAS_STS clears DRDY, repeating it after a lost response would hide a new measurement result */
+    return !xensiv_pas_gas_covers_reg(reg_addr, len, XENSIV_PAS_GAS_REG_MEAS_STS);
+}
+
 int32_t xensiv_pas_gas_set_reg(const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(data != NULL);
 
-    int32_t res = dev->write(dev, reg_addr, data, len);
-    xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_COMM_DELAY_MS);
-
-    return res;
+    return xensiv_pas_gas_access_retry(dev, XENSIV_PAS_GAS_STATS_OP_WRITE, reg_addr, (uint8_t *)data, len);
 }
 
 int32_t xensiv_pas_gas_get_reg(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(data != NULL);
 
-    int32_t res = dev->read(dev, reg_addr, data, len);
-    xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_COMM_DELAY_MS);
-
-    return res;
+    return xensiv_pas_gas_access_retry(dev, XENSIV_PAS_GAS_STATS_OP_READ, reg_addr, data, len);
 }
 
 int32_t xensiv_pas_gas_get_id(const xensiv_pas_gas_t *dev, xensiv_pas_gas_id_t *id) {
@@ -458,5 +755,11 @@ int32_t xensiv_pas_gas_start_continuous_mode(const xensiv_pas_gas_t *dev, uint16
 int32_t xensiv_pas_gas_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
+#if XENSIV_PAS_GAS_DISPATCH_FCS
     return dev->force_comp(dev, gas_ref);
+#elif XENSIV_PAS_GAS_ENABLE_CO2
+    return xensiv_pas_gas_co2_perform_forced_compensation(dev, gas_ref);
+#else
+    return xensiv_pas_gas_base_perform_forced_compensation(dev, gas_ref);
+#endif
 }
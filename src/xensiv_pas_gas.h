@@ -44,11 +44,72 @@
  * - \ref xensiv_pas_gas_plat_delay implementation must be provided that delays the processing for a certain number of milliseconds.
  * - \ref xensiv_pas_gas_plat_htons implementation must be provided for byte reversing.
  * - \ref xensiv_pas_gas_plat_assert implementation must be provided for runtime assertion.
+ * - \ref xensiv_pas_gas_plat_get_time_us implementation must be provided when XENSIV_PAS_GAS_ENABLE_STATS or XENSIV_PAS_GAS_ENABLE_TRACE is set,
+ *   and when using the bus recording, the sample broadcast or the coroutine executor.
+ * - \ref xensiv_pas_gas_plat_pwm_capture implementation must be provided when using the CO2 PWM decoder.
+ *
+ * The communication interfaces and sensor variants compiled into the driver are selected with
+ * XENSIV_PAS_GAS_ENABLE_I2C, XENSIV_PAS_GAS_ENABLE_UART, XENSIV_PAS_GAS_ENABLE_CO2, XENSIV_PAS_GAS_ENABLE_R290
+ * and XENSIV_PAS_GAS_ENABLE_A2L, all set by default. With a single interface, the register accesses call the
+ * I2C or UART functions directly instead of through the read and write pointers of the device, and with a
+ * single forced compensation procedure the same applies to \ref xensiv_pas_gas_perform_forced_compensation.
+ * The code of the disabled interfaces and variants, including the A2L humidity compensation feed and
+ * multi-gas scheduler, is left out. The macros must be identical for the driver and the application,
+ * since they change the layout of \ref xensiv_pas_gas_t.
  *
  */
 
 /************************************** Macros *******************************************/
 
+#ifndef XENSIV_PAS_GAS_ENABLE_STATS
+/** Set to 1 to collect per-device communication statistics, see \ref group_board_libs_stats */
+#define XENSIV_PAS_GAS_ENABLE_STATS              (0)
+#endif
+
+#ifndef XENSIV_PAS_GAS_ENABLE_TRACE
+/** Set to 1 to record the bus transfers into a trace ring or a bus recording, see \ref group_board_libs_trace and \ref group_board_libs_record */
+#define XENSIV_PAS_GAS_ENABLE_TRACE              (0)
+#endif
+
+#ifndef XENSIV_PAS_GAS_ENABLE_I2C
+/** Set to 0 to leave out the I2C interface */
+#define XENSIV_PAS_GAS_ENABLE_I2C                (1)
+#endif
+
+#ifndef XENSIV_PAS_GAS_ENABLE_UART
+/** Set to 0 to leave out the UART interface */
+#define XENSIV_PAS_GAS_ENABLE_UART               (1)
+#endif
+
+#ifndef XENSIV_PAS_GAS_ENABLE_CO2
+/** Set to 0 to leave out the XENSIV™ PAS CO2 variant */
+#define XENSIV_PAS_GAS_ENABLE_CO2                (1)
+#endif
+
+#ifndef XENSIV_PAS_GAS_ENABLE_R290
+/** Set to 0 to leave out the XENSIV™ PAS R290 variant */
+#define XENSIV_PAS_GAS_ENABLE_R290               (1)
+#endif
+
+#ifndef XENSIV_PAS_GAS_ENABLE_A2L
+/** Set to 0 to leave out the XENSIV™ PAS A2L variant */
+#define XENSIV_PAS_GAS_ENABLE_A2L                (1)
+#endif
+
+#if !XENSIV_PAS_GAS_ENABLE_I2C && !XENSIV_PAS_GAS_ENABLE_UART
+#error "At least one of XENSIV_PAS_GAS_ENABLE_I2C and XENSIV_PAS_GAS_ENABLE_UART must be set"
+#endif
+
+#if !XENSIV_PAS_GAS_ENABLE_CO2 && !XENSIV_PAS_GAS_ENABLE_R290 && !XENSIV_PAS_GAS_ENABLE_A2L
+#error "At least one of XENSIV_PAS_GAS_ENABLE_CO2, XENSIV_PAS_GAS_ENABLE_R290 and XENSIV_PAS_GAS_ENABLE_A2L must be set"
+#endif
+
+/** The register accesses are dispatched at runtime between the I2C and UART interfaces */
+#define XENSIV_PAS_GAS_DISPATCH_INTERFACE        (XENSIV_PAS_GAS_ENABLE_I2C && XENSIV_PAS_GAS_ENABLE_UART)
+
+/** The forced compensation is dispatched at runtime between the CO2 and the R290/A2L procedures */
+#define XENSIV_PAS_GAS_DISPATCH_FCS              (XENSIV_PAS_GAS_ENABLE_CO2 && (XENSIV_PAS_GAS_ENABLE_R290 || XENSIV_PAS_GAS_ENABLE_A2L))
+
 /** Result code indicating a successful operation */
 #define XENSIV_PAS_GAS_OK                        (0)
 /** Result code indicating a communication error */
@@ -69,6 +130,12 @@
 #define XENSIV_PAS_GAS_INVALID_SENSOR_INTERFACE  (8)
 /**< Result code indicating that an invalid parameter was passed to a function */
 #define XENSIV_PAS_GAS_INVALID_PARAMETER         (9)
+/** Result code indicating that a non-blocking operation is still in progress, see \ref group_board_libs_async */
+#define XENSIV_PAS_GAS_PENDING                   (10)
+/** Result code indicating that a reader of the sample broadcast fell behind and samples were lost, see \ref group_board_libs_shm */
+#define XENSIV_PAS_GAS_OVERRUN                   (11)
+/** Result code indicating that a forced compensation did not complete in time, see \ref group_board_libs_async */
+#define XENSIV_PAS_GAS_TIMEOUT                   (12)
 
 /** Minimum allowed measurement rate */
 #define XENSIV_PAS_GAS_MEAS_RATE_MIN             (5U)
@@ -76,9 +143,24 @@
 /** Maximum allowed measurement rate */
 #define XENSIV_PAS_GAS_MEAS_RATE_MAX             (4095U)
 
+/** Time in milliseconds the driver waits after each register access */
+#define XENSIV_PAS_GAS_COMM_DELAY_MS             (5U)
+
+/** Time in milliseconds the driver waits after a soft reset */
+#define XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS       (2000U)
+
 /** I2C address of the XENSIV™ PASGAS sensor */
 #define XENSIV_PAS_GAS_I2C_ADDR                  (0x28U)
 
+/** Value left in the SCRATCH_PAD register by \ref xensiv_pas_gas_mark_configured, the scratch pad must not be used otherwise by the application */
+#define XENSIV_PAS_GAS_ATTACH_SIGNATURE          (0x5AU)
+
+/** Maximum length of the unique device ID, see \ref xensiv_pas_gas_unique_id_t */
+#define XENSIV_PAS_GAS_UNIQUE_ID_MAX_LEN         (8U)
+
+/** Bit of a result code in \ref xensiv_pas_gas_retry_policy_t::retryable */
+#define XENSIV_PAS_GAS_RETRY_MASK(res)           (1UL << (uint32_t)(res))
+
 /********************************* Type definitions **************************************/
 
 /** Enum defining the different comm. interfaces */
@@ -88,6 +170,15 @@ typedef enum
     XENSIV_PAS_GAS_INTERFACE_UART = 1U                  /**< UART interface */
 } xensiv_pas_gas_interface_t;
 
+/** Enum defining the different sensor variants of the XENSIV™ PAS GAS family */
+typedef enum
+{
+    XENSIV_PAS_GAS_VARIANT_BASE = 0U,                   /**< Common register map only */
+    XENSIV_PAS_GAS_VARIANT_CO2 = 1U,                    /**< XENSIV™ PAS CO2 sensor */
+    XENSIV_PAS_GAS_VARIANT_R290 = 2U,                   /**< XENSIV™ PAS R290 sensor */
+    XENSIV_PAS_GAS_VARIANT_A2L = 3U                     /**< XENSIV™ PAS A2L sensor */
+} xensiv_pas_gas_variant_t;
+
 /** Enum defining the different device commands */
 typedef enum
 {
@@ -148,6 +239,13 @@ typedef union
     uint8_t u;                                          /*!< Type used for byte access */
 } xensiv_pas_gas_id_t;
 
+/** Unique device ID assembled from the DEV_ID register of the R290 and A2L variants */
+typedef struct
+{
+    uint8_t len;                                        /*!< Number of valid bytes; 0 if the ID has not been read */
+    uint8_t id[XENSIV_PAS_GAS_UNIQUE_ID_MAX_LEN];       /*!< ID bytes, in DEV_ID_IDX order */
+} xensiv_pas_gas_unique_id_t;
+
 /** Structure of the sensor's status register (SENS_STS) */
 typedef union
 {
@@ -203,6 +301,8 @@ typedef union
 } xensiv_pas_gas_meas_status_t;
 
 struct xensiv_pas_gas_s;                                /* Forward declaration */
+struct xensiv_pas_gas_stats_s;                          /* Forward declaration */
+struct xensiv_pas_gas_trace_s;                          /* Forward declaration */
 
 /* Function pointer to the platform-specific forced compensation function */
 typedef int32_t (*xensiv_pas_gas_fcs_fptr_t)(const struct xensiv_pas_gas_s *dev, uint16_t gas_ref);
@@ -213,17 +313,57 @@ typedef int32_t (*xensiv_pas_gas_read_fptr_t)(const struct xensiv_pas_gas_s *dev
 /* Function pointer to the platform-specific function for writing  the sensor registers via I2C/UART */
 typedef int32_t (*xensiv_pas_gas_write_fptr_t)(const struct xensiv_pas_gas_s *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len);
 
+/**
+ * Function pointer deciding whether a failed register access can be issued again
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] reg_addr Start register address
+ * @param[in] len Number of bytes accessed
+ * @param[in] write True for a register write, false for a register read
+ * @return True if issuing the access twice has no side effect
+ */
+typedef bool (*xensiv_pas_gas_retry_safe_fptr_t)(const struct xensiv_pas_gas_s *dev, uint8_t reg_addr, uint8_t len, bool write);
+
+/** Retry policy applied by \ref xensiv_pas_gas_set_reg and \ref xensiv_pas_gas_get_reg to transient communication errors */
+typedef struct
+{
+    uint8_t max_attempts;                   /*!< Maximum number of attempts per register access, including the first one */
+    uint16_t backoff_ms;                    /*!< Delay before the first retry */
+    uint8_t backoff_multiplier;             /*!< Factor applied to the delay after each retry; 1 for a constant delay */
+    uint16_t backoff_max_ms;                /*!< Upper limit of the delay between retries */
+    uint32_t retryable;                     /*!< ORed \ref XENSIV_PAS_GAS_RETRY_MASK of the result codes to retry */
+    bool clear_iccerr;                      /*!< Clear a SENS_STS.ICCERR flag read from the sensor and read SENS_STS again, instead of returning it;
+                                                 read SENS_STS after each write which may be repeated and, if ICCERR is set, clear it and write again.
+                                                 Off by default, since the SENS_STS read doubles the bus traffic of the writes */
+    xensiv_pas_gas_retry_safe_fptr_t is_safe;   /*!< Registers which may be accessed again; NULL to use \ref xensiv_pas_gas_retry_is_safe_default */
+} xensiv_pas_gas_retry_policy_t;
+
 /** Structure of the XENSIV™ PAS GAS sensor device. Initialized using \ref xensiv_pas_gas_init_i2c or \ref xensiv_pas_gas_init_uart */
 typedef struct xensiv_pas_gas_s
 {
     uint8_t meas_rate_min;                  /*!< Minimum measurement rate in seconds */
     uint8_t fcs_meas_rate_s;                /*!< Measurement rate in seconds required for forced calibration */
+#if XENSIV_PAS_GAS_DISPATCH_FCS
     xensiv_pas_gas_fcs_fptr_t force_comp;   /*!< Pointer to the perform forced compensation function */
+#endif
+    xensiv_pas_gas_variant_t variant;       /*!< Sensor variant, set by the initialization functions */
 
     void *ctx;                           /*!< Context for I2C/UART platform-specific read and write functions */
+#if XENSIV_PAS_GAS_DISPATCH_INTERFACE
     xensiv_pas_gas_read_fptr_t read;     /*!< Pointer to the register read function which depends on the communication interface used */
     xensiv_pas_gas_write_fptr_t write;   /*!< Pointer to the register write function which depends on the communication interface used */
+#endif
+    const xensiv_pas_gas_retry_policy_t *retry;    /*!< Retry policy, see \ref xensiv_pas_gas_set_retry_policy */
+    xensiv_pas_gas_unique_id_t unique_id;   /*!< Unique device ID cached by \ref xensiv_pas_gas_a2l_get_unique_id and \ref xensiv_pas_gas_r290_get_unique_id */
 
+#if XENSIV_PAS_GAS_ENABLE_STATS
+    struct xensiv_pas_gas_stats_s *stats;   /*!< Communication statistics, see \ref xensiv_pas_gas_stats_attach */
+#endif
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+    struct xensiv_pas_gas_trace_s *trace;   /*!< Bus trace ring, see \ref xensiv_pas_gas_trace_attach */
+    uint16_t trace_track;                   /*!< Track of the device in the bus trace */
+    struct xensiv_pas_gas_record_s *record; /*!< Bus recording, see \ref xensiv_pas_gas_record_attach */
+    uint16_t record_track;                  /*!< Track of the device in the bus recording */
+#endif
 } xensiv_pas_gas_t;
 
 /******************************* Function prototypes *************************************/
@@ -252,7 +392,8 @@ int32_t xensiv_pas_gas_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t it
  * @param[in] reg_addr Start register address
  * @param[in] data Pointer to the data buffer to be written in the sensor
  * @param[in] len Number of bytes of data to be written
- * @return XENSIV_PAS_GAS_OK if writing to the register was successful; an error indicating what went wrong otherwise
+ * @return XENSIV_PAS_GAS_OK if writing to the register was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if a register
+ * beyond SENS_RST is accessed over UART; an error indicating what went wrong otherwise
  */
 int32_t xensiv_pas_gas_set_reg(const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len);
 
@@ -264,10 +405,44 @@ int32_t xensiv_pas_gas_set_reg(const xensiv_pas_gas_t *dev, uint8_t reg_addr, co
  * @param[in] reg_addr Start register address
  * @param[out] data Pointer to the data buffer to store the register values of the sensor
  * @param[in] len Number of bytes of data to be read
- * @return XENSIV_PAS_GAS_OK if reading from the register was successful; an error indicating what went wrong otherwise
+ * @return XENSIV_PAS_GAS_OK if reading from the register was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if a register
+ * beyond SENS_RST is accessed over UART; an error indicating what went wrong otherwise
  */
 int32_t xensiv_pas_gas_get_reg(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len);
 
+/**
+ * @brief Sets the retry policy of the sensor device.
+ * Failed register accesses are issued again by \ref xensiv_pas_gas_set_reg and \ref xensiv_pas_gas_get_reg
+ * according to the policy, which avoids reinitializing the sensor after a transient error.
+ * @note The sensor initialization functions reset the retry policy, set it after the initialization
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] policy Retry policy, which must stay valid while it is set; NULL to disable retries
+ */
+void xensiv_pas_gas_set_retry_policy(xensiv_pas_gas_t *dev, const xensiv_pas_gas_retry_policy_t *policy);
+
+/**
+ * @brief Gets the default retry policy.
+ * Three attempts with a backoff of 10 ms doubled after each retry, for XENSIV_PAS_GAS_ERR_COMM, clearing ICCERR
+ * and writing again the writes the sensor flagged with it.
+ *
+ * @param[out] policy Pointer to populate with the default retry policy
+ */
+void xensiv_pas_gas_get_default_retry_policy(xensiv_pas_gas_retry_policy_t *policy);
+
+/**
+ * @brief Default decision whether a failed register access can be issued again.
+ * Writes to SENS_RST (commands) and to the A2L CFG_SAVE register (non-volatile memory write), and reads
+ * of MEAS_STS (DRDY is cleared on read) are not issued again.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] reg_addr Start register address
+ * @param[in] len Number of bytes accessed
+ * @param[in] write True for a register write, false for a register read
+ * @return True if the access can be issued again
+ */
+bool xensiv_pas_gas_retry_is_safe_default(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len, bool write);
+
 /**
  * @brief Gets the sensor device product and version ID
  *
@@ -427,6 +602,17 @@ int32_t xensiv_pas_gas_set_scratch_pad(const xensiv_pas_gas_t *dev, uint8_t val)
  */
 int32_t xensiv_pas_gas_get_scratch_pad(const xensiv_pas_gas_t *dev, uint8_t *val);
 
+/**
+ * @brief Marks the sensor as configured by the application.
+ * Writes \ref XENSIV_PAS_GAS_ATTACH_SIGNATURE to the scratch pad so that the attach functions, e.g. \ref xensiv_pas_gas_co2_attach,
+ * keep the running configuration instead of resetting the sensor. Call it once the configuration of the sensor is complete.
+ * The signature is lost on a soft reset or power cycle of the sensor.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @return XENSIV_PAS_GAS_OK if writing the signature was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_mark_configured(const xensiv_pas_gas_t *dev);
+
 /**
  * @brief Triggers a sensor device command
  *
@@ -23,12 +23,16 @@
  **************************************************************************************************/
 #include "xensiv_pas_gas_a2l.h"
 
+#if XENSIV_PAS_GAS_ENABLE_A2L
+
 /** Usage of the default functionalities from base class */
 extern int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
+extern int32_t xensiv_pas_gas_base_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm);
 extern int32_t xensiv_pas_gas_base_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref);
+extern void xensiv_pas_gas_base_delay(const xensiv_pas_gas_t *dev, uint32_t ms);
 
 
-int32_t xenisv_pas_gas_a2l_set_dev_idx(const xensiv_pas_gas_t *dev, uint8_t dev_idx) {
+int32_t xensiv_pas_gas_a2l_set_dev_idx(const xensiv_pas_gas_t *dev, uint8_t dev_idx) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
     return xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX, (uint8_t *)&dev_idx, 1U);
@@ -48,6 +52,45 @@ int32_t xensiv_pas_gas_a2l_get_device_id(const xensiv_pas_gas_t *dev, void *dev_
     return xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_DEV_ID, (uint8_t *)dev_id, 1U);
 }
 
+int32_t xensiv_pas_gas_a2l_get_unique_id(xensiv_pas_gas_t *dev, xensiv_pas_gas_unique_id_t *id) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(id != NULL);
+
+    if (dev->unique_id.len == XENSIV_PAS_GAS_A2L_UNIQUE_ID_LEN) {
+        *id = dev->unique_id;
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    xensiv_pas_gas_unique_id_t uid = { .len = 0U };
+
+    /* DEV_ID_IDX and DEV_ID are contiguous: the byte at the current index comes along with the index */
+    uint8_t buf[2];
+    int32_t res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX, buf, 2U);
+    uint8_t known = buf[0];
+
+    if ((XENSIV_PAS_GAS_OK == res) && (known < XENSIV_PAS_GAS_A2L_UNIQUE_ID_LEN)) {
+        uid.id[known] = buf[1];
+    }
+
+    for (uint8_t idx = 0U; (XENSIV_PAS_GAS_OK == res) && (idx < XENSIV_PAS_GAS_A2L_UNIQUE_ID_LEN); ++idx)
+    {
+        if (idx != known) {
+            res = xensiv_pas_gas_a2l_set_dev_idx(dev, idx);
+            if (XENSIV_PAS_GAS_OK == res) {
+                res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_DEV_ID, &uid.id[idx], 1U);
+            }
+        }
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        uid.len = XENSIV_PAS_GAS_A2L_UNIQUE_ID_LEN;
+        dev->unique_id = uid;
+        *id = uid;
+    }
+
+    return res;
+}
+
 int32_t xensiv_pas_gas_a2l_aboc_prefill(const xensiv_pas_gas_t *dev, uint8_t prefill) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
@@ -175,29 +218,28 @@ int32_t xensiv_pas_gas_a2l_get_alarm_hysteresis(const xensiv_pas_gas_t *dev, uin
 int32_t xensiv_pas_gas_a2l_set_absolute_humidity_ref(const xensiv_pas_gas_t *dev, uint16_t abs_hum_ref) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
-    // Only 10 bits are valid
-    abs_hum_ref &= 0x03FF;
+    if (abs_hum_ref > XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
 
-    // Prepare register values
+    // Prepare register values, ABS_HUM_REF_H and ABS_HUM_REF_L are written in a single burst
     uint8_t reg_h = (uint8_t)((abs_hum_ref >> 8) & 0x03); // bits 1:0
     uint8_t reg_l = (uint8_t)(abs_hum_ref & 0xFF);        // bits 7:0
-    int32_t ret = xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H, &reg_h, 1U);
-    if (ret == 0) {
-        ret = xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_L, &reg_l, 1U);
-    }
+    uint8_t buf[2] = {reg_h, reg_l};
+
+    int32_t ret = xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H, buf, 2U);
     return ret;
 }
 
-int32_t  xensiv_pas_gas_a2l_get_absolute_humidity_ref(const xensiv_pas_gas_t *dev, uint16_t *abs_hum_ref) {
+int32_t xensiv_pas_gas_a2l_get_absolute_humidity_ref(const xensiv_pas_gas_t *dev, uint16_t *abs_hum_ref) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(abs_hum_ref != NULL);
 
-    uint8_t reg_h = 0, reg_l = 0;
-    int32_t ret = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H, &reg_h, 1U);
-    if (ret == 0) {
-        ret = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_L, &reg_l, 1U);
-    }
-    *abs_hum_ref = (((uint16_t)(reg_h & 0x03)) << 8) | reg_l;
+    uint8_t buf[2] = {0};
+    int32_t ret = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H, buf, 2U);
+
+    // Only 2 bits from H, 8 bits from L
+    *abs_hum_ref = (((uint16_t)(buf[0] & 0x03)) << 8) | buf[1];
     return ret;
 }
 
@@ -214,13 +256,45 @@ int32_t xensiv_pas_gas_a2l_get_humidity_control(const xensiv_pas_gas_t *dev, xen
     return xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_HC_CTRL, &(hum_control->u), 1U);
 }
 
-int32_t xensiv_pas_gas_a2l_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
+int32_t xensiv_pas_gas_a2l_save_config(const xensiv_pas_gas_t *dev) {
     xensiv_pas_gas_plat_assert(dev != NULL);
-    xensiv_pas_gas_plat_assert(ctx != NULL);
 
+    uint8_t val = (uint8_t)XENSIV_PAS_GAS_A2L_REG_CFG_SAVE_VAL_MASK;
+    int32_t res = xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_CFG_SAVE, &val, 1U);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        /* The sensor does not respond while writing its non-volatile memory */
+        xensiv_pas_gas_base_delay(dev, XENSIV_PAS_GAS_A2L_CFG_SAVE_DELAY_MS);
+    }
+
+    return res;
+}
+
+void xensiv_pas_gas_a2l_setup(xensiv_pas_gas_t *dev) {
+    dev->variant = XENSIV_PAS_GAS_VARIANT_A2L;
     dev->fcs_meas_rate_s = XENSIV_PAS_GAS_A2L_FCS_MEAS_RATE_S;
     dev->meas_rate_min = XENSIV_PAS_GAS_A2L_MEAS_RATE_MIN;
+#if XENSIV_PAS_GAS_DISPATCH_FCS
     dev->force_comp = xensiv_pas_gas_base_perform_forced_compensation;
+#endif
+}
+
+int32_t xensiv_pas_gas_a2l_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    xensiv_pas_gas_a2l_setup(dev);
 
     return xensiv_pas_gas_base_init(dev, itf, ctx);
 }
+
+int32_t xensiv_pas_gas_a2l_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    xensiv_pas_gas_a2l_setup(dev);
+
+    return xensiv_pas_gas_base_attach(dev, itf, ctx, warm);
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_A2L */
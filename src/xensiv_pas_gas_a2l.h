@@ -40,6 +40,14 @@
 #define XENSIV_PAS_GAS_A2L_MEAS_RATE_MIN            (3U)
 #define XENSIV_PAS_GAS_A2L_FCS_MEAS_RATE_S          (3U)
 
+/** Time in milliseconds the sensor needs to write its non-volatile memory after a CFG_SAVE */
+#define XENSIV_PAS_GAS_A2L_CFG_SAVE_DELAY_MS        (50U)
+
+/** Length of the unique device ID, read byte by byte through DEV_ID_IDX */
+#define XENSIV_PAS_GAS_A2L_UNIQUE_ID_LEN            (8U)
+
+/** Largest absolute humidity reference in g/m³ accepted by the sensor, below the 10-bit limit of ABS_HUM_REF */
+#define XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX          (500U)
 
 /********************************* Type definitions **************************************/
 
@@ -182,6 +190,21 @@ extern "C" {
  */
 int32_t xensiv_pas_gas_a2l_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
 
+/**
+ * @brief Attaches to a XENSIV™ PAS GAS A2L device which may already be configured by a previous session.
+ * If the scratch pad holds \ref XENSIV_PAS_GAS_ATTACH_SIGNATURE, the sensor is ready without error flags and the measurement rate is valid,
+ * the sensor is attached without a soft reset and keeps running with its measurement configuration, rate and ABOC state.
+ * Otherwise the sensor is initialized as done by \ref xensiv_pas_gas_a2l_init.
+ *
+ * @param[in out] dev Pointer to a XENSIV™ PAS GAS A2L sensor device structure allocated by the user,
+ * but the attach function will initialize its contents
+ * @param[in] itf Communication interface (I2C/UART)
+ * @param[in] ctx Pointer to the platform-specific specific protocol communication handler
+ * @param[out] warm Optional pointer to populate with true if the sensor was attached without a soft reset; NULL if not needed
+ * @return XENSIV_PAS_GAS_OK if the attach or the initialization was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_a2l_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm);
+
 /**
  * @brief Gets the device index.
  *
@@ -209,6 +232,18 @@ int32_t xensiv_pas_gas_a2l_set_dev_idx(const xensiv_pas_gas_t *dev, uint8_t dev_
  */
 int32_t xensiv_pas_gas_a2l_get_device_id(const xensiv_pas_gas_t *dev, void *dev_id);
 
+/**
+ * @brief Reads the complete unique device ID by walking DEV_ID_IDX.
+ * The ID is cached in the device structure after the first successful read, later calls do not access the bus.
+ * The first read takes 2 * \ref XENSIV_PAS_GAS_A2L_UNIQUE_ID_LEN - 1 register accesses and leaves DEV_ID_IDX at the last index.
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS A2L sensor device structure
+ * @param[out] id Pointer to populate with the unique device ID
+ * @return XENSIV_PAS_GAS_OK if the read was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if the sensor is connected over
+ * UART, which does not reach DEV_ID; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_a2l_get_unique_id(xensiv_pas_gas_t *dev, xensiv_pas_gas_unique_id_t *id);
+
 /**
  * @brief Configures the ABOC prefill value.
  *
@@ -347,8 +382,9 @@ int32_t xensiv_pas_gas_a2l_get_alarm_hysteresis(const xensiv_pas_gas_t *dev, uin
  * @brief Sets the absolute humidity reference value for humidity compensation.
  *
  * @param[in] dev Pointer to a XENSIV™ PAS GAS A2L sensor device structure
- * @param[in] abs_hum_ref New absolute humidity reference value to apply [0-500 g/m³]
- * @return XENSIV_PAS_GAS_OK if the configuration was successful; an error indicating what went wrong otherwise
+ * @param[in] abs_hum_ref New absolute humidity reference value to apply [0-\ref XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX g/m³]
+ * @return XENSIV_PAS_GAS_OK if the configuration was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if abs_hum_ref is
+ * out of range, nothing is written then; an error indicating what went wrong otherwise
  */
 int32_t xensiv_pas_gas_a2l_set_absolute_humidity_ref(const xensiv_pas_gas_t *dev, uint16_t abs_hum_ref);
 
@@ -379,6 +415,17 @@ int32_t xensiv_pas_gas_a2l_set_humidity_control(const xensiv_pas_gas_t *dev, xen
  */
 int32_t xensiv_pas_gas_a2l_get_humidity_control(const xensiv_pas_gas_t *dev, xensiv_pas_gas_a2l_humidity_control_t *hc_control);
 
+/**
+ * @brief Saves the current configuration into the non-volatile memory of the sensor.
+ * The saved configuration is restored by the sensor after a power cycle or soft reset, the sensor always starts in idle mode.
+ * The function waits until the sensor responds again after writing its non-volatile memory.
+ * @note The number of non-volatile memory write cycles is limited, only save after a configuration change
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS A2L sensor device structure
+ * @return XENSIV_PAS_GAS_OK if the save was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_a2l_save_config(const xensiv_pas_gas_t *dev);
+
 #ifdef __cplusplus
 }
 #endif
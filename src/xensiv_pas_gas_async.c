@@ -0,0 +1,428 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_async.c
+ *
+ * Description: This file contains the non-blocking operations of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_async.h"
+#include "xensiv_pas_gas_co2.h"
+#include "xensiv_pas_gas_stats.h"
+
+extern void xensiv_pas_gas_base_setup(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
+extern int32_t xensiv_pas_gas_base_check_ready(uint8_t sens_sts);
+extern int32_t xensiv_pas_gas_base_transfer(const xensiv_pas_gas_t *dev, bool write, uint8_t reg_addr, uint8_t *data, uint8_t len);
+extern void xensiv_pas_gas_co2_setup(xensiv_pas_gas_t *dev);
+extern void xensiv_pas_gas_r290_setup(xensiv_pas_gas_t *dev);
+extern void xensiv_pas_gas_a2l_setup(xensiv_pas_gas_t *dev);
+
+#define XENSIV_PAS_GAS_ASYNC_COMM_TEST_VAL       (0xA5U)
+#define XENSIV_PAS_GAS_ASYNC_US_PER_MS           (1000U)
+#define XENSIV_PAS_GAS_ASYNC_US_PER_S            (1000000UL)
+
+/* The platform awaits the UART response of the access, the step is repeated */
+#define XENSIV_PAS_GAS_ASYNC_AWAIT               (-1)
+
+/* Operations */
+#define XENSIV_PAS_GAS_ASYNC_OP_INIT             (0U)
+#define XENSIV_PAS_GAS_ASYNC_OP_READ_RESULT      (1U)
+#define XENSIV_PAS_GAS_ASYNC_OP_FCS              (2U)
+#define XENSIV_PAS_GAS_ASYNC_OP_REG              (3U)
+
+static void xensiv_pas_gas_async_start(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint8_t kind) {
+    op->dev = dev;
+    op->kind = kind;
+    op->state = 0U;
+    op->res = XENSIV_PAS_GAS_PENDING;
+    op->done = false;
+    op->due_us = 0U;
+}
+
+/* Issues a register access at the next step */
+static void xensiv_pas_gas_async_access(xensiv_pas_gas_async_t *op, bool write, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    op->write = write;
+    op->reg_addr = reg_addr;
+    op->data = data;
+    op->len = len;
+    op->attempt = 0U;
+    op->backoff_ms = (op->dev->retry != NULL) ? op->dev->retry->backoff_ms : 0U;
+    op->clear_iccerr = false;
+    op->check_write = false;
+}
+
+/* Completes the operation at the next step, once the delay following the last access has elapsed */
+static void xensiv_pas_gas_async_finish(xensiv_pas_gas_async_t *op, int32_t res) {
+    op->res = res;
+    op->done = true;
+}
+
+static void xensiv_pas_gas_async_wait(xensiv_pas_gas_async_t *op, uint32_t ms) {
+    op->due_us += (uint64_t)ms * XENSIV_PAS_GAS_ASYNC_US_PER_MS;
+}
+
+static inline bool xensiv_pas_gas_async_covers_sens_sts(const xensiv_pas_gas_async_t *op) {
+    return (op->reg_addr <= XENSIV_PAS_GAS_REG_SENS_STS) && ((op->reg_addr + op->len) > XENSIV_PAS_GAS_REG_SENS_STS);
+}
+
+/* Performs one transfer of the access in progress, applying the retry policy as xensiv_pas_gas_get_reg and
+ * xensiv_pas_gas_set_reg do; XENSIV_PAS_GAS_PENDING if the access is issued again, XENSIV_PAS_GAS_ASYNC_AWAIT
+ * if the platform has not received the UART response yet */
+static int32_t xensiv_pas_gas_async_transfer(xensiv_pas_gas_async_t *op, uint64_t time_us) {
+    const xensiv_pas_gas_t *dev = op->dev;
+    const xensiv_pas_gas_retry_policy_t *policy = dev->retry;
+    int32_t res;
+
+    op->due_us = time_us + ((uint64_t)XENSIV_PAS_GAS_COMM_DELAY_MS * XENSIV_PAS_GAS_ASYNC_US_PER_MS);
+
+    if (op->clear_iccerr) {
+        uint8_t mask = XENSIV_PAS_GAS_REG_SENS_STS_ICCER_CLR_MSK;
+        op->clear_iccerr = false;
+        res = xensiv_pas_gas_base_transfer(dev, true, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, &mask, 1U);
+        if (XENSIV_PAS_GAS_PENDING == res) {
+            return XENSIV_PAS_GAS_ASYNC_AWAIT;
+        }
+        if (XENSIV_PAS_GAS_OK != res) {
+            return res;
+        }
+        xensiv_pas_gas_stats_record_retry(dev);
+        op->attempt++;
+        return XENSIV_PAS_GAS_PENDING;
+    }
+
+    if (op->check_write) {
+        /* A failed read leaves the write as successful */
+        op->check_write = false;
+        res = xensiv_pas_gas_base_transfer(dev, false, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, &op->sens_sts, 1U);
+        if (XENSIV_PAS_GAS_PENDING == res) {
+            return XENSIV_PAS_GAS_ASYNC_AWAIT;
+        }
+        if ((XENSIV_PAS_GAS_OK != res) || ((op->sens_sts & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) == 0U)) {
+            return XENSIV_PAS_GAS_OK;
+        }
+        op->clear_iccerr = true;
+        return XENSIV_PAS_GAS_PENDING;
+    }
+
+    res = xensiv_pas_gas_base_transfer(dev, op->write, op->reg_addr, op->data, op->len);
+    if (XENSIV_PAS_GAS_PENDING == res) {
+        return XENSIV_PAS_GAS_ASYNC_AWAIT;
+    }
+
+    if ((policy == NULL) || ((op->attempt + 1U) >= policy->max_attempts)) {
+        return res;
+    }
+
+    xensiv_pas_gas_retry_safe_fptr_t is_safe = (policy->is_safe != NULL) ? policy->is_safe : xensiv_pas_gas_retry_is_safe_default;
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        if (policy->clear_iccerr && op->write && !xensiv_pas_gas_async_covers_sens_sts(op) &&
+            is_safe(dev, op->reg_addr, op->len, true)) {
+            /* A write rejected as an invalid command only shows in SENS_STS.ICCERR */
+            op->check_write = true;
+            res = XENSIV_PAS_GAS_PENDING;
+        } else if (policy->clear_iccerr && !op->write && xensiv_pas_gas_async_covers_sens_sts(op) &&
+                   ((op->data[XENSIV_PAS_GAS_REG_SENS_STS - op->reg_addr] & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U)) {
+            /* The sensor flagged an invalid command, e.g. a corrupted frame of a previous access */
+            op->clear_iccerr = true;
+            res = XENSIV_PAS_GAS_PENDING;
+        }
+        return res;
+    }
+
+    if ((res < 0) || (res >= 32) || ((policy->retryable & XENSIV_PAS_GAS_RETRY_MASK(res)) == 0U) ||
+        !is_safe(dev, op->reg_addr, op->len, op->write)) {
+        return res;
+    }
+
+    if (op->backoff_ms > 0U) {
+        xensiv_pas_gas_async_wait(op, op->backoff_ms);
+        op->backoff_ms *= policy->backoff_multiplier;
+        if (op->backoff_ms > policy->backoff_max_ms) {
+            op->backoff_ms = policy->backoff_max_ms;
+        }
+    }
+
+    xensiv_pas_gas_stats_record_retry(dev);
+    op->attempt++;
+    return XENSIV_PAS_GAS_PENDING;
+}
+
+/* Steps of xensiv_pas_gas_base_init */
+static void xensiv_pas_gas_async_next_init(xensiv_pas_gas_async_t *op, int32_t res) {
+    switch (op->state++)
+    {
+        case 0U:
+            op->buf[0] = XENSIV_PAS_GAS_ASYNC_COMM_TEST_VAL;
+            xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_SCRATCH_PAD, op->buf, 1U);
+            break;
+        case 1U:
+            if (XENSIV_PAS_GAS_OK == res) {
+                xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_SCRATCH_PAD, op->buf, 1U);
+            } else {
+                xensiv_pas_gas_async_finish(op, XENSIV_PAS_GAS_ERR_COMM);
+            }
+            break;
+        case 2U:
+            if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_ASYNC_COMM_TEST_VAL == op->buf[0])) {
+                op->buf[0] = (uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET;
+                xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_SENS_RST, op->buf, 1U);
+            } else {
+                xensiv_pas_gas_async_finish(op, XENSIV_PAS_GAS_ERR_COMM);
+            }
+            break;
+        case 3U:
+            xensiv_pas_gas_async_wait(op, XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS);
+            if (XENSIV_PAS_GAS_OK == res) {
+                /* Read the sensor status and verify if the sensor is ready */
+                xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, op->buf, 1U);
+            } else {
+                xensiv_pas_gas_async_finish(op, res);
+            }
+            break;
+        default:
+            xensiv_pas_gas_async_finish(op, (XENSIV_PAS_GAS_OK == res) ? xensiv_pas_gas_base_check_ready(op->buf[0]) : res);
+            break;
+    }
+}
+
+/* Steps of xensiv_pas_gas_get_result */
+static void xensiv_pas_gas_async_next_read_result(xensiv_pas_gas_async_t *op, int32_t res) {
+    switch (op->state++)
+    {
+        case 0U:
+            xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_STS, op->buf, 1U);
+            break;
+        case 1U:
+            if ((XENSIV_PAS_GAS_OK == res) && ((op->buf[0] & XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK) != 0U)) {
+                xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_GASCONC_H, op->buf, 2U);
+            } else {
+                xensiv_pas_gas_async_finish(op, (XENSIV_PAS_GAS_OK == res) ? XENSIV_PAS_GAS_READ_NRDY : res);
+            }
+            break;
+        default:
+            if (XENSIV_PAS_GAS_OK == res) {
+                *op->val = (uint16_t)(((uint16_t)op->buf[0] << 8U) | op->buf[1]);
+            }
+            xensiv_pas_gas_async_finish(op, res);
+            break;
+    }
+}
+
+/* Steps of xensiv_pas_gas_base_perform_forced_compensation and, for the CO2 variant, of saving the offset */
+static void xensiv_pas_gas_async_next_fcs(xensiv_pas_gas_async_t *op, int32_t res) {
+    if ((op->state > 0U) && (op->state != 6U) && (op->state != 9U) && (XENSIV_PAS_GAS_OK != res)) {
+        xensiv_pas_gas_async_finish(op, res);
+        return;
+    }
+
+    switch (op->state++)
+    {
+        case 0U:
+            xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            break;
+        case 1U:
+            op->meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+            xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            break;
+        case 2U:
+            op->buf[0] = 0U;
+            op->buf[1] = op->dev->fcs_meas_rate_s;
+            xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H, op->buf, 2U);
+            break;
+        case 3U:
+            op->buf[0] = (uint8_t)(op->gas_ref >> 8U);
+            op->buf[1] = (uint8_t)(op->gas_ref & 0xFFU);
+            xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_CALIB_REF_H, op->buf, 2U);
+            break;
+        case 4U:
+            op->meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_CONTINUOUS;
+            op->meas_cfg.b.boc_cfg = XENSIV_PAS_GAS_BOC_CFG_FORCED;
+            xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            break;
+        case 5U:
+            /* The forced BOC was just written, the timeout counts from there */
+            op->deadline_us = op->due_us +
+                              ((uint64_t)op->timeout_cycles * op->dev->fcs_meas_rate_s * XENSIV_PAS_GAS_ASYNC_US_PER_S);
+            xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            break;
+        case 6U:
+            /* Wait until the FCS is finished */
+            if (((XENSIV_PAS_GAS_OK != res) || (XENSIV_PAS_GAS_BOC_CFG_FORCED == op->meas_cfg.b.boc_cfg)) &&
+                (op->due_us >= op->deadline_us)) {
+                /* No completion within timeout_cycles: leave the sensor idle with the automatic BOC and return TIMEOUT */
+                op->state = 9U;
+                op->meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+                op->meas_cfg.b.boc_cfg = XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC;
+                xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            } else if ((XENSIV_PAS_GAS_OK != res) || (XENSIV_PAS_GAS_BOC_CFG_FORCED == op->meas_cfg.b.boc_cfg)) {
+                op->state = 6U;
+                xensiv_pas_gas_async_wait(op, op->poll_ms);
+                xensiv_pas_gas_async_access(op, false, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            } else {
+                op->meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+                xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &op->meas_cfg.u, 1U);
+            }
+            break;
+        case 7U:
+            if (XENSIV_PAS_GAS_VARIANT_CO2 == op->dev->variant) {
+                op->buf[0] = (uint8_t)XENSIV_PAS_GAS_CO2_CMD_SAVE_FCS_CALIB_OFFSET;
+                xensiv_pas_gas_async_access(op, true, (uint8_t)XENSIV_PAS_GAS_REG_SENS_RST, op->buf, 1U);
+            } else {
+                xensiv_pas_gas_async_finish(op, res);
+            }
+            break;
+        case 9U:
+            xensiv_pas_gas_async_finish(op, XENSIV_PAS_GAS_TIMEOUT);
+            break;
+        default:
+            xensiv_pas_gas_async_finish(op, res);
+            break;
+    }
+}
+
+static void xensiv_pas_gas_async_next(xensiv_pas_gas_async_t *op, int32_t res) {
+    switch (op->kind)
+    {
+        case XENSIV_PAS_GAS_ASYNC_OP_INIT:
+            xensiv_pas_gas_async_next_init(op, res);
+            break;
+        case XENSIV_PAS_GAS_ASYNC_OP_READ_RESULT:
+            xensiv_pas_gas_async_next_read_result(op, res);
+            break;
+        case XENSIV_PAS_GAS_ASYNC_OP_FCS:
+            xensiv_pas_gas_async_next_fcs(op, res);
+            break;
+        default:
+            xensiv_pas_gas_async_finish(op, res);
+            break;
+    }
+}
+
+int32_t xensiv_pas_gas_async_init(xensiv_pas_gas_async_t *op, xensiv_pas_gas_t *dev, xensiv_pas_gas_variant_t variant, xensiv_pas_gas_interface_t itf, void *ctx) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    switch (variant)
+    {
+#if XENSIV_PAS_GAS_ENABLE_CO2
+        case XENSIV_PAS_GAS_VARIANT_CO2:
+            xensiv_pas_gas_co2_setup(dev);
+            break;
+#endif
+#if XENSIV_PAS_GAS_ENABLE_R290
+        case XENSIV_PAS_GAS_VARIANT_R290:
+            xensiv_pas_gas_r290_setup(dev);
+            break;
+#endif
+#if XENSIV_PAS_GAS_ENABLE_A2L
+        case XENSIV_PAS_GAS_VARIANT_A2L:
+            xensiv_pas_gas_a2l_setup(dev);
+            break;
+#endif
+        default:
+            return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+    xensiv_pas_gas_base_setup(dev, itf, ctx);
+
+    xensiv_pas_gas_async_start(op, dev, XENSIV_PAS_GAS_ASYNC_OP_INIT);
+    xensiv_pas_gas_async_next(op, XENSIV_PAS_GAS_OK);
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_async_read_result(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint16_t *val) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(val != NULL);
+
+    xensiv_pas_gas_async_start(op, dev, XENSIV_PAS_GAS_ASYNC_OP_READ_RESULT);
+    op->val = val;
+    xensiv_pas_gas_async_next(op, XENSIV_PAS_GAS_OK);
+}
+
+void xensiv_pas_gas_async_forced_compensation(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint16_t gas_ref) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    xensiv_pas_gas_async_start(op, dev, XENSIV_PAS_GAS_ASYNC_OP_FCS);
+    op->gas_ref = gas_ref;
+    op->poll_ms = XENSIV_PAS_GAS_ASYNC_FCS_POLL_MS;
+    op->timeout_cycles = XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES;
+    xensiv_pas_gas_async_next(op, XENSIV_PAS_GAS_OK);
+}
+
+void xensiv_pas_gas_async_get_reg(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(data != NULL);
+
+    xensiv_pas_gas_async_start(op, dev, XENSIV_PAS_GAS_ASYNC_OP_REG);
+    xensiv_pas_gas_async_access(op, false, reg_addr, data, len);
+}
+
+void xensiv_pas_gas_async_set_reg(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(data != NULL);
+
+    xensiv_pas_gas_async_start(op, dev, XENSIV_PAS_GAS_ASYNC_OP_REG);
+    xensiv_pas_gas_async_access(op, true, reg_addr, (uint8_t *)data, len);
+}
+
+int32_t xensiv_pas_gas_async_step(xensiv_pas_gas_async_t *op, uint64_t time_us) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+
+    if (UINT64_MAX == op->due_us) {
+        return op->res;
+    }
+
+    if (time_us < op->due_us) {
+        return XENSIV_PAS_GAS_PENDING;
+    }
+
+    if (op->done) {
+        op->due_us = UINT64_MAX;
+        return op->res;
+    }
+
+    xensiv_pas_gas_async_t prev = *op;
+    int32_t res = xensiv_pas_gas_async_transfer(op, time_us);
+    if (XENSIV_PAS_GAS_ASYNC_AWAIT == res) {
+        /* Repeated from the start once the platform received the response */
+        *op = prev;
+    } else if (XENSIV_PAS_GAS_PENDING != res) {
+        xensiv_pas_gas_async_next(op, res);
+    }
+
+    /* At least the delay following the access is pending */
+    return XENSIV_PAS_GAS_PENDING;
+}
+
+uint64_t xensiv_pas_gas_async_get_due_us(const xensiv_pas_gas_async_t *op) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+
+    return op->due_us;
+}
+
+int32_t xensiv_pas_gas_async_get_result(const xensiv_pas_gas_async_t *op) {
+    xensiv_pas_gas_plat_assert(op != NULL);
+
+    return (UINT64_MAX == op->due_us) ? op->res : XENSIV_PAS_GAS_PENDING;
+}
@@ -0,0 +1,204 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_async.h
+ *
+ * Description: This file contains the non-blocking operations of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_ASYNC_H_
+#define XENSIV_PAS_GAS_ASYNC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_async XENSIV™ PAS GAS sensor non-blocking operations
+ * \{
+ * Non-blocking variants of the driver operations which wait, so that a single thread can drive many
+ * sensors concurrently.
+ *
+ * The blocking functions wait \ref XENSIV_PAS_GAS_COMM_DELAY_MS after each register access, \ref
+ * XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS after a soft reset and poll the sensor during a forced compensation,
+ * all through \ref xensiv_pas_gas_plat_delay. An operation started here performs the same register
+ * accesses with the same results and retry policy, but returns instead of waiting: each call to
+ * \ref xensiv_pas_gas_async_step performs at most one register access and tells when the operation must
+ * be stepped again. The register transfers themselves still go through the platform functions.
+ *
+ * A platform may also avoid waiting for a UART response: \ref xensiv_pas_gas_plat_uart_write and \ref
+ * xensiv_pas_gas_plat_uart_read then return XENSIV_PAS_GAS_PENDING while the command cannot be sent or the
+ * response has not arrived yet. The step leaves the operation unchanged and the platform is expected to step
+ * it again once the serial port is ready; the repeated step issues the same commands, which the platform
+ * answers from the responses it already received. The Linux platform does so, see \ref group_board_libs_linux.
+ *
+ * The timestamps are passed by the application, in microseconds of any monotonic clock:
+ * \code
+ *  xensiv_pas_gas_async_read_result(&op, &dev, &val);
+ *  while (XENSIV_PAS_GAS_PENDING == (res = xensiv_pas_gas_async_step(&op, now_us()))) {
+ *      ...                                             // Other work until xensiv_pas_gas_async_get_due_us(&op)
+ *  }
+ * \endcode
+ *
+ * An operation completes once the delay following its last register access has elapsed, so the next
+ * operation on the same sensor can start right away. Only one operation may run on a sensor at a time.
+ * The C++20 coroutine layer in xensiv_pas_gas_coro.hpp drives the operations of many sensors from a
+ * single executor.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Interval in milliseconds between the MEAS_CFG reads while waiting for a forced compensation to complete */
+#define XENSIV_PAS_GAS_ASYNC_FCS_POLL_MS         (1000U)
+
+/** Number of measurement periods at fcs_meas_rate_s after which a forced compensation is abandoned */
+#define XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES  (30U)
+
+/********************************* Type definitions **************************************/
+
+/** State of a non-blocking operation. The members are private to the operation. */
+typedef struct
+{
+    const xensiv_pas_gas_t *dev;            /*!< Sensor device */
+    uint8_t kind;                           /*!< Operation */
+    uint8_t state;                          /*!< Step of the operation */
+    int32_t res;                            /*!< Result once the operation is completed */
+    bool done;                              /*!< The result is known, the operation completes at the next step */
+    uint64_t due_us;                        /*!< Time of the next step; 0 for immediately */
+    uint8_t reg_addr;                       /*!< Start register address of the access */
+    uint8_t len;                            /*!< Number of bytes accessed */
+    bool write;                             /*!< The access is a register write */
+    uint8_t *data;                          /*!< Data of the access */
+    uint8_t attempt;                        /*!< Number of retries of the access */
+    uint32_t backoff_ms;                    /*!< Delay before the next retry */
+    bool clear_iccerr;                      /*!< The next transfer clears SENS_STS.ICCERR */
+    bool check_write;                       /*!< The next transfer reads SENS_STS.ICCERR after the write */
+    uint8_t sens_sts;                       /*!< SENS_STS read after the write */
+    uint8_t buf[2];                         /*!< Register data of the operation */
+    uint16_t gas_ref;                       /*!< Reference of the forced compensation */
+    uint32_t poll_ms;                       /*!< Interval between the MEAS_CFG reads of the forced compensation */
+    uint16_t timeout_cycles;                /*!< Number of measurement periods after which the forced compensation is abandoned */
+    uint64_t deadline_us;                   /*!< Time after which the forced compensation is abandoned */
+    uint16_t *val;                          /*!< Pointer to populate with the gas concentration */
+    xensiv_pas_gas_measurement_config_t meas_cfg;   /*!< Measurement configuration of the forced compensation */
+} xensiv_pas_gas_async_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts the initialization of a sensor, as \ref xensiv_pas_gas_co2_init, \ref xensiv_pas_gas_r290_init
+ * or \ref xensiv_pas_gas_a2l_init.
+ * The device structure is set up without accessing the bus; the soft reset is waited for by the operation.
+ *
+ * @param[out] op Operation state allocated by the user
+ * @param[in out] dev Pointer to a XENSIV™ PAS GAS sensor device structure allocated by user,
+ * but the operation will initialize its contents
+ * @param[in] variant Sensor variant, CO2, R290 or A2L
+ * @param[in] itf Communication interface (I2C/UART)
+ * @param[in] ctx Pointer to the platform-specific I2C or UART communication handler
+ * @return XENSIV_PAS_GAS_OK if the operation was started; XENSIV_PAS_GAS_INVALID_PARAMETER if the variant is not supported
+ */
+int32_t xensiv_pas_gas_async_init(xensiv_pas_gas_async_t *op, xensiv_pas_gas_t *dev, xensiv_pas_gas_variant_t variant, xensiv_pas_gas_interface_t itf, void *ctx);
+
+/**
+ * @brief Starts reading a gas concentration result, as \ref xensiv_pas_gas_get_result
+ *
+ * @param[out] op Operation state allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[out] val Pointer to populate with the gas concentration once the operation completed successfully
+ */
+void xensiv_pas_gas_async_read_result(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint16_t *val);
+
+/**
+ * @brief Starts a forced compensation, as \ref xensiv_pas_gas_perform_forced_compensation.
+ * The completion is polled every \ref XENSIV_PAS_GAS_ASYNC_FCS_POLL_MS; for the CO2 variant the offset is
+ * saved to the non-volatile memory afterwards. If the sensor has not cleared the forced BOC \ref
+ * XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES measurement periods after it was set, the sensor is set to idle with
+ * the automatic BOC and the operation completes with \ref XENSIV_PAS_GAS_TIMEOUT, whatever the result of that
+ * write. A failed MEAS_CFG read is polled again, so the limit also bounds a sensor which stopped responding.
+ *
+ * @param[out] op Operation state allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] gas_ref Reference gas concentration
+ */
+void xensiv_pas_gas_async_forced_compensation(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint16_t gas_ref);
+
+/**
+ * @brief Starts reading registers, as \ref xensiv_pas_gas_get_reg
+ *
+ * @param[out] op Operation state allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] reg_addr Start register address
+ * @param[out] data Buffer to populate with the register values; it is kept until the operation is completed
+ * @param[in] len Number of registers to read
+ */
+void xensiv_pas_gas_async_get_reg(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len);
+
+/**
+ * @brief Starts writing registers, as \ref xensiv_pas_gas_set_reg
+ *
+ * @param[out] op Operation state allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] reg_addr Start register address
+ * @param[in] data Register values; they are kept until the operation is completed
+ * @param[in] len Number of registers to write
+ */
+void xensiv_pas_gas_async_set_reg(xensiv_pas_gas_async_t *op, const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len);
+
+/**
+ * @brief Advances the operation.
+ * Performs the next register access if it is due at time_us. Calling it earlier has no effect. If the
+ * platform returned XENSIV_PAS_GAS_PENDING for a UART command of the access, the operation is left as it was
+ * and remains due at once.
+ *
+ * @param[in] op Operation state
+ * @param[in] time_us Current time
+ * @return XENSIV_PAS_GAS_PENDING if the operation must be stepped again at \ref xensiv_pas_gas_async_get_due_us;
+ * otherwise the result of the operation, as returned by the blocking function
+ */
+int32_t xensiv_pas_gas_async_step(xensiv_pas_gas_async_t *op, uint64_t time_us);
+
+/**
+ * @brief Gets the time of the next step of the operation
+ *
+ * @param[in] op Operation state
+ * @return Time at which \ref xensiv_pas_gas_async_step must be called; 0 if it can be called immediately;
+ * UINT64_MAX if the operation is completed
+ */
+uint64_t xensiv_pas_gas_async_get_due_us(const xensiv_pas_gas_async_t *op);
+
+/**
+ * @brief Gets the result of the operation
+ *
+ * @param[in] op Operation state
+ * @return XENSIV_PAS_GAS_PENDING while the operation is in progress; otherwise the result of the operation
+ */
+int32_t xensiv_pas_gas_async_get_result(const xensiv_pas_gas_async_t *op);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_async */
+
+#endif /* XENSIV_PAS_GAS_ASYNC_H_ */
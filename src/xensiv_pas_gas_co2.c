@@ -24,13 +24,14 @@
 
 #include "xensiv_pas_gas_co2.h"
 
-#define XENSIV_PAS_GAS_CO2_FCS_MEAS_RATE_S           (10)
+#if XENSIV_PAS_GAS_ENABLE_CO2
 
 /** Usage of the default functionalities from base class */
 extern int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
+extern int32_t xensiv_pas_gas_base_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm);
 extern int32_t xensiv_pas_gas_base_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref);
 
-static int32_t xensiv_pas_gas_co2_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref) {
+int32_t xensiv_pas_gas_co2_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
     int32_t res = xensiv_pas_gas_base_perform_forced_compensation(dev, gas_ref);
@@ -42,13 +43,66 @@ static int32_t xensiv_pas_gas_co2_perform_forced_compensation(const xensiv_pas_g
     return res;
 }
 
+void xensiv_pas_gas_co2_setup(xensiv_pas_gas_t *dev) {
+    dev->variant = XENSIV_PAS_GAS_VARIANT_CO2;
+    dev->fcs_meas_rate_s = XENSIV_PAS_GAS_CO2_FCS_MEAS_RATE_S;
+    dev->meas_rate_min = XENSIV_PAS_GAS_CO2_MEAS_RATE_MIN;
+#if XENSIV_PAS_GAS_DISPATCH_FCS
+    dev->force_comp = xensiv_pas_gas_co2_perform_forced_compensation;
+#endif
+}
+
 int32_t xensiv_pas_gas_co2_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(ctx != NULL);
 
-    dev->fcs_meas_rate_s = XENSIV_PAS_GAS_CO2_FCS_MEAS_RATE_S;
-    dev->meas_rate_min = XENSIV_PAS_GAS_CO2_MEAS_RATE_MIN;
-    dev->force_comp = xensiv_pas_gas_co2_perform_forced_compensation;
+    xensiv_pas_gas_co2_setup(dev);
 
     return xensiv_pas_gas_base_init(dev, itf, ctx);
 }
+
+int32_t xensiv_pas_gas_co2_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    xensiv_pas_gas_co2_setup(dev);
+
+    return xensiv_pas_gas_base_attach(dev, itf, ctx, warm);
+}
+
+int32_t xensiv_pas_gas_co2_get_status(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_status_t *status) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(status != NULL);
+
+    return xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, &(status->u), 1U);
+}
+
+int32_t xensiv_pas_gas_co2_get_measurement_config(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_measurement_config_t *meas_config) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(meas_config != NULL);
+
+    return xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &(meas_config->u), 1U);
+}
+
+int32_t xensiv_pas_gas_co2_set_measurement_config(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_measurement_config_t meas_config) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    return xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG, &meas_config.u, 1U);
+}
+
+int32_t xensiv_pas_gas_co2_set_pwm_config(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_pwm_mode_t mode, bool enable) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    xensiv_pas_gas_co2_measurement_config_t meas_config;
+    int32_t res = xensiv_pas_gas_co2_get_measurement_config(dev, &meas_config);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        meas_config.b.pwm_mode = (uint32_t)mode;
+        meas_config.b.pwm_outen = enable ? 1U : 0U;
+        res = xensiv_pas_gas_co2_set_measurement_config(dev, meas_config);
+    }
+
+    return res;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_CO2 */
@@ -41,6 +41,9 @@
 /** Minimum allowed measurement rate */
 #define XENSIV_PAS_GAS_CO2_MEAS_RATE_MIN            (5U)
 
+/** Measurement rate in seconds applied during the forced compensation */
+#define XENSIV_PAS_GAS_CO2_FCS_MEAS_RATE_S          (10U)
+
 /********************************* Type definitions **************************************/
 
 /** Enum defining the different device commands */
@@ -84,7 +87,7 @@ typedef union
     {
         uint32_t op_mode : 2;                           /*!< @ref xensiv_pas_gas_op_mode_t */
         uint32_t boc_cfg : 2;                           /*!< @ref xensiv_pas_gas_boc_cfg_t */
-        uint32_t pwm_mode : 1;                          /*!< @ref xensiv_pas_gas_pwm_mode_t */
+        uint32_t pwm_mode : 1;                          /*!< @ref xensiv_pas_gas_co2_pwm_mode_t */
         uint32_t pwm_outen : 1;                         /*!< PWM output software enable bit */
         uint32_t : 2;
     } b;                                                /*!< Structure used for bit access */
@@ -109,6 +112,59 @@ extern "C" {
  */
 int32_t xensiv_pas_gas_co2_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
 
+/**
+ * @brief Attaches to a XENSIV™ PAS GAS CO2 device which may already be configured by a previous session.
+ * If the scratch pad holds \ref XENSIV_PAS_GAS_ATTACH_SIGNATURE, the sensor is ready without error flags and the measurement rate is valid,
+ * the sensor is attached without a soft reset and keeps running with its measurement configuration, rate and ABOC state.
+ * Otherwise the sensor is initialized as done by \ref xensiv_pas_gas_co2_init.
+ *
+ * @param[in out] dev Pointer to a XENSIV™ PAS GAS CO2 sensor device structure allocated by the user,
+ * but the attach function will initialize its contents
+ * @param[in] itf Communication interface (I2C/UART)
+ * @param[in] ctx Pointer to the platform-specific specific protocol communication handler
+ * @param[out] warm Optional pointer to populate with true if the sensor was attached without a soft reset; NULL if not needed
+ * @return XENSIV_PAS_GAS_OK if the attach or the initialization was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_co2_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm);
+
+/**
+ * @brief Gets the CO2 sensor device status, including the PWM_DIS pin status
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS CO2 sensor device structure
+ * @param[out] status Pointer to populate with the sensor device status
+ * @return XENSIV_PAS_GAS_OK if reading the device status was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_co2_get_status(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_status_t *status);
+
+/**
+ * @brief Gets the CO2 sensor device measurement configuration, including the PWM configuration
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS CO2 sensor device structure
+ * @param[out] meas_config Pointer to populate with the measurement configuration
+ * @return XENSIV_PAS_GAS_OK if getting the measurement configuration was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_co2_get_measurement_config(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_measurement_config_t *meas_config);
+
+/**
+ * @brief Sets the CO2 sensor device measurement configuration, including the PWM configuration
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS CO2 sensor device structure
+ * @param[in] meas_config New measurement configuration to apply
+ * @return XENSIV_PAS_GAS_OK if setting the measurement configuration was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_co2_set_measurement_config(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_measurement_config_t meas_config);
+
+/**
+ * @brief Configures the PWM output, keeping the operating mode and BOC configuration.
+ * The output is only driven while the PWM_DIS pin is low, see \ref xensiv_pas_gas_co2_get_status.
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS CO2 sensor device structure
+ * @param[in] mode PWM single-pulse or pulse-train mode
+ * @param[in] enable Software enable of the PWM output
+ * @return XENSIV_PAS_GAS_OK if the configuration was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_co2_set_pwm_config(const xensiv_pas_gas_t *dev, xensiv_pas_gas_co2_pwm_mode_t mode, bool enable);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,148 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_co2_pwm.c
+ *
+ * Description: This file contains the host-side decoder of the PWM output of the XENSIV™ PAS GAS CO2
+ *              sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_co2_pwm.h"
+
+#if XENSIV_PAS_GAS_ENABLE_CO2
+
+#define XENSIV_PAS_GAS_CO2_PWM_DEFAULT_PERIOD_US        (1024UL)
+#define XENSIV_PAS_GAS_CO2_PWM_DEFAULT_FULL_SCALE_PPM   (10000U)
+#define XENSIV_PAS_GAS_CO2_PWM_DEFAULT_MIN_PULSE_US     (2UL)
+#define XENSIV_PAS_GAS_CO2_PWM_DEFAULT_TOLERANCE_PCT    (25U)
+
+/* Converts a high time over a period into a concentration, rounded to the nearest ppm */
+static uint16_t xensiv_pas_gas_co2_pwm_to_ppm(const xensiv_pas_gas_co2_pwm_t *dec, uint64_t high_us, uint64_t period_us) {
+    return (uint16_t)(((high_us * dec->config.full_scale_ppm) + (period_us / 2U)) / period_us);
+}
+
+static bool xensiv_pas_gas_co2_pwm_period_valid(const xensiv_pas_gas_co2_pwm_t *dec, uint64_t period_us) {
+    uint64_t nominal_us = dec->config.period_us;
+    uint64_t tolerance_us = (nominal_us * dec->config.period_tolerance_pct) / 100U;
+
+    return (period_us + tolerance_us >= nominal_us) && (period_us <= nominal_us + tolerance_us);
+}
+
+void xensiv_pas_gas_co2_pwm_get_default_config(xensiv_pas_gas_co2_pwm_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->mode = XENSIV_PAS_GAS_CO2_PWM_MODE_SINGLE_PULSE;
+    config->period_us = XENSIV_PAS_GAS_CO2_PWM_DEFAULT_PERIOD_US;
+    config->full_scale_ppm = XENSIV_PAS_GAS_CO2_PWM_DEFAULT_FULL_SCALE_PPM;
+    config->min_pulse_us = XENSIV_PAS_GAS_CO2_PWM_DEFAULT_MIN_PULSE_US;
+    config->period_tolerance_pct = XENSIV_PAS_GAS_CO2_PWM_DEFAULT_TOLERANCE_PCT;
+}
+
+int32_t xensiv_pas_gas_co2_pwm_init(xensiv_pas_gas_co2_pwm_t *dec, const xensiv_pas_gas_co2_pwm_config_t *config) {
+    xensiv_pas_gas_plat_assert(dec != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if ((config->period_us == 0U) || (config->full_scale_ppm == 0U)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    dec->config = *config;
+    dec->has_level = false;
+    dec->level = false;
+    dec->has_rise = false;
+    dec->has_fall = false;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_co2_pwm_decode_edge(xensiv_pas_gas_co2_pwm_t *dec, uint64_t time_us, bool level, uint16_t *ppm) {
+    xensiv_pas_gas_plat_assert(dec != NULL);
+    xensiv_pas_gas_plat_assert(ppm != NULL);
+
+    int32_t res = XENSIV_PAS_GAS_READ_NRDY;
+
+    if (dec->has_level && (level == dec->level)) {
+        return res;
+    }
+    dec->has_level = true;
+    dec->level = level;
+
+    if (level) {
+        /* In pulse-train mode a rising edge completes the period of the previous pulse */
+        if ((XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE == dec->config.mode) && dec->has_fall) {
+            uint64_t period_us = time_us - dec->rise_us;
+            if (xensiv_pas_gas_co2_pwm_period_valid(dec, period_us)) {
+                *ppm = xensiv_pas_gas_co2_pwm_to_ppm(dec, dec->fall_us - dec->rise_us, period_us);
+                res = XENSIV_PAS_GAS_OK;
+            }
+        }
+        dec->rise_us = time_us;
+        dec->has_rise = true;
+        dec->has_fall = false;
+    } else if (dec->has_rise) {
+        uint64_t high_us = time_us - dec->rise_us;
+
+        if ((high_us < dec->config.min_pulse_us) || (high_us > dec->config.period_us)) {
+            /* Glitch, or a pulse exceeding the period: discard the pulse */
+            dec->has_rise = false;
+        } else if (XENSIV_PAS_GAS_CO2_PWM_MODE_SINGLE_PULSE == dec->config.mode) {
+            *ppm = xensiv_pas_gas_co2_pwm_to_ppm(dec, high_us, dec->config.period_us);
+            dec->has_rise = false;
+            res = XENSIV_PAS_GAS_OK;
+        } else {
+            dec->fall_us = time_us;
+            dec->has_fall = true;
+        }
+    } else {
+        /* The capture started in the middle of a high pulse */
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_co2_pwm_read(xensiv_pas_gas_co2_pwm_t *dec, void *ctx, uint16_t *ppm) {
+    xensiv_pas_gas_plat_assert(dec != NULL);
+    xensiv_pas_gas_plat_assert(ppm != NULL);
+
+    xensiv_pas_gas_pwm_edge_t edges[XENSIV_PAS_GAS_CO2_PWM_CAPTURE_LEN];
+    size_t count;
+    bool decoded = false;
+    int32_t res;
+
+    do
+    {
+        count = 0U;
+        res = xensiv_pas_gas_plat_pwm_capture(ctx, edges, XENSIV_PAS_GAS_CO2_PWM_CAPTURE_LEN, &count);
+
+        /* The edges returned along with an error are still valid */
+        for (size_t i = 0U; i < count; ++i)
+        {
+            if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_co2_pwm_decode_edge(dec, edges[i].time_us, edges[i].level, ppm)) {
+                decoded = true;
+            }
+        }
+    } while ((XENSIV_PAS_GAS_OK == res) && (count == XENSIV_PAS_GAS_CO2_PWM_CAPTURE_LEN));
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        res = decoded ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_READ_NRDY;
+    }
+
+    return res;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_CO2 */
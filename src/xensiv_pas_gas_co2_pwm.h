@@ -0,0 +1,146 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_co2_pwm.h
+ *
+ * Description: This file contains the host-side decoder of the PWM output of the XENSIV™ PAS GAS CO2
+ *              sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_CO2_PWM_H_
+#define XENSIV_PAS_GAS_CO2_PWM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas_co2.h"
+
+/**
+ * \addtogroup group_board_libs_co2_pwm XENSIV™ PAS GAS CO2 sensor PWM decoder
+ * \{
+ * Decoder which converts the edges captured on the PWM output of the CO2 sensor into the gas concentration,
+ * so that the concentration can be read without accessing the serial interface.
+ *
+ * In single-pulse mode the sensor outputs one pulse per measurement, whose width relative to the nominal
+ * PWM period gives the concentration. In pulse-train mode the sensor outputs pulses continuously and the
+ * concentration is given by the duty cycle; the period is measured at each rising edge, so the clock tolerance
+ * of the sensor cancels out. The period and full scale are nominal values of the configuration, set them
+ * according to the datasheet of the sensor in use.
+ *
+ * High pulses shorter than min_pulse_us and, in pulse-train mode, periods deviating by more than
+ * period_tolerance_pct from the nominal period are discarded as glitches.
+ *
+ * The edges are either passed one by one with \ref xensiv_pas_gas_co2_pwm_decode_edge, e.g. from an input
+ * capture interrupt, or fetched from \ref xensiv_pas_gas_plat_pwm_capture by \ref xensiv_pas_gas_co2_pwm_read:
+ * \code
+ *  xensiv_pas_gas_co2_set_pwm_config(&dev, XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE, true);
+ *
+ *  xensiv_pas_gas_co2_pwm_config_t config;
+ *  xensiv_pas_gas_co2_pwm_get_default_config(&config);
+ *  config.mode = XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE;
+ *  xensiv_pas_gas_co2_pwm_init(&dec, &config);
+ *
+ *  if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_co2_pwm_read(&dec, capture_ctx, &ppm)) {
+ *      ...
+ *  }
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Number of edges fetched from \ref xensiv_pas_gas_plat_pwm_capture per call */
+#define XENSIV_PAS_GAS_CO2_PWM_CAPTURE_LEN          (16U)
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the PWM decoder */
+typedef struct
+{
+    xensiv_pas_gas_co2_pwm_mode_t mode;     /*!< PWM mode configured in the sensor */
+    uint32_t period_us;                     /*!< Nominal PWM period */
+    uint16_t full_scale_ppm;                /*!< Concentration at 100 % duty cycle */
+    uint32_t min_pulse_us;                  /*!< High pulses shorter than this are discarded */
+    uint8_t period_tolerance_pct;           /*!< Deviation of the measured period from period_us above which a pulse is discarded, pulse-train mode only */
+} xensiv_pas_gas_co2_pwm_config_t;
+
+/** State of the PWM decoder. The members are private to the decoder. */
+typedef struct
+{
+    xensiv_pas_gas_co2_pwm_config_t config; /*!< Configuration */
+    bool has_level;                         /*!< An edge has been decoded */
+    bool level;                             /*!< Level after the last edge */
+    bool has_rise;                          /*!< rise_us holds the start of the current high pulse */
+    bool has_fall;                          /*!< fall_us holds the end of the current high pulse */
+    uint64_t rise_us;                       /*!< Time of the last rising edge */
+    uint64_t fall_us;                       /*!< Time of the last falling edge */
+} xensiv_pas_gas_co2_pwm_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default configuration.
+ * Single-pulse mode, nominal period 1024 us, full scale 10000 ppm, min_pulse_us 2 us, period_tolerance_pct 25 %.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_co2_pwm_get_default_config(xensiv_pas_gas_co2_pwm_config_t *config);
+
+/**
+ * @brief Initializes the decoder
+ *
+ * @param[out] dec Decoder state allocated by the user
+ * @param[in] config Decoder configuration
+ * @return XENSIV_PAS_GAS_OK if the decoder was initialized; XENSIV_PAS_GAS_INVALID_PARAMETER if period_us or
+ * full_scale_ppm is 0
+ */
+int32_t xensiv_pas_gas_co2_pwm_init(xensiv_pas_gas_co2_pwm_t *dec, const xensiv_pas_gas_co2_pwm_config_t *config);
+
+/**
+ * @brief Decodes an edge of the PWM output. Edges must be passed in time order; an edge repeating the
+ * previous level is ignored.
+ *
+ * @param[in] dec Decoder state
+ * @param[in] time_us Time of the edge, in microseconds of any monotonic clock
+ * @param[in] level Level of the PWM output after the edge
+ * @param[out] ppm Pointer to populate with the gas concentration
+ * @return XENSIV_PAS_GAS_OK if the edge completed a valid pulse and ppm was updated; XENSIV_PAS_GAS_READ_NRDY otherwise
+ */
+int32_t xensiv_pas_gas_co2_pwm_decode_edge(xensiv_pas_gas_co2_pwm_t *dec, uint64_t time_us, bool level, uint16_t *ppm);
+
+/**
+ * @brief Fetches the captured edges with \ref xensiv_pas_gas_plat_pwm_capture and decodes them
+ *
+ * @param[in] dec Decoder state
+ * @param[in] ctx Capture object passed to \ref xensiv_pas_gas_plat_pwm_capture
+ * @param[out] ppm Pointer to populate with the latest gas concentration
+ * @return XENSIV_PAS_GAS_OK if at least one valid pulse was decoded; XENSIV_PAS_GAS_READ_NRDY if no pulse was
+ * completed; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_co2_pwm_read(xensiv_pas_gas_co2_pwm_t *dec, void *ctx, uint16_t *ppm);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_co2_pwm */
+
+#endif /* XENSIV_PAS_GAS_CO2_PWM_H_ */
@@ -0,0 +1,93 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_co2_pwm_replay.c
+ *
+ * Description: This file contains the file replay implementation of the PWM capture of the XENSIV™
+ *              PAS GAS CO2 sensor for host machines.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <inttypes.h>
+#include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_co2_pwm_replay.h"
+
+#define XENSIV_PAS_GAS_CO2_PWM_REPLAY_LINE_LEN      (80U)
+
+int32_t xensiv_pas_gas_co2_pwm_replay_open(xensiv_pas_gas_co2_pwm_replay_t *replay, const char *path) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+    xensiv_pas_gas_plat_assert(path != NULL);
+
+    replay->line = 0U;
+    replay->file = fopen(path, "r");
+
+    return (NULL != replay->file) ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_INVALID_PARAMETER;
+}
+
+void xensiv_pas_gas_co2_pwm_replay_close(xensiv_pas_gas_co2_pwm_replay_t *replay) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+
+    if (NULL != replay->file) {
+        (void)fclose(replay->file);
+        replay->file = NULL;
+    }
+}
+
+uint32_t xensiv_pas_gas_co2_pwm_replay_get_line(const xensiv_pas_gas_co2_pwm_replay_t *replay) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+
+    return replay->line;
+}
+
+int32_t xensiv_pas_gas_plat_pwm_capture(void *ctx, xensiv_pas_gas_pwm_edge_t *edges, size_t max_edges, size_t *count) {
+    xensiv_pas_gas_co2_pwm_replay_t *replay = (xensiv_pas_gas_co2_pwm_replay_t *)ctx;
+    xensiv_pas_gas_plat_assert(replay != NULL);
+    xensiv_pas_gas_plat_assert(count != NULL);
+
+    char buf[XENSIV_PAS_GAS_CO2_PWM_REPLAY_LINE_LEN];
+    int32_t res = XENSIV_PAS_GAS_OK;
+    *count = 0U;
+
+    /* The end of the file is reached once fewer than max_edges edges are returned */
+    while ((NULL != replay->file) && (*count < max_edges) && (NULL != fgets(buf, (int)sizeof(buf), replay->file)))
+    {
+        replay->line++;
+
+        uint64_t time_us;
+        unsigned int level;
+        char *p = buf;
+        while ((*p == ' ') || (*p == '\t'))
+        {
+            p++;
+        }
+
+        if ((*p == '#') || (*p == '\n') || (*p == '\r') || (*p == '\0')) {
+            continue;
+        }
+
+        if ((2 != sscanf(p, "%" SCNu64 " %u", &time_us, &level)) || (level > 1U)) {
+            res = XENSIV_PAS_GAS_INVALID_PARAMETER;
+            break;
+        }
+
+        edges[*count].time_us = time_us;
+        edges[*count].level = (level != 0U);
+        (*count)++;
+    }
+
+    return res;
+}
@@ -0,0 +1,93 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_co2_pwm_replay.h
+ *
+ * Description: This file contains the file replay implementation of the PWM capture of the XENSIV™
+ *              PAS GAS CO2 sensor for host machines.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_CO2_PWM_REPLAY_H_
+#define XENSIV_PAS_GAS_CO2_PWM_REPLAY_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include "xensiv_pas_gas_platform.h"
+
+/**
+ * \addtogroup group_board_libs_co2_pwm_replay XENSIV™ PAS GAS CO2 sensor PWM capture replay
+ * \{
+ * Implementation of \ref xensiv_pas_gas_plat_pwm_capture which replays edges recorded in a text file,
+ * to run the PWM decoder on hosts without a capture peripheral. It is part of the emulator library.
+ *
+ * Each line of the file holds one edge, "<time_us> <level>" with level 0 or 1; empty lines and lines
+ * starting with '#' are skipped. The capture object passed to the decoder is the replay:
+ * \code
+ *  xensiv_pas_gas_co2_pwm_replay_t replay;
+ *  xensiv_pas_gas_co2_pwm_replay_open(&replay, "pwm.txt");
+ *  res = xensiv_pas_gas_co2_pwm_read(&dec, &replay, &ppm);
+ *  xensiv_pas_gas_co2_pwm_replay_close(&replay);
+ * \endcode
+ */
+
+/********************************* Type definitions **************************************/
+
+/** State of the PWM capture replay. The members are private to the replay. */
+typedef struct
+{
+    FILE *file;                             /*!< Replayed file */
+    uint32_t line;                          /*!< Number of lines read */
+} xensiv_pas_gas_co2_pwm_replay_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opens a file of recorded edges
+ *
+ * @param[out] replay Replay state allocated by the user
+ * @param[in] path Path of the file
+ * @return XENSIV_PAS_GAS_OK if the file was opened; XENSIV_PAS_GAS_INVALID_PARAMETER otherwise
+ */
+int32_t xensiv_pas_gas_co2_pwm_replay_open(xensiv_pas_gas_co2_pwm_replay_t *replay, const char *path);
+
+/**
+ * @brief Closes the file of recorded edges
+ *
+ * @param[in] replay Replay state
+ */
+void xensiv_pas_gas_co2_pwm_replay_close(xensiv_pas_gas_co2_pwm_replay_t *replay);
+
+/**
+ * @brief Gets the number of lines read so far, to locate a malformed line
+ *
+ * @param[in] replay Replay state
+ * @return Number of lines read
+ */
+uint32_t xensiv_pas_gas_co2_pwm_replay_get_line(const xensiv_pas_gas_co2_pwm_replay_t *replay);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_co2_pwm_replay */
+
+#endif /* XENSIV_PAS_GAS_CO2_PWM_REPLAY_H_ */
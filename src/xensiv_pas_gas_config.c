@@ -0,0 +1,539 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_config.c
+ *
+ * Description: This file contains the declarative configuration profiles of the XENSIV™ PAS GAS
+ *              sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "xensiv_pas_gas_config.h"
+#include "xensiv_pas_gas_co2_regs.h"
+#include "xensiv_pas_gas_a2l_regs.h"
+
+extern bool xensiv_pas_gas_base_reaches(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len);
+
+#define XENSIV_PAS_GAS_CONFIG_VARIANT(v)         (1U << (uint8_t)(v))
+#define XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL       (0xFFU)
+#define XENSIV_PAS_GAS_CONFIG_VARIANTS_EXT       (XENSIV_PAS_GAS_CONFIG_VARIANT(XENSIV_PAS_GAS_VARIANT_R290) | \
+                                                  XENSIV_PAS_GAS_CONFIG_VARIANT(XENSIV_PAS_GAS_VARIANT_A2L))
+#define XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L       (XENSIV_PAS_GAS_CONFIG_VARIANT(XENSIV_PAS_GAS_VARIANT_A2L))
+
+#define XENSIV_PAS_GAS_CONFIG_MEAS_CFG_MSK       (XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK | XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_MSK)
+#define XENSIV_PAS_GAS_CONFIG_CO2_MEAS_CFG_MSK   (XENSIV_PAS_GAS_CONFIG_MEAS_CFG_MSK | XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_MODE_MSK | \
+                                                  XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_OUTEN_MSK)
+#define XENSIV_PAS_GAS_CONFIG_INT_CFG_MSK        (XENSIV_PAS_GAS_REG_INT_CFG_ALARM_TYP_MSK | XENSIV_PAS_GAS_REG_INT_CFG_INT_FUNC_MSK | \
+                                                  XENSIV_PAS_GAS_REG_INT_CFG_INT_TYP_MSK)
+#define XENSIV_PAS_GAS_CONFIG_ALARM_CFG_MSK      (0x03U)
+#define XENSIV_PAS_GAS_CONFIG_SMOOTHING_MSK      (0x7FU)
+#define XENSIV_PAS_GAS_CONFIG_ABOC_CYCLE_MSK     (0x7FU)
+#define XENSIV_PAS_GAS_CONFIG_HC_ENABLE_MSK      (0x01U)
+
+#define XENSIV_PAS_GAS_CONFIG_IMAGE_SIZE         (15U)
+#define XENSIV_PAS_GAS_CONFIG_MEAS_CFG_OFFSET    (2U)
+
+#define XENSIV_PAS_GAS_CONFIG_SNAPSHOT_MAGIC     (0xC5U)
+#define XENSIV_PAS_GAS_CONFIG_SNAPSHOT_VERSION   (1U)
+#define XENSIV_PAS_GAS_CONFIG_SNAPSHOT_HDR_LEN   (4U)   /* Magic, version, variant, number of blocks */
+#define XENSIV_PAS_GAS_CONFIG_SNAPSHOT_BLK_LEN   (2U)   /* Register address, number of registers */
+#define XENSIV_PAS_GAS_CONFIG_SNAPSHOT_CRC_LEN   (1U)
+
+#define XENSIV_PAS_GAS_CRC8_POLY                 (0x31U)
+#define XENSIV_PAS_GAS_CRC8_INIT                 (0xFFU)
+
+/** Register of a configuration profile field */
+typedef struct
+{
+    uint32_t field;         /* XENSIV_PAS_GAS_CONFIG_xxx */
+    uint8_t reg_addr;       /* Start register address */
+    uint8_t len;            /* Number of registers, 2 for 16-bit values written as a whole */
+    uint8_t mask;           /* Bits managed by the profile, single register fields only */
+    uint8_t variants;       /* Sensor variants supporting the field */
+} xensiv_pas_gas_config_reg_t;
+
+/* Sorted by register address, a field follows the previous one in the register image */
+static const xensiv_pas_gas_config_reg_t xensiv_pas_gas_config_regs[] =
+{
+    { XENSIV_PAS_GAS_CONFIG_MEAS_RATE, XENSIV_PAS_GAS_REG_MEAS_RATE_H, 2U, 0xFFU, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_CONFIG_MEAS_CFG, XENSIV_PAS_GAS_REG_MEAS_CFG, 1U, XENSIV_PAS_GAS_CONFIG_CO2_MEAS_CFG_MSK, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_CONFIG_INT_CFG, XENSIV_PAS_GAS_REG_INT_CFG, 1U, XENSIV_PAS_GAS_CONFIG_INT_CFG_MSK, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_CONFIG_ALARM_TH, XENSIV_PAS_GAS_REG_ALARM_TH_H, 2U, 0xFFU, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_CONFIG_PRESS_REF, XENSIV_PAS_GAS_REG_PRESS_REF_H, 2U, 0xFFU, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_CONFIG_GAS_SEL, XENSIV_PAS_GAS_A2L_REG_GAS_CFG, 1U, XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_SEL_MASK, XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L },
+    { XENSIV_PAS_GAS_CONFIG_ALARM_CFG, XENSIV_PAS_GAS_A2L_REG_ALARM_CFG, 1U, XENSIV_PAS_GAS_CONFIG_ALARM_CFG_MSK, XENSIV_PAS_GAS_CONFIG_VARIANTS_EXT },
+    { XENSIV_PAS_GAS_CONFIG_DENOISE, XENSIV_PAS_GAS_A2L_REG_DENOISE_CFG, 1U, XENSIV_PAS_GAS_CONFIG_SMOOTHING_MSK, XENSIV_PAS_GAS_CONFIG_VARIANTS_EXT },
+    { XENSIV_PAS_GAS_CONFIG_ABOC_CYCLE, XENSIV_PAS_GAS_A2L_REG_ABOC_CYCLE, 1U, XENSIV_PAS_GAS_CONFIG_ABOC_CYCLE_MSK, XENSIV_PAS_GAS_CONFIG_VARIANTS_EXT },
+    { XENSIV_PAS_GAS_CONFIG_ALARM_HYS, XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_H, 2U, 0xFFU, XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L },
+    { XENSIV_PAS_GAS_CONFIG_HUM_COMP, XENSIV_PAS_GAS_A2L_REG_HC_CTRL, 1U, XENSIV_PAS_GAS_CONFIG_HC_ENABLE_MSK, XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L },
+};
+
+#define XENSIV_PAS_GAS_CONFIG_NUM_REGS           (sizeof(xensiv_pas_gas_config_regs) / sizeof(xensiv_pas_gas_config_regs[0]))
+
+/** Block of contiguous configuration registers captured by a snapshot */
+typedef struct
+{
+    uint8_t reg_addr;       /* Start register address */
+    uint8_t len;            /* Number of registers */
+    uint8_t variants;       /* Sensor variants having the registers */
+} xensiv_pas_gas_config_block_t;
+
+/* Measurement and interrupt configuration, thresholds and compensation references; no measurement results, status or action registers */
+static const xensiv_pas_gas_config_block_t xensiv_pas_gas_config_blocks[] =
+{
+    { XENSIV_PAS_GAS_REG_MEAS_RATE_H, 3U, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_REG_INT_CFG, 7U, XENSIV_PAS_GAS_CONFIG_VARIANTS_ALL },
+    { XENSIV_PAS_GAS_A2L_REG_GAS_CFG, 2U, XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L },
+    { XENSIV_PAS_GAS_A2L_REG_ALARM_CFG, 1U, XENSIV_PAS_GAS_CONFIG_VARIANT(XENSIV_PAS_GAS_VARIANT_R290) },
+    { XENSIV_PAS_GAS_A2L_REG_DENOISE_CFG, 2U, XENSIV_PAS_GAS_CONFIG_VARIANTS_EXT },
+    { XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_H, 2U, XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L },
+    { XENSIV_PAS_GAS_A2L_REG_HC_CTRL, 1U, XENSIV_PAS_GAS_CONFIG_VARIANTS_A2L },
+};
+
+#define XENSIV_PAS_GAS_CONFIG_NUM_BLOCKS         (sizeof(xensiv_pas_gas_config_blocks) / sizeof(xensiv_pas_gas_config_blocks[0]))
+
+static inline bool xensiv_pas_gas_config_is_supported(const xensiv_pas_gas_t *dev, const xensiv_pas_gas_config_reg_t *reg) {
+    return (reg->variants & XENSIV_PAS_GAS_CONFIG_VARIANT(dev->variant)) != 0U;
+}
+
+static inline bool xensiv_pas_gas_config_follows(size_t i) {
+    const xensiv_pas_gas_config_reg_t *prev = &xensiv_pas_gas_config_regs[i - 1U];
+
+    return xensiv_pas_gas_config_regs[i].reg_addr == (uint8_t)(prev->reg_addr + prev->len);
+}
+
+static uint8_t xensiv_pas_gas_config_mask(const xensiv_pas_gas_t *dev, const xensiv_pas_gas_config_reg_t *reg) {
+    if ((XENSIV_PAS_GAS_CONFIG_MEAS_CFG == reg->field) && (XENSIV_PAS_GAS_VARIANT_CO2 != dev->variant)) {
+        return XENSIV_PAS_GAS_CONFIG_MEAS_CFG_MSK;
+    }
+
+    return reg->mask;
+}
+
+static uint32_t xensiv_pas_gas_config_supported_fields(const xensiv_pas_gas_t *dev) {
+    uint32_t fields = 0U;
+
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_CONFIG_NUM_REGS; ++i)
+    {
+        if (xensiv_pas_gas_config_is_supported(dev, &xensiv_pas_gas_config_regs[i])) {
+            fields |= xensiv_pas_gas_config_regs[i].field;
+        }
+    }
+
+    return fields;
+}
+
+/* Reads the registers of the given fields into the image, bridging the unused fields between two needed ones */
+static int32_t xensiv_pas_gas_config_read_image(const xensiv_pas_gas_t *dev, uint32_t fields, uint8_t *image) {
+    int32_t res = XENSIV_PAS_GAS_OK;
+    uint8_t offset = 0U;
+    size_t i = 0U;
+
+    while ((XENSIV_PAS_GAS_OK == res) && (i < XENSIV_PAS_GAS_CONFIG_NUM_REGS))
+    {
+        if ((fields & xensiv_pas_gas_config_regs[i].field) == 0U) {
+            offset += xensiv_pas_gas_config_regs[i].len;
+            i++;
+            continue;
+        }
+
+        size_t last = i;
+        uint8_t len = xensiv_pas_gas_config_regs[i].len;
+        uint8_t run_len = len;
+        for (size_t j = i + 1U; (j < XENSIV_PAS_GAS_CONFIG_NUM_REGS) && xensiv_pas_gas_config_follows(j) &&
+             xensiv_pas_gas_config_is_supported(dev, &xensiv_pas_gas_config_regs[j]); ++j)
+        {
+            run_len += xensiv_pas_gas_config_regs[j].len;
+            if ((fields & xensiv_pas_gas_config_regs[j].field) != 0U) {
+                last = j;
+                len = run_len;
+            }
+        }
+
+        res = xensiv_pas_gas_get_reg(dev, xensiv_pas_gas_config_regs[i].reg_addr, &image[offset], len);
+
+        offset += len;
+        i = last + 1U;
+    }
+
+    return res;
+}
+
+static void xensiv_pas_gas_config_encode(const xensiv_pas_gas_config_t *config, uint32_t field, uint8_t *val) {
+    uint16_t val16 = 0U;
+
+    switch (field)
+    {
+        case XENSIV_PAS_GAS_CONFIG_MEAS_CFG:
+            val[0] = config->meas_cfg.u;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_MEAS_RATE:
+            val16 = config->meas_rate;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_INT_CFG:
+            val[0] = config->int_cfg.u;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ALARM_TH:
+            val16 = config->alarm_threshold;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_PRESS_REF:
+            val16 = config->pressure_ref;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_GAS_SEL:
+            val[0] = config->gas_sel;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ALARM_CFG:
+            val[0] = config->alarm_cfg;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_DENOISE:
+            val[0] = config->denoise;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ABOC_CYCLE:
+            val[0] = config->aboc_cycle;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ALARM_HYS:
+            val16 = config->alarm_hysteresis;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_HUM_COMP:
+            val[0] = config->hum_comp ? XENSIV_PAS_GAS_CONFIG_HC_ENABLE_MSK : 0U;
+            break;
+        default:
+            xensiv_pas_gas_plat_assert(false);
+            break;
+    }
+
+    if ((XENSIV_PAS_GAS_CONFIG_MEAS_RATE == field) || (XENSIV_PAS_GAS_CONFIG_ALARM_TH == field) ||
+        (XENSIV_PAS_GAS_CONFIG_PRESS_REF == field) || (XENSIV_PAS_GAS_CONFIG_ALARM_HYS == field)) {
+        val[0] = (uint8_t)(val16 >> 8U);
+        val[1] = (uint8_t)val16;
+    }
+}
+
+static void xensiv_pas_gas_config_decode(xensiv_pas_gas_config_t *config, uint32_t field, const uint8_t *val, uint8_t mask) {
+    uint16_t val16 = (uint16_t)(((uint16_t)val[0] << 8U) | val[1]);
+
+    switch (field)
+    {
+        case XENSIV_PAS_GAS_CONFIG_MEAS_CFG:
+            config->meas_cfg.u = val[0] & mask;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_MEAS_RATE:
+            config->meas_rate = val16;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_INT_CFG:
+            config->int_cfg.u = val[0] & mask;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ALARM_TH:
+            config->alarm_threshold = val16;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_PRESS_REF:
+            config->pressure_ref = val16;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_GAS_SEL:
+            config->gas_sel = val[0] & mask;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ALARM_CFG:
+            config->alarm_cfg = val[0] & mask;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_DENOISE:
+            config->denoise = val[0] & mask;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ABOC_CYCLE:
+            config->aboc_cycle = val[0] & mask;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_ALARM_HYS:
+            config->alarm_hysteresis = val16;
+            break;
+        case XENSIV_PAS_GAS_CONFIG_HUM_COMP:
+            config->hum_comp = (val[0] & mask) != 0U;
+            break;
+        default:
+            xensiv_pas_gas_plat_assert(false);
+            break;
+    }
+}
+
+static bool xensiv_pas_gas_config_is_valid(const xensiv_pas_gas_t *dev, const xensiv_pas_gas_config_t *config) {
+    if ((config->fields & ~xensiv_pas_gas_config_supported_fields(dev)) != 0U) {
+        return false;
+    }
+
+    if ((config->fields & XENSIV_PAS_GAS_CONFIG_MEAS_CFG) != 0U) {
+        /* A profile describes a state, single shot and forced compensation are one-time actions */
+        if ((XENSIV_PAS_GAS_OP_MODE_IDLE != config->meas_cfg.b.op_mode) && (XENSIV_PAS_GAS_OP_MODE_CONTINUOUS != config->meas_cfg.b.op_mode)) {
+            return false;
+        }
+        if ((XENSIV_PAS_GAS_BOC_CFG_DISABLE != config->meas_cfg.b.boc_cfg) && (XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC != config->meas_cfg.b.boc_cfg)) {
+            return false;
+        }
+    }
+
+    if ((config->fields & XENSIV_PAS_GAS_CONFIG_MEAS_RATE) != 0U) {
+        if ((config->meas_rate < dev->meas_rate_min) || (config->meas_rate > XENSIV_PAS_GAS_MEAS_RATE_MAX)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int32_t xensiv_pas_gas_config_read(const xensiv_pas_gas_t *dev, uint32_t fields, xensiv_pas_gas_config_t *config) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    uint8_t image[XENSIV_PAS_GAS_CONFIG_IMAGE_SIZE];
+
+    fields &= xensiv_pas_gas_config_supported_fields(dev);
+    (void)memset(config, 0, sizeof(*config));
+
+    int32_t res = xensiv_pas_gas_config_read_image(dev, fields, image);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        uint8_t offset = 0U;
+        for (size_t i = 0U; i < XENSIV_PAS_GAS_CONFIG_NUM_REGS; ++i)
+        {
+            const xensiv_pas_gas_config_reg_t *reg = &xensiv_pas_gas_config_regs[i];
+            if ((fields & reg->field) != 0U) {
+                xensiv_pas_gas_config_decode(config, reg->field, &image[offset], xensiv_pas_gas_config_mask(dev, reg));
+            }
+            offset += reg->len;
+        }
+        config->fields = fields;
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_config_apply(const xensiv_pas_gas_t *dev, const xensiv_pas_gas_config_t *config) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if (!xensiv_pas_gas_config_is_valid(dev, config)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    uint8_t current[XENSIV_PAS_GAS_CONFIG_IMAGE_SIZE];
+    uint8_t desired[XENSIV_PAS_GAS_CONFIG_IMAGE_SIZE];
+    uint32_t fields = config->fields;
+
+    /* The operating mode decides whether a rate change needs the sensor to be idle */
+    if ((fields & XENSIV_PAS_GAS_CONFIG_MEAS_RATE) != 0U) {
+        fields |= XENSIV_PAS_GAS_CONFIG_MEAS_CFG;
+    }
+
+    int32_t res = xensiv_pas_gas_config_read_image(dev, fields, current);
+    if (XENSIV_PAS_GAS_OK != res) {
+        return res;
+    }
+
+    /* Compute the fields which differ */
+    uint32_t dirty = 0U;
+    uint8_t offset = 0U;
+    (void)memcpy(desired, current, sizeof(desired));
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_CONFIG_NUM_REGS; ++i)
+    {
+        const xensiv_pas_gas_config_reg_t *reg = &xensiv_pas_gas_config_regs[i];
+        if ((config->fields & reg->field) != 0U) {
+            uint8_t val[2];
+            xensiv_pas_gas_config_encode(config, reg->field, val);
+
+            if (reg->len == 1U) {
+                uint8_t mask = xensiv_pas_gas_config_mask(dev, reg);
+                /* HC_CTRL holds status and clear bits besides the enable bit, which are not written back */
+                uint8_t preserve = (XENSIV_PAS_GAS_CONFIG_HUM_COMP == reg->field) ? 0U : (uint8_t)~mask;
+                desired[offset] = (uint8_t)((current[offset] & preserve) | (val[0] & mask));
+                if ((current[offset] & mask) != (val[0] & mask)) {
+                    dirty |= reg->field;
+                }
+            } else {
+                (void)memcpy(&desired[offset], val, reg->len);
+                if (memcmp(&current[offset], val, reg->len) != 0) {
+                    dirty |= reg->field;
+                }
+            }
+        }
+        offset += reg->len;
+    }
+
+    if ((dirty & XENSIV_PAS_GAS_CONFIG_MEAS_RATE) != 0U) {
+        /* MEAS_CFG follows MEAS_RATE, restoring the operating mode is done in the same burst as the rate */
+        xensiv_pas_gas_measurement_config_t meas_config = { .u = current[XENSIV_PAS_GAS_CONFIG_MEAS_CFG_OFFSET] };
+        if (XENSIV_PAS_GAS_OP_MODE_IDLE != meas_config.b.op_mode) {
+            meas_config.b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+            res = xensiv_pas_gas_set_measurement_config(dev, meas_config);
+            dirty |= XENSIV_PAS_GAS_CONFIG_MEAS_CFG;
+        }
+    }
+
+    /* Write the contiguous fields which differ in a single burst */
+    offset = 0U;
+    size_t i = 0U;
+    while ((XENSIV_PAS_GAS_OK == res) && (i < XENSIV_PAS_GAS_CONFIG_NUM_REGS))
+    {
+        if ((dirty & xensiv_pas_gas_config_regs[i].field) == 0U) {
+            offset += xensiv_pas_gas_config_regs[i].len;
+            i++;
+            continue;
+        }
+
+        uint8_t len = xensiv_pas_gas_config_regs[i].len;
+        size_t j = i + 1U;
+        while ((j < XENSIV_PAS_GAS_CONFIG_NUM_REGS) && xensiv_pas_gas_config_follows(j) &&
+               ((dirty & xensiv_pas_gas_config_regs[j].field) != 0U))
+        {
+            len += xensiv_pas_gas_config_regs[j].len;
+            j++;
+        }
+
+        res = xensiv_pas_gas_set_reg(dev, xensiv_pas_gas_config_regs[i].reg_addr, &desired[offset], len);
+
+        offset += len;
+        i = j;
+    }
+
+    return res;
+}
+
+uint8_t xensiv_pas_gas_crc8(const uint8_t *data, size_t len) {
+    uint8_t crc = XENSIV_PAS_GAS_CRC8_INIT;
+
+    for (size_t i = 0U; i < len; ++i)
+    {
+        crc ^= data[i];
+        for (uint8_t bit = 0U; bit < 8U; ++bit)
+        {
+            crc = ((crc & 0x80U) != 0U) ? (uint8_t)((uint8_t)(crc << 1U) ^ XENSIV_PAS_GAS_CRC8_POLY) : (uint8_t)(crc << 1U);
+        }
+    }
+
+    return crc;
+}
+
+/* Only the blocks a snapshot of the variant holds are restored, e.g. no SENS_RST command from a crafted blob */
+static bool xensiv_pas_gas_config_is_snapshot_block(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len) {
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_CONFIG_NUM_BLOCKS; ++i)
+    {
+        const xensiv_pas_gas_config_block_t *blk = &xensiv_pas_gas_config_blocks[i];
+        if ((blk->reg_addr == reg_addr) && (blk->len == len)) {
+            return ((blk->variants & XENSIV_PAS_GAS_CONFIG_VARIANT(dev->variant)) != 0U) &&
+                   xensiv_pas_gas_base_reaches(dev, reg_addr, len);
+        }
+    }
+
+    return false;
+}
+
+int32_t xensiv_pas_gas_config_snapshot(const xensiv_pas_gas_t *dev, uint8_t *buf, size_t size, size_t *len) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(buf != NULL);
+    xensiv_pas_gas_plat_assert(len != NULL);
+
+    size_t pos = XENSIV_PAS_GAS_CONFIG_SNAPSHOT_HDR_LEN;
+    uint8_t blocks = 0U;
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    for (size_t i = 0U; (XENSIV_PAS_GAS_OK == res) && (i < XENSIV_PAS_GAS_CONFIG_NUM_BLOCKS); ++i)
+    {
+        const xensiv_pas_gas_config_block_t *blk = &xensiv_pas_gas_config_blocks[i];
+        if ((blk->variants & XENSIV_PAS_GAS_CONFIG_VARIANT(dev->variant)) == 0U) {
+            continue;
+        }
+
+        if ((pos + XENSIV_PAS_GAS_CONFIG_SNAPSHOT_BLK_LEN + blk->len + XENSIV_PAS_GAS_CONFIG_SNAPSHOT_CRC_LEN) > size) {
+            res = XENSIV_PAS_GAS_INVALID_PARAMETER;
+            break;
+        }
+
+        buf[pos++] = blk->reg_addr;
+        buf[pos++] = blk->len;
+        res = xensiv_pas_gas_get_reg(dev, blk->reg_addr, &buf[pos], blk->len);
+
+        if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_REG_MEAS_RATE_H == blk->reg_addr)) {
+            /* Single shot and forced compensation are one-time actions, not configuration */
+            xensiv_pas_gas_measurement_config_t *meas_config = (xensiv_pas_gas_measurement_config_t *)&buf[pos + XENSIV_PAS_GAS_CONFIG_MEAS_CFG_OFFSET];
+            if (XENSIV_PAS_GAS_OP_MODE_SINGLE == meas_config->b.op_mode) {
+                meas_config->b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+            }
+            if (XENSIV_PAS_GAS_BOC_CFG_FORCED == meas_config->b.boc_cfg) {
+                meas_config->b.boc_cfg = XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC;
+            }
+        }
+
+        pos += blk->len;
+        blocks++;
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        buf[0] = XENSIV_PAS_GAS_CONFIG_SNAPSHOT_MAGIC;
+        buf[1] = XENSIV_PAS_GAS_CONFIG_SNAPSHOT_VERSION;
+        buf[2] = (uint8_t)dev->variant;
+        buf[3] = blocks;
+        buf[pos] = xensiv_pas_gas_crc8(buf, pos);
+        *len = pos + XENSIV_PAS_GAS_CONFIG_SNAPSHOT_CRC_LEN;
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_config_restore(const xensiv_pas_gas_t *dev, const uint8_t *buf, size_t len) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(buf != NULL);
+
+    if ((len < (XENSIV_PAS_GAS_CONFIG_SNAPSHOT_HDR_LEN + XENSIV_PAS_GAS_CONFIG_SNAPSHOT_CRC_LEN)) ||
+        (XENSIV_PAS_GAS_CONFIG_SNAPSHOT_MAGIC != buf[0]) || (XENSIV_PAS_GAS_CONFIG_SNAPSHOT_VERSION != buf[1]) ||
+        ((uint8_t)dev->variant != buf[2]) || (xensiv_pas_gas_crc8(buf, len - 1U) != buf[len - 1U])) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    /* Check the block structure before writing anything */
+    size_t pos = XENSIV_PAS_GAS_CONFIG_SNAPSHOT_HDR_LEN;
+    for (uint8_t i = 0U; i < buf[3]; ++i)
+    {
+        if (((pos + XENSIV_PAS_GAS_CONFIG_SNAPSHOT_BLK_LEN) > (len - 1U)) ||
+            !xensiv_pas_gas_config_is_snapshot_block(dev, buf[pos], buf[pos + 1U])) {
+            return XENSIV_PAS_GAS_INVALID_PARAMETER;
+        }
+        pos += XENSIV_PAS_GAS_CONFIG_SNAPSHOT_BLK_LEN + buf[pos + 1U];
+    }
+    if (pos != (len - 1U)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    /* The measurement rate must not change while a measurement mode is active */
+    xensiv_pas_gas_measurement_config_t meas_config;
+    int32_t res = xensiv_pas_gas_get_measurement_config(dev, &meas_config);
+
+    if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_OP_MODE_IDLE != meas_config.b.op_mode)) {
+        meas_config.b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+        res = xensiv_pas_gas_set_measurement_config(dev, meas_config);
+    }
+
+    pos = XENSIV_PAS_GAS_CONFIG_SNAPSHOT_HDR_LEN;
+    for (uint8_t i = 0U; (XENSIV_PAS_GAS_OK == res) && (i < buf[3]); ++i)
+    {
+        uint8_t reg_addr = buf[pos];
+        uint8_t blk_len = buf[pos + 1U];
+        pos += XENSIV_PAS_GAS_CONFIG_SNAPSHOT_BLK_LEN;
+
+        res = xensiv_pas_gas_set_reg(dev, reg_addr, &buf[pos], blk_len);
+        pos += blk_len;
+    }
+
+    return res;
+}
@@ -0,0 +1,183 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_config.h
+ *
+ * Description: This file contains the declarative configuration profiles of the XENSIV™ PAS GAS
+ *              sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_CONFIG_H_
+#define XENSIV_PAS_GAS_CONFIG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_config XENSIV™ PAS GAS sensor configuration profiles
+ * \{
+ * Description of the complete desired configuration of a sensor. Applying a profile reads the
+ * current configuration in bursts and only writes the registers which differ, merged into bursts
+ * of contiguous registers. Applying the same profile twice does not write to the sensor.
+ *
+ * \code
+ *  xensiv_pas_gas_config_t profile = {
+ *      .fields = XENSIV_PAS_GAS_CONFIG_MEAS_CFG | XENSIV_PAS_GAS_CONFIG_MEAS_RATE | XENSIV_PAS_GAS_CONFIG_INT_CFG,
+ *      .meas_cfg.b = { .op_mode = XENSIV_PAS_GAS_OP_MODE_CONTINUOUS, .boc_cfg = XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC },
+ *      .meas_rate = 60U,
+ *      .int_cfg.b = { .int_func = XENSIV_PAS_GAS_INTERRUPT_FUNCTION_DRDY, .int_typ = XENSIV_PAS_GAS_INTERRUPT_TYPE_HIGH_ACTIVE },
+ *  };
+ *  xensiv_pas_gas_config_apply(&dev, &profile);
+ * \endcode
+ *
+ * A snapshot captures all configuration registers of the sensor into a compact binary blob, which can be
+ * stored on the host and restored to the same or to a replacement sensor of the same variant.
+ *
+ * Over UART only the registers up to SENS_RST are reached: a profile with R290 or A2L fields, as well as the
+ * snapshot and restore of these variants, return \ref XENSIV_PAS_GAS_INVALID_PARAMETER without writing to the
+ * sensor.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Profile field: MEAS_CFG operating mode, BOC and, for the CO2 variant, PWM configuration */
+#define XENSIV_PAS_GAS_CONFIG_MEAS_CFG           (1UL << 0U)
+/** Profile field: measurement rate */
+#define XENSIV_PAS_GAS_CONFIG_MEAS_RATE          (1UL << 1U)
+/** Profile field: interrupt configuration */
+#define XENSIV_PAS_GAS_CONFIG_INT_CFG            (1UL << 2U)
+/** Profile field: alarm threshold */
+#define XENSIV_PAS_GAS_CONFIG_ALARM_TH           (1UL << 3U)
+/** Profile field: pressure compensation reference */
+#define XENSIV_PAS_GAS_CONFIG_PRESS_REF          (1UL << 4U)
+/** Profile field: gas selection (A2L) */
+#define XENSIV_PAS_GAS_CONFIG_GAS_SEL            (1UL << 5U)
+/** Profile field: ALARM pin configuration (R290, A2L) */
+#define XENSIV_PAS_GAS_CONFIG_ALARM_CFG          (1UL << 6U)
+/** Profile field: denoise smoothing factor (R290, A2L) */
+#define XENSIV_PAS_GAS_CONFIG_DENOISE            (1UL << 7U)
+/** Profile field: ABOC cycle (R290, A2L) */
+#define XENSIV_PAS_GAS_CONFIG_ABOC_CYCLE         (1UL << 8U)
+/** Profile field: alarm hysteresis (A2L) */
+#define XENSIV_PAS_GAS_CONFIG_ALARM_HYS          (1UL << 9U)
+/** Profile field: humidity compensation enable (A2L) */
+#define XENSIV_PAS_GAS_CONFIG_HUM_COMP           (1UL << 10U)
+/** All profile fields; the fields not supported by the sensor variant are ignored by \ref xensiv_pas_gas_config_read */
+#define XENSIV_PAS_GAS_CONFIG_ALL                ((1UL << 11U) - 1UL)
+
+/** Size of a buffer large enough for any snapshot written by \ref xensiv_pas_gas_config_snapshot */
+#define XENSIV_PAS_GAS_CONFIG_SNAPSHOT_MAX_SIZE  (48U)
+
+/********************************* Type definitions **************************************/
+
+/** Configuration profile of a XENSIV™ PAS GAS sensor */
+typedef struct
+{
+    uint32_t fields;                                    /*!< ORed XENSIV_PAS_GAS_CONFIG_xxx of the fields managed by the profile, the others are left untouched */
+    xensiv_pas_gas_measurement_config_t meas_cfg;       /*!< Operating mode (idle or continuous) and BOC; the CO2 PWM bits are set as in \ref xensiv_pas_gas_co2_measurement_config_t */
+    uint16_t meas_rate;                                 /*!< Measurement rate in seconds */
+    xensiv_pas_gas_interrupt_config_t int_cfg;          /*!< Interrupt configuration */
+    uint16_t alarm_threshold;                           /*!< Alarm threshold */
+    uint16_t pressure_ref;                              /*!< Pressure compensation reference in hPa */
+    uint8_t gas_sel;                                    /*!< Selected gas, see \ref xensiv_pas_gas_a2l_gas_selection_t */
+    uint8_t alarm_cfg;                                  /*!< ALARM pin configuration, see \ref xensiv_pas_gas_a2l_alarm_config_t */
+    uint8_t denoise;                                    /*!< Denoise smoothing factor */
+    uint8_t aboc_cycle;                                 /*!< ABOC cycle in days */
+    uint16_t alarm_hysteresis;                          /*!< Alarm hysteresis */
+    bool hum_comp;                                      /*!< Humidity compensation enable */
+} xensiv_pas_gas_config_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Reads the current configuration of the sensor into a profile
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] fields ORed XENSIV_PAS_GAS_CONFIG_xxx of the fields to read
+ * @param[out] config Pointer to populate with the profile; its fields member holds the fields supported by the variant
+ * @return XENSIV_PAS_GAS_OK if reading the configuration was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_config_read(const xensiv_pas_gas_t *dev, uint32_t fields, xensiv_pas_gas_config_t *config);
+
+/**
+ * @brief Applies a configuration profile to the sensor.
+ * Only the registers which differ from the profile are written, contiguous registers in a single burst.
+ * If the measurement rate changes while a measurement mode is active, the sensor is set to idle first and
+ * MEAS_CFG is written after the rate.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] config Profile to apply
+ * @return XENSIV_PAS_GAS_OK if applying the profile was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if the profile has a field
+ * not supported by the sensor variant, requests the single shot or forced compensation mode or an invalid measurement rate;
+ * an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_config_apply(const xensiv_pas_gas_t *dev, const xensiv_pas_gas_config_t *config);
+
+/**
+ * @brief Captures the configuration registers of the sensor into a binary snapshot.
+ * The snapshot holds the sensor variant, the configuration register blocks and a CRC. The measurement
+ * configuration is captured without one-time actions: single shot is stored as idle mode and forced
+ * compensation as automatic BOC.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[out] buf Buffer to populate with the snapshot
+ * @param[in] size Size of the buffer, \ref XENSIV_PAS_GAS_CONFIG_SNAPSHOT_MAX_SIZE is always sufficient
+ * @param[out] len Pointer to populate with the length of the snapshot
+ * @return XENSIV_PAS_GAS_OK if the snapshot was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if the buffer is too small;
+ * an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_config_snapshot(const xensiv_pas_gas_t *dev, uint8_t *buf, size_t size, size_t *len);
+
+/**
+ * @brief Restores a snapshot taken with \ref xensiv_pas_gas_config_snapshot.
+ * The sensor is set to idle mode, then each register block of the snapshot is written in a single burst.
+ * Each block must be one of the register blocks a snapshot of the variant holds, with the same address and
+ * length; the blob is checked completely before the sensor is accessed.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] buf Snapshot
+ * @param[in] len Length of the snapshot
+ * @return XENSIV_PAS_GAS_OK if the restore was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if the snapshot is corrupted,
+ * holds other registers, was taken from another sensor variant or holds registers beyond SENS_RST on a UART
+ * device; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_config_restore(const xensiv_pas_gas_t *dev, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Computes the CRC-8 protecting the snapshots and the sensor inventory records, polynomial 0x31 and
+ * initial value 0xFF. Used by the configuration snapshots and the sensor inventory.
+ *
+ * @param[in] data Data to protect
+ * @param[in] len Length of the data
+ * @return CRC-8 of the data
+ */
+uint8_t xensiv_pas_gas_crc8(const uint8_t *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_config */
+
+#endif /* XENSIV_PAS_GAS_CONFIG_H_ */
@@ -0,0 +1,534 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_coro.hpp
+ *
+ * Description: This file contains the C++20 coroutine layer of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_CORO_HPP_
+#define XENSIV_PAS_GAS_CORO_HPP_
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_async.h"
+
+/**
+ * \addtogroup group_board_libs_coro XENSIV™ PAS GAS sensor C++20 coroutines
+ * \{
+ * Header-only C++20 layer exposing the non-blocking operations (\ref group_board_libs_async) as awaitables.
+ *
+ * Every wait of the driver, after each register access, after the soft reset and while a forced
+ * compensation runs, suspends the awaiting coroutine instead of blocking the thread. A single executor
+ * resumes the coroutines when their wait has elapsed, so one thread drives many sensors concurrently;
+ * the bus is only held during the register transfers. The results are those of the xensiv_pas_gas_*
+ * functions:
+ * \code
+ *  xensiv_pas_gas::task<void> monitor(xensiv_pas_gas::sensor &sensor, void *ctx)
+ *  {
+ *      int32_t res = co_await sensor.init(XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_I2C, ctx);
+ *      if (XENSIV_PAS_GAS_OK != res) {
+ *          co_return;
+ *      }
+ *      xensiv_pas_gas_start_continuous_mode(sensor.get(), 10U);        // Blocking calls remain available
+ *      for (;;) {
+ *          co_await sensor.get_executor().sleep_for_ms(10000U);
+ *          auto [res, val] = co_await sensor.read_result();
+ *          ...
+ *      }
+ *  }
+ *
+ *  xensiv_pas_gas::executor exec;
+ *  std::vector<xensiv_pas_gas::sensor> sensors(n, xensiv_pas_gas::sensor(exec));
+ *  for (size_t i = 0U; i < n; ++i) {
+ *      exec.spawn(monitor(sensors[i], ctx[i]));
+ *  }
+ *  exec.run();
+ * \endcode
+ *
+ * The executor takes the time from \ref xensiv_pas_gas_plat_get_time_us, which must be implemented, and
+ * by default waits for the next due coroutine with \ref xensiv_pas_gas_plat_delay; an idle function can
+ * be passed instead, e.g. to wait on other events of the application. The executor, the sensors and the
+ * coroutines are not thread-safe and must be used from the thread running the executor. Only one operation
+ * may be awaited on a sensor at a time, and the sensor must stay in place meanwhile. Exceptions thrown by a
+ * coroutine terminate the program.
+ *
+ * GCC 12 miscompiles coroutines which co_await inside an if or while condition; assign the result of
+ * co_await to a variable first, as above.
+ */
+
+namespace xensiv_pas_gas
+{
+
+class executor;
+
+template <typename T>
+class task;
+
+namespace detail
+{
+
+/** Coroutine waiting for a point in time, and for the completion of an operation if op is not null */
+struct timer
+{
+    uint64_t due_us;                        /*!< Time at which the coroutine or the operation is due */
+    uint64_t seq;                           /*!< Insertion order, keeps timers due at the same time in order */
+    xensiv_pas_gas_async_t *op;             /*!< Operation to step */
+    std::coroutine_handle<> handle;         /*!< Coroutine to resume */
+};
+
+/** Orders the timers by due time */
+struct timer_later
+{
+    bool operator()(const timer &a, const timer &b) const {
+        return (a.due_us != b.due_us) ? (a.due_us > b.due_us) : (a.seq > b.seq);
+    }
+};
+
+/** Part of the task promise independent of the value type */
+class promise_base
+{
+public:
+    /** Resumes the awaiting coroutine, or releases a spawned coroutine */
+    struct final_awaiter
+    {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept;
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    final_awaiter final_suspend() const noexcept {
+        return {};
+    }
+
+    void unhandled_exception() const noexcept {
+        std::terminate();
+    }
+
+    std::coroutine_handle<> continuation;   /*!< Coroutine awaiting the task */
+    executor *owner = nullptr;              /*!< Executor of a spawned task */
+};
+
+} /* namespace detail */
+
+/**
+ * Coroutine producing a value of type T. The coroutine starts when it is awaited or spawned on an
+ * executor; awaiting it returns the value of its co_return.
+ */
+template <typename T>
+class task
+{
+public:
+    /** Promise of the task */
+    class promise_type : public detail::promise_base
+    {
+    public:
+        task get_return_object() noexcept {
+            return task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        void return_value(T value) noexcept {
+            value_ = std::move(value);
+        }
+
+        T &value() noexcept {
+            return value_;
+        }
+
+    private:
+        T value_ {};
+    };
+
+    task(task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    task(const task &) = delete;
+    task &operator=(const task &) = delete;
+
+    ~task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+
+    T await_resume() {
+        return std::move(handle_.promise().value());
+    }
+
+private:
+    friend class executor;
+
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/** Coroutine without a value */
+template <>
+class task<void>
+{
+public:
+    /** Promise of the task */
+    class promise_type : public detail::promise_base
+    {
+    public:
+        task get_return_object() noexcept {
+            return task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        void return_void() const noexcept {}
+    };
+
+    task(task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    task(const task &) = delete;
+    task &operator=(const task &) = delete;
+
+    ~task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    friend class executor;
+
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/** Single-threaded executor resuming the coroutines when their wait has elapsed */
+class executor
+{
+public:
+    /**
+     * Function waiting until the next coroutine is due
+     * @param[in] now_us Current time
+     * @param[in] due_us Time at which the next coroutine is due
+     * @param[in] arg User argument passed to the executor
+     */
+    using idle_fn = void (*)(uint64_t now_us, uint64_t due_us, void *arg);
+
+    /**
+     * @param[in] idle Function waiting until the next coroutine is due; nullptr to wait with \ref xensiv_pas_gas_plat_delay
+     * @param[in] arg User argument of the idle function
+     */
+    explicit executor(idle_fn idle = nullptr, void *arg = nullptr) : idle_(idle), arg_(arg) {}
+
+    executor(const executor &) = delete;
+    executor &operator=(const executor &) = delete;
+
+    ~executor() {
+        for (std::coroutine_handle<> handle : spawned_)
+        {
+            handle.destroy();
+        }
+    }
+
+    /**
+     * Starts a coroutine, which runs until its first suspension. The executor owns the coroutine and
+     * releases it once it has completed.
+     */
+    void spawn(task<void> t) {
+        std::coroutine_handle<task<void>::promise_type> handle = std::exchange(t.handle_, nullptr);
+        handle.promise().owner = this;
+        spawned_.push_back(handle);
+        handle.resume();
+    }
+
+    /** Runs the coroutines until none is waiting anymore */
+    void run() {
+        while (run_once())
+        {
+        }
+    }
+
+    /**
+     * Resumes the coroutines which are due, or waits until the next one is due
+     * @return True if coroutines are still waiting
+     */
+    bool run_once() {
+        if (timers_.empty()) {
+            return false;
+        }
+
+        uint64_t now_us = xensiv_pas_gas_plat_get_time_us();
+        if (timers_.top().due_us > now_us) {
+            idle(now_us, timers_.top().due_us);
+            return true;
+        }
+
+        while (!timers_.empty() && (timers_.top().due_us <= now_us))
+        {
+            detail::timer t = timers_.top();
+            timers_.pop();
+
+            if ((t.op != nullptr) && (XENSIV_PAS_GAS_PENDING == xensiv_pas_gas_async_step(t.op, now_us))) {
+                schedule(xensiv_pas_gas_async_get_due_us(t.op), t.op, t.handle);
+            } else {
+                t.handle.resume();
+            }
+        }
+
+        return !timers_.empty();
+    }
+
+    /** Number of coroutines waiting */
+    size_t waiting() const noexcept {
+        return timers_.size();
+    }
+
+    /** Awaitable suspending the coroutine until a point in time of \ref xensiv_pas_gas_plat_get_time_us */
+    struct sleep_awaiter
+    {
+        executor &exec;                     /*!< Executor resuming the coroutine */
+        uint64_t due_us;                    /*!< Time at which the coroutine is resumed */
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            exec.schedule(due_us, nullptr, handle);
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /** Suspends the coroutine until due_us */
+    sleep_awaiter sleep_until(uint64_t due_us) noexcept {
+        return sleep_awaiter { *this, due_us };
+    }
+
+    /** Suspends the coroutine for ms milliseconds */
+    sleep_awaiter sleep_for_ms(uint32_t ms) noexcept {
+        return sleep_awaiter { *this, xensiv_pas_gas_plat_get_time_us() + ((uint64_t)ms * 1000U) };
+    }
+
+    /** Steps the operation until it completes, then resumes the coroutine */
+    void schedule(uint64_t due_us, xensiv_pas_gas_async_t *op, std::coroutine_handle<> handle) {
+        timers_.push(detail::timer { due_us, seq_++, op, handle });
+    }
+
+private:
+    friend struct detail::promise_base::final_awaiter;
+
+    void idle(uint64_t now_us, uint64_t due_us) {
+        if (idle_ != nullptr) {
+            idle_(now_us, due_us, arg_);
+        } else {
+            xensiv_pas_gas_plat_delay((uint32_t)((due_us - now_us + 999U) / 1000U));
+        }
+    }
+
+    void release(std::coroutine_handle<> handle) noexcept {
+        for (size_t i = 0U; i < spawned_.size(); ++i)
+        {
+            if (spawned_[i] == handle) {
+                spawned_[i] = spawned_.back();
+                spawned_.pop_back();
+                break;
+            }
+        }
+        handle.destroy();
+    }
+
+    idle_fn idle_;
+    void *arg_;
+    uint64_t seq_ = 0U;
+    std::priority_queue<detail::timer, std::vector<detail::timer>, detail::timer_later> timers_;
+    std::vector<std::coroutine_handle<>> spawned_;
+};
+
+template <typename P>
+std::coroutine_handle<> detail::promise_base::final_awaiter::await_suspend(std::coroutine_handle<P> handle) noexcept {
+    promise_base &promise = handle.promise();
+
+    if (promise.continuation) {
+        return promise.continuation;
+    }
+    if (promise.owner != nullptr) {
+        promise.owner->release(handle);
+    }
+
+    return std::noop_coroutine();
+}
+
+/**
+ * Awaitable non-blocking operation; co_await returns the result of the operation. The state of the
+ * operation is kept by the sensor and the operation is only started when awaited, so the awaitable
+ * itself can be copied freely.
+ */
+template <typename Start>
+class operation
+{
+public:
+    /**
+     * @param[in] exec Executor stepping the operation
+     * @param[in] op State of the operation
+     * @param[in] start Function starting the operation on op, returning XENSIV_PAS_GAS_OK or the error which
+     * completes the operation immediately
+     */
+    operation(executor &exec, xensiv_pas_gas_async_t *op, Start start) : exec_(&exec), op_(op), start_(start) {}
+
+    bool await_ready() {
+        res_ = start_(op_);
+        return (XENSIV_PAS_GAS_OK != res_) || (XENSIV_PAS_GAS_PENDING != xensiv_pas_gas_async_step(op_, xensiv_pas_gas_plat_get_time_us()));
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        exec_->schedule(xensiv_pas_gas_async_get_due_us(op_), op_, handle);
+    }
+
+    int32_t await_resume() const noexcept {
+        return (XENSIV_PAS_GAS_OK != res_) ? res_ : xensiv_pas_gas_async_get_result(op_);
+    }
+
+protected:
+    executor *exec_;                        /*!< Executor stepping the operation */
+    xensiv_pas_gas_async_t *op_;            /*!< State of the operation */
+    Start start_;                           /*!< Function starting the operation */
+    int32_t res_ = XENSIV_PAS_GAS_OK;       /*!< Error which prevented the operation from starting */
+};
+
+/** Awaitable gas concentration read; co_await returns the result code and the gas concentration */
+template <typename Start>
+class result_operation : public operation<Start>
+{
+public:
+    /** @param[in] val Gas concentration populated by the operation */
+    result_operation(executor &exec, xensiv_pas_gas_async_t *op, Start start, const uint16_t *val) : operation<Start>(exec, op, start), val_(val) {}
+
+    std::pair<int32_t, uint16_t> await_resume() const noexcept {
+        return { operation<Start>::await_resume(), *val_ };
+    }
+
+private:
+    const uint16_t *val_;
+};
+
+/**
+ * XENSIV™ PAS GAS sensor driven by an executor. The state of the operation in progress is part of the
+ * sensor, so the sensor must not be moved or copied while an operation is awaited.
+ */
+class sensor
+{
+public:
+    /** @param[in] exec Executor stepping the operations of the sensor */
+    explicit sensor(executor &exec) noexcept : exec_(&exec), dev_ {}, op_ {} {}
+
+    /** Device structure, for the blocking xensiv_pas_gas_* functions */
+    xensiv_pas_gas_t *get() noexcept {
+        return &dev_;
+    }
+
+    /** Device structure, for the blocking xensiv_pas_gas_* functions */
+    const xensiv_pas_gas_t *get() const noexcept {
+        return &dev_;
+    }
+
+    /** Executor stepping the operations of the sensor */
+    executor &get_executor() const noexcept {
+        return *exec_;
+    }
+
+    /** Initializes the sensor, see \ref xensiv_pas_gas_async_init */
+    auto init(xensiv_pas_gas_variant_t variant, xensiv_pas_gas_interface_t itf, void *ctx) noexcept {
+        return operation(*exec_, &op_, [this, variant, itf, ctx](xensiv_pas_gas_async_t *op) {
+            return xensiv_pas_gas_async_init(op, &dev_, variant, itf, ctx);
+        });
+    }
+
+    /** Reads a gas concentration result, see \ref xensiv_pas_gas_get_result */
+    auto read_result() noexcept {
+        return result_operation(*exec_, &op_, [this](xensiv_pas_gas_async_t *op) {
+            xensiv_pas_gas_async_read_result(op, &dev_, &val_);
+            return XENSIV_PAS_GAS_OK;
+        }, &val_);
+    }
+
+    /** Performs a forced compensation, see \ref xensiv_pas_gas_async_forced_compensation */
+    auto forced_compensation(uint16_t gas_ref) noexcept {
+        return operation(*exec_, &op_, [this, gas_ref](xensiv_pas_gas_async_t *op) {
+            xensiv_pas_gas_async_forced_compensation(op, &dev_, gas_ref);
+            return XENSIV_PAS_GAS_OK;
+        });
+    }
+
+    /** Reads registers, see \ref xensiv_pas_gas_get_reg; data is kept until the operation completed */
+    auto get_reg(uint8_t reg_addr, uint8_t *data, uint8_t len) noexcept {
+        return operation(*exec_, &op_, [this, reg_addr, data, len](xensiv_pas_gas_async_t *op) {
+            xensiv_pas_gas_async_get_reg(op, &dev_, reg_addr, data, len);
+            return XENSIV_PAS_GAS_OK;
+        });
+    }
+
+    /** Writes registers, see \ref xensiv_pas_gas_set_reg; data is kept until the operation completed */
+    auto set_reg(uint8_t reg_addr, const uint8_t *data, uint8_t len) noexcept {
+        return operation(*exec_, &op_, [this, reg_addr, data, len](xensiv_pas_gas_async_t *op) {
+            xensiv_pas_gas_async_set_reg(op, &dev_, reg_addr, data, len);
+            return XENSIV_PAS_GAS_OK;
+        });
+    }
+
+private:
+    executor *exec_;
+    xensiv_pas_gas_t dev_;
+    xensiv_pas_gas_async_t op_;
+    uint16_t val_ = 0U;
+};
+
+} /* namespace xensiv_pas_gas */
+
+/** \} group_board_libs_coro */
+
+#endif /* XENSIV_PAS_GAS_CORO_HPP_ */
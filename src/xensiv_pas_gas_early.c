@@ -0,0 +1,131 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_early.c
+ *
+ * Description: This file contains the EARLY notification driven result acquisition of the
+ *              XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_early.h"
+
+#define XENSIV_PAS_GAS_EARLY_DEFAULT_MIN_OFFSET_US   (1000000UL)
+#define XENSIV_PAS_GAS_EARLY_DEFAULT_GUARD_US        (20000UL)
+#define XENSIV_PAS_GAS_EARLY_DEFAULT_POLL_US         (10000UL)
+#define XENSIV_PAS_GAS_EARLY_DEFAULT_DECAY_US        (1000UL)
+
+void xensiv_pas_gas_early_get_default_config(xensiv_pas_gas_early_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->min_offset_us = XENSIV_PAS_GAS_EARLY_DEFAULT_MIN_OFFSET_US;
+    config->guard_us = XENSIV_PAS_GAS_EARLY_DEFAULT_GUARD_US;
+    config->poll_us = XENSIV_PAS_GAS_EARLY_DEFAULT_POLL_US;
+    config->decay_us = XENSIV_PAS_GAS_EARLY_DEFAULT_DECAY_US;
+}
+
+int32_t xensiv_pas_gas_early_start(xensiv_pas_gas_early_t *acq, const xensiv_pas_gas_t *dev, const xensiv_pas_gas_early_config_t *config, uint16_t rate_s) {
+    xensiv_pas_gas_plat_assert(acq != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if (config->poll_us == 0U) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    acq->dev = dev;
+    acq->config = *config;
+    acq->offset_us = 0U;
+    acq->calibrated = false;
+    acq->pending = false;
+    acq->late = false;
+
+    xensiv_pas_gas_interrupt_config_t int_config;
+    int32_t res = xensiv_pas_gas_get_interrupt_config(dev, &int_config);
+
+    if ((XENSIV_PAS_GAS_OK == res) && (XENSIV_PAS_GAS_INTERRUPT_FUNCTION_EARLY != int_config.b.int_func)) {
+        int_config.b.int_func = XENSIV_PAS_GAS_INTERRUPT_FUNCTION_EARLY;
+        res = xensiv_pas_gas_set_interrupt_config(dev, int_config);
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        res = xensiv_pas_gas_start_continuous_mode(dev, rate_s);
+    }
+
+    return res;
+}
+
+uint64_t xensiv_pas_gas_early_on_edge(xensiv_pas_gas_early_t *acq, uint64_t time_us) {
+    xensiv_pas_gas_plat_assert(acq != NULL);
+
+    acq->early_us = time_us;
+    acq->pending = true;
+    acq->late = false;
+    acq->due_us = time_us + (acq->calibrated ? ((uint64_t)acq->offset_us + acq->config.guard_us) : acq->config.min_offset_us);
+
+    return acq->due_us;
+}
+
+int32_t xensiv_pas_gas_early_read(xensiv_pas_gas_early_t *acq, uint64_t time_us, uint16_t *val) {
+    xensiv_pas_gas_plat_assert(acq != NULL);
+    xensiv_pas_gas_plat_assert(val != NULL);
+
+    int32_t res = xensiv_pas_gas_get_result(acq->dev, val);
+
+    if (!acq->pending) {
+        return res;
+    }
+
+    if ((XENSIV_PAS_GAS_OK == res) && !acq->calibrated && !acq->late) {
+        /* min_offset_us is a lower bound, a result found by the first read predates the EARLY edge */
+        acq->late = true;
+        acq->due_us = time_us + acq->config.poll_us;
+        res = XENSIV_PAS_GAS_READ_NRDY;
+    } else if (XENSIV_PAS_GAS_OK == res) {
+        uint64_t elapsed_us = (time_us > acq->early_us) ? (time_us - acq->early_us) : 0U;
+
+        if (!acq->calibrated || acq->late) {
+            /* The result appeared within the last poll interval */
+            acq->offset_us = (elapsed_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed_us;
+            acq->calibrated = true;
+        } else {
+            /* Probe whether the result is ready earlier */
+            acq->offset_us = (acq->offset_us > acq->config.decay_us) ? (acq->offset_us - acq->config.decay_us) : 0U;
+        }
+        acq->pending = false;
+    } else if (XENSIV_PAS_GAS_READ_NRDY == res) {
+        acq->late = true;
+        acq->due_us = time_us + acq->config.poll_us;
+    } else {
+        /* Communication error, the read is retried at the next poll interval */
+        acq->due_us = time_us + acq->config.poll_us;
+    }
+
+    return res;
+}
+
+uint64_t xensiv_pas_gas_early_get_due_us(const xensiv_pas_gas_early_t *acq) {
+    xensiv_pas_gas_plat_assert(acq != NULL);
+
+    return acq->pending ? acq->due_us : UINT64_MAX;
+}
+
+uint32_t xensiv_pas_gas_early_get_offset_us(const xensiv_pas_gas_early_t *acq) {
+    xensiv_pas_gas_plat_assert(acq != NULL);
+
+    return acq->calibrated ? acq->offset_us : 0U;
+}
@@ -0,0 +1,160 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_early.h
+ *
+ * Description: This file contains the EARLY notification driven result acquisition of the
+ *              XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_EARLY_H_
+#define XENSIV_PAS_GAS_EARLY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_early XENSIV™ PAS GAS sensor EARLY driven acquisition
+ * \{
+ * Acquisition of the continuous mode results scheduled from the EARLY notification.
+ *
+ * In continuous mode the INT pin configured with \ref XENSIV_PAS_GAS_INTERRUPT_FUNCTION_EARLY signals
+ * that a measurement sequence is about to start. The result becomes available a fixed, sensor specific
+ * time later. The acquisition learns this EARLY-to-DRDY offset and returns, at each EARLY edge, the time at
+ * which the result can be read. The read is thus scheduled about two seconds ahead, which allows
+ * reserving a slot for it on a shared bus, and MEAS_STS is not polled.
+ *
+ * The offset is measured at the first measurement by reading MEAS_STS every poll_us from min_offset_us on;
+ * a result already available at min_offset_us predates the EARLY edge and is discarded.
+ * Afterwards, each read on time lowers the estimate by decay_us; once a read comes too early, MEAS_STS is
+ * read again every poll_us and the estimate is set to the time the result was found. The estimate thus
+ * follows the offset of the sensor in both directions, at the cost of one additional MEAS_STS read every
+ * (guard_us + poll_us) / decay_us measurements.
+ *
+ * The timestamps are passed by the application, in microseconds of any monotonic clock:
+ * \code
+ *  // INT pin interrupt
+ *  due_us = xensiv_pas_gas_early_on_edge(&acq, now_us());
+ *
+ *  // Timer expired at due_us
+ *  if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_early_read(&acq, now_us(), &val)) {
+ *      ...
+ *  } else {
+ *      due_us = xensiv_pas_gas_early_get_due_us(&acq);
+ *  }
+ * \endcode
+ */
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the EARLY driven acquisition */
+typedef struct
+{
+    uint32_t min_offset_us;                 /*!< Lower bound of the EARLY-to-DRDY offset, from which the first measurement is polled */
+    uint32_t guard_us;                      /*!< Margin added to the estimated offset when scheduling a read */
+    uint32_t poll_us;                       /*!< Interval between MEAS_STS reads while the result is not ready */
+    uint32_t decay_us;                      /*!< Amount the estimated offset is lowered after each read on time */
+} xensiv_pas_gas_early_config_t;
+
+/** State of the EARLY driven acquisition. The members are private to the acquisition. */
+typedef struct
+{
+    const xensiv_pas_gas_t *dev;            /*!< Sensor device */
+    xensiv_pas_gas_early_config_t config;   /*!< Configuration */
+    uint32_t offset_us;                     /*!< Estimated EARLY-to-DRDY offset */
+    bool calibrated;                        /*!< The offset has been measured */
+    bool pending;                           /*!< A read is scheduled */
+    bool late;                              /*!< The scheduled read found no result */
+    uint64_t early_us;                      /*!< Time of the last EARLY edge */
+    uint64_t due_us;                        /*!< Time of the scheduled read */
+} xensiv_pas_gas_early_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default configuration.
+ * min_offset_us 1 s, the lead of the EARLY notification; guard_us 20 ms; poll_us 10 ms; decay_us 1 ms.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_early_get_default_config(xensiv_pas_gas_early_config_t *config);
+
+/**
+ * @brief Configures the INT pin for the EARLY notification and starts the continuous mode.
+ * The interrupt active level and the alarm type are kept.
+ *
+ * @param[out] acq Acquisition state allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] config Acquisition configuration
+ * @param[in] rate_s Measurement rate in seconds
+ * @return XENSIV_PAS_GAS_OK if the continuous mode was started; XENSIV_PAS_GAS_INVALID_PARAMETER if poll_us is 0;
+ * an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_early_start(xensiv_pas_gas_early_t *acq, const xensiv_pas_gas_t *dev, const xensiv_pas_gas_early_config_t *config, uint16_t rate_s);
+
+/**
+ * @brief Notifies the acquisition of an EARLY edge on the INT pin and schedules the result read.
+ * A read still pending from the previous measurement is dropped. The function does not access the bus
+ * and can be called from the interrupt handler.
+ *
+ * @param[in] acq Acquisition state
+ * @param[in] time_us Time of the edge
+ * @return Time at which \ref xensiv_pas_gas_early_read must be called
+ */
+uint64_t xensiv_pas_gas_early_on_edge(xensiv_pas_gas_early_t *acq, uint64_t time_us);
+
+/**
+ * @brief Reads the result of the scheduled read.
+ *
+ * @param[in] acq Acquisition state
+ * @param[in] time_us Current time
+ * @param[out] val Pointer to populate with the gas concentration
+ * @return XENSIV_PAS_GAS_OK if the result was read; XENSIV_PAS_GAS_READ_NRDY if the result is not ready yet, the read
+ * is then scheduled again at \ref xensiv_pas_gas_early_get_due_us; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_early_read(xensiv_pas_gas_early_t *acq, uint64_t time_us, uint16_t *val);
+
+/**
+ * @brief Gets the time of the scheduled read
+ *
+ * @param[in] acq Acquisition state
+ * @return Time at which \ref xensiv_pas_gas_early_read must be called; UINT64_MAX if no read is scheduled
+ */
+uint64_t xensiv_pas_gas_early_get_due_us(const xensiv_pas_gas_early_t *acq);
+
+/**
+ * @brief Gets the estimated EARLY-to-DRDY offset of the sensor
+ *
+ * @param[in] acq Acquisition state
+ * @return Offset in microseconds; 0 until it has been measured
+ */
+uint32_t xensiv_pas_gas_early_get_offset_us(const xensiv_pas_gas_early_t *acq);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_early */
+
+#endif /* XENSIV_PAS_GAS_EARLY_H_ */
@@ -0,0 +1,904 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_emul.c
+ *
+ * Description: Register-level emulator of the XENSIV™ PAS GAS sensor family implementing
+ *              the platform functions on host machines.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <assert.h>
+#include <string.h>
+
+#include "xensiv_pas_gas_emul.h"
+#include "xensiv_pas_gas_co2.h"
+#include "xensiv_pas_gas_r290.h"
+#include "xensiv_pas_gas_a2l.h"
+
+#define XENSIV_PAS_GAS_EMUL_NS_PER_MS            (1000000ULL)
+#define XENSIV_PAS_GAS_EMUL_NS_PER_US            (1000ULL)
+#define XENSIV_PAS_GAS_EMUL_NEVER                (UINT64_MAX)
+
+#define XENSIV_PAS_GAS_EMUL_UART_ACK             (0x06U)
+#define XENSIV_PAS_GAS_EMUL_UART_NAK             (0x15U)
+
+/* Register access classes */
+#define XENSIV_PAS_GAS_EMUL_ACC_NONE             (0U)
+#define XENSIV_PAS_GAS_EMUL_ACC_RO               (1U)
+#define XENSIV_PAS_GAS_EMUL_ACC_WO               (2U)
+#define XENSIV_PAS_GAS_EMUL_ACC_RW               (3U)
+
+static uint64_t xensiv_pas_gas_emul_clock_ns = 0U;
+static xensiv_pas_gas_emul_t *xensiv_pas_gas_emul_list = NULL;
+static xensiv_pas_gas_emul_bus_stats_t xensiv_pas_gas_emul_bus_stats;
+
+static void xensiv_pas_gas_emul_run_until(uint64_t target_ns);
+
+static uint8_t xensiv_pas_gas_emul_access(const xensiv_pas_gas_emul_t *emul, uint8_t reg_addr) {
+    if (reg_addr <= XENSIV_PAS_GAS_REG_SENS_RST) {
+        switch (reg_addr)
+        {
+            case XENSIV_PAS_GAS_REG_PROD_ID:
+            case XENSIV_PAS_GAS_REG_GASCONC_H:
+            case XENSIV_PAS_GAS_REG_GASCONC_L:
+                return XENSIV_PAS_GAS_EMUL_ACC_RO;
+            case XENSIV_PAS_GAS_REG_SENS_RST:
+                return XENSIV_PAS_GAS_EMUL_ACC_WO;
+            default:
+                return XENSIV_PAS_GAS_EMUL_ACC_RW;
+        }
+    }
+
+    if (XENSIV_PAS_GAS_VARIANT_A2L == emul->variant) {
+        switch (reg_addr)
+        {
+            case XENSIV_PAS_GAS_A2L_REG_CFG_SAVE:
+            case XENSIV_PAS_GAS_A2L_REG_SELF_TEST_CLR:
+                return XENSIV_PAS_GAS_EMUL_ACC_WO;
+            case XENSIV_PAS_GAS_A2L_REG_DEV_ID:
+            case XENSIV_PAS_GAS_A2L_REG_SELF_TEST:
+                return XENSIV_PAS_GAS_EMUL_ACC_RO;
+            case XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX:
+            case XENSIV_PAS_GAS_A2L_REG_ABOC_PREFILL:
+            case XENSIV_PAS_GAS_A2L_REG_GAS_CFG:
+            case XENSIV_PAS_GAS_A2L_REG_ALARM_CFG:
+            case XENSIV_PAS_GAS_A2L_REG_DENOISE_CFG:
+            case XENSIV_PAS_GAS_A2L_REG_ABOC_CYCLE:
+            case XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_H:
+            case XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_L:
+            case XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H:
+            case XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_L:
+            case XENSIV_PAS_GAS_A2L_REG_HC_CTRL:
+                return XENSIV_PAS_GAS_EMUL_ACC_RW;
+            default:
+                return XENSIV_PAS_GAS_EMUL_ACC_NONE;
+        }
+    }
+
+    if (XENSIV_PAS_GAS_VARIANT_R290 == emul->variant) {
+        switch (reg_addr)
+        {
+            case XENSIV_PAS_GAS_R290_REG_SELF_TEST_CLR:
+                return XENSIV_PAS_GAS_EMUL_ACC_WO;
+            case XENSIV_PAS_GAS_R290_REG_DEV_ID:
+            case XENSIV_PAS_GAS_R290_REG_SELF_TEST:
+                return XENSIV_PAS_GAS_EMUL_ACC_RO;
+            case XENSIV_PAS_GAS_R290_REG_ABOC_PREFILL:
+            case XENSIV_PAS_GAS_R290_REG_ALARM_CFG:
+            case XENSIV_PAS_GAS_R290_REG_DENOISE_CFG:
+            case XENSIV_PAS_GAS_R290_REG_ABOC_CYCLE:
+                return XENSIV_PAS_GAS_EMUL_ACC_RW;
+            default:
+                return XENSIV_PAS_GAS_EMUL_ACC_NONE;
+        }
+    }
+
+    return XENSIV_PAS_GAS_EMUL_ACC_NONE;
+}
+
+static void xensiv_pas_gas_emul_load_defaults(xensiv_pas_gas_emul_t *emul) {
+    uint8_t *regs = emul->regs;
+
+    (void)memset(regs, 0, sizeof(emul->regs));
+
+    regs[XENSIV_PAS_GAS_REG_MEAS_RATE_H] = 0x00U;
+    regs[XENSIV_PAS_GAS_REG_MEAS_RATE_L] = 0x3CU;
+    regs[XENSIV_PAS_GAS_REG_MEAS_CFG] = (uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS);
+    regs[XENSIV_PAS_GAS_REG_PRESS_REF_H] = 0x03U;
+    regs[XENSIV_PAS_GAS_REG_PRESS_REF_L] = 0xF7U;
+
+    switch (emul->variant)
+    {
+        case XENSIV_PAS_GAS_VARIANT_CO2:
+            regs[XENSIV_PAS_GAS_REG_PROD_ID] = 0x42U;
+            regs[XENSIV_PAS_GAS_REG_MEAS_CFG] |= (uint8_t)XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_OUTEN_MSK;
+            regs[XENSIV_PAS_GAS_REG_CALIB_REF_H] = 0x01U;
+            regs[XENSIV_PAS_GAS_REG_CALIB_REF_L] = 0x90U;
+            break;
+        case XENSIV_PAS_GAS_VARIANT_R290:
+            regs[XENSIV_PAS_GAS_REG_PROD_ID] = 0x62U;
+            regs[XENSIV_PAS_GAS_R290_REG_ABOC_CYCLE] = 0x07U;
+            break;
+        case XENSIV_PAS_GAS_VARIANT_A2L:
+            regs[XENSIV_PAS_GAS_REG_PROD_ID] = 0x82U;
+            regs[XENSIV_PAS_GAS_A2L_REG_GAS_CFG] = (uint8_t)(0x03U << XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_AVAIL_POS);
+            regs[XENSIV_PAS_GAS_A2L_REG_ABOC_CYCLE] = 0x07U;
+            break;
+        default:
+            regs[XENSIV_PAS_GAS_REG_PROD_ID] = 0x22U;
+            break;
+    }
+}
+
+static bool xensiv_pas_gas_emul_is_config_reg(const xensiv_pas_gas_emul_t *emul, uint8_t reg_addr) {
+    if ((reg_addr >= XENSIV_PAS_GAS_REG_MEAS_RATE_H) && (reg_addr <= XENSIV_PAS_GAS_REG_MEAS_CFG)) {
+        return true;
+    }
+    if ((reg_addr >= XENSIV_PAS_GAS_REG_INT_CFG) && (reg_addr <= XENSIV_PAS_GAS_REG_CALIB_REF_L)) {
+        return true;
+    }
+    return (reg_addr > XENSIV_PAS_GAS_REG_SENS_RST) &&
+           (XENSIV_PAS_GAS_EMUL_ACC_RW == xensiv_pas_gas_emul_access(emul, reg_addr)) &&
+           (XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX != reg_addr);
+}
+
+static uint16_t xensiv_pas_gas_emul_meas_rate(const xensiv_pas_gas_emul_t *emul) {
+    uint16_t rate = (uint16_t)(((uint16_t)emul->regs[XENSIV_PAS_GAS_REG_MEAS_RATE_H] << 8) | emul->regs[XENSIV_PAS_GAS_REG_MEAS_RATE_L]);
+    return (rate == 0U) ? 1U : rate;
+}
+
+static uint8_t xensiv_pas_gas_emul_op_mode(const xensiv_pas_gas_emul_t *emul) {
+    return (uint8_t)((emul->regs[XENSIV_PAS_GAS_REG_MEAS_CFG] & XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK) >> XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_POS);
+}
+
+static uint8_t xensiv_pas_gas_emul_boc_cfg(const xensiv_pas_gas_emul_t *emul) {
+    return (uint8_t)((emul->regs[XENSIV_PAS_GAS_REG_MEAS_CFG] & XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_MSK) >> XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS);
+}
+
+static uint8_t xensiv_pas_gas_emul_int_func(const xensiv_pas_gas_emul_t *emul) {
+    return (uint8_t)((emul->regs[XENSIV_PAS_GAS_REG_INT_CFG] & XENSIV_PAS_GAS_REG_INT_CFG_INT_FUNC_MSK) >> XENSIV_PAS_GAS_REG_INT_CFG_INT_FUNC_POS);
+}
+
+static uint16_t xensiv_pas_gas_emul_trace_value(const xensiv_pas_gas_emul_t *emul) {
+    if ((emul->trace == NULL) || (emul->trace_len == 0U)) {
+        return emul->gas_val;
+    }
+
+    const xensiv_pas_gas_emul_trace_point_t *points = emul->trace;
+    size_t len = emul->trace_len;
+    uint64_t t_ms = (xensiv_pas_gas_emul_clock_ns - emul->trace_start_ns) / XENSIV_PAS_GAS_EMUL_NS_PER_MS;
+
+    if (emul->trace_loop && (points[len - 1U].t_ms > 0U)) {
+        t_ms %= (uint64_t)points[len - 1U].t_ms;
+    }
+
+    if (t_ms <= points[0].t_ms) {
+        return points[0].val;
+    }
+
+    for (size_t i = 1U; i < len; ++i)
+    {
+        if (t_ms <= points[i].t_ms) {
+            int64_t dt = (int64_t)points[i].t_ms - (int64_t)points[i - 1U].t_ms;
+            int64_t dv = (int64_t)points[i].val - (int64_t)points[i - 1U].val;
+            int64_t off = (int64_t)t_ms - (int64_t)points[i - 1U].t_ms;
+            return (uint16_t)((int64_t)points[i - 1U].val + ((dt > 0) ? ((dv * off) / dt) : dv));
+        }
+    }
+
+    return points[len - 1U].val;
+}
+
+static bool xensiv_pas_gas_emul_int_active(const xensiv_pas_gas_emul_t *emul) {
+    uint8_t meas_sts = emul->regs[XENSIV_PAS_GAS_REG_MEAS_STS];
+
+    switch (xensiv_pas_gas_emul_int_func(emul))
+    {
+        case XENSIV_PAS_GAS_INTERRUPT_FUNCTION_ALARM:
+            return (meas_sts & XENSIV_PAS_GAS_REG_MEAS_STS_ALARM_MSK) != 0U;
+        case XENSIV_PAS_GAS_INTERRUPT_FUNCTION_DRDY:
+            return (meas_sts & XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK) != 0U;
+        case XENSIV_PAS_GAS_INTERRUPT_FUNCTION_BUSY:
+            return emul->measuring;
+        case XENSIV_PAS_GAS_INTERRUPT_FUNCTION_EARLY:
+            return emul->early;
+        default:
+            return false;
+    }
+}
+
+static void xensiv_pas_gas_emul_update_int_pin(xensiv_pas_gas_emul_t *emul) {
+    bool active = xensiv_pas_gas_emul_int_active(emul);
+    bool high_active = (emul->regs[XENSIV_PAS_GAS_REG_INT_CFG] & XENSIV_PAS_GAS_REG_INT_CFG_INT_TYP_MSK) != 0U;
+    bool level = (active == high_active);
+
+    if (active) {
+        emul->regs[XENSIV_PAS_GAS_REG_MEAS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_MEAS_STS_INT_STS_MSK;
+    }
+
+    if (level != emul->int_level) {
+        emul->int_level = level;
+        if (emul->int_cb != NULL) {
+            emul->int_cb(emul, level, xensiv_pas_gas_emul_clock_ns / XENSIV_PAS_GAS_EMUL_NS_PER_US, emul->int_cb_arg);
+        }
+    }
+}
+
+static void xensiv_pas_gas_emul_complete_measurement(xensiv_pas_gas_emul_t *emul) {
+    uint8_t *regs = emul->regs;
+    int32_t raw = (int32_t)xensiv_pas_gas_emul_trace_value(emul);
+    int32_t val = raw + emul->fcs_offset;
+
+    emul->measuring = false;
+
+    if (val < 0) {
+        val = 0;
+    } else if (val > (int32_t)UINT16_MAX) {
+        val = (int32_t)UINT16_MAX;
+    }
+
+    regs[XENSIV_PAS_GAS_REG_GASCONC_H] = (uint8_t)((uint32_t)val >> 8);
+    regs[XENSIV_PAS_GAS_REG_GASCONC_L] = (uint8_t)((uint32_t)val & 0xFFU);
+    regs[XENSIV_PAS_GAS_REG_MEAS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK;
+
+    uint16_t th = (uint16_t)(((uint16_t)regs[XENSIV_PAS_GAS_REG_ALARM_TH_H] << 8) | regs[XENSIV_PAS_GAS_REG_ALARM_TH_L]);
+    bool low_to_high = (regs[XENSIV_PAS_GAS_REG_INT_CFG] & XENSIV_PAS_GAS_REG_INT_CFG_ALARM_TYP_MSK) != 0U;
+    if ((th != 0U) && ((low_to_high && ((uint32_t)val > th)) || (!low_to_high && ((uint32_t)val < th)))) {
+        regs[XENSIV_PAS_GAS_REG_MEAS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_MEAS_STS_ALARM_MSK;
+    }
+
+    if (XENSIV_PAS_GAS_BOC_CFG_FORCED == xensiv_pas_gas_emul_boc_cfg(emul)) {
+        if (emul->fcs_remaining > 0U) {
+            emul->fcs_remaining--;
+        }
+        if (emul->fcs_remaining == 0U) {
+            uint16_t ref = (uint16_t)(((uint16_t)regs[XENSIV_PAS_GAS_REG_CALIB_REF_H] << 8) | regs[XENSIV_PAS_GAS_REG_CALIB_REF_L]);
+            emul->fcs_offset = (int32_t)ref - raw;
+            regs[XENSIV_PAS_GAS_REG_MEAS_CFG] &= (uint8_t) ~XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_MSK;
+        }
+    }
+
+    if (XENSIV_PAS_GAS_OP_MODE_SINGLE == xensiv_pas_gas_emul_op_mode(emul)) {
+        regs[XENSIV_PAS_GAS_REG_MEAS_CFG] &= (uint8_t) ~XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK;
+    }
+}
+
+static void xensiv_pas_gas_emul_start_measurement(xensiv_pas_gas_emul_t *emul, uint64_t start_ns) {
+    emul->measuring = true;
+    emul->early = false;
+    emul->meas_end_ns = start_ns + ((uint64_t)emul->timing.meas_duration_ms * XENSIV_PAS_GAS_EMUL_NS_PER_MS);
+}
+
+static uint64_t xensiv_pas_gas_emul_early_ns(const xensiv_pas_gas_emul_t *emul) {
+    uint64_t lead = (uint64_t)emul->timing.early_lead_ms * XENSIV_PAS_GAS_EMUL_NS_PER_MS;
+    return (emul->next_start_ns > lead) ? (emul->next_start_ns - lead) : 0U;
+}
+
+static uint64_t xensiv_pas_gas_emul_next_event_ns(const xensiv_pas_gas_emul_t *emul) {
+    uint64_t next = XENSIV_PAS_GAS_EMUL_NEVER;
+
+    if (!emul->ready && (emul->boot_done_ns < next)) {
+        next = emul->boot_done_ns;
+    }
+
+    if (emul->measuring) {
+        if (emul->meas_end_ns < next) {
+            next = emul->meas_end_ns;
+        }
+    } else if (XENSIV_PAS_GAS_OP_MODE_CONTINUOUS == xensiv_pas_gas_emul_op_mode(emul)) {
+        if ((XENSIV_PAS_GAS_INTERRUPT_FUNCTION_EARLY == xensiv_pas_gas_emul_int_func(emul)) && !emul->early &&
+            (xensiv_pas_gas_emul_early_ns(emul) < next)) {
+            next = xensiv_pas_gas_emul_early_ns(emul);
+        }
+        if (emul->next_start_ns < next) {
+            next = emul->next_start_ns;
+        }
+    }
+
+    return next;
+}
+
+static void xensiv_pas_gas_emul_process(xensiv_pas_gas_emul_t *emul) {
+    uint64_t now = xensiv_pas_gas_emul_clock_ns;
+    bool progressed;
+
+    do
+    {
+        progressed = false;
+
+        if (!emul->ready && (now >= emul->boot_done_ns)) {
+            emul->ready = true;
+            emul->regs[XENSIV_PAS_GAS_REG_SENS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK;
+            progressed = true;
+        }
+
+        if (emul->measuring && (now >= emul->meas_end_ns)) {
+            xensiv_pas_gas_emul_complete_measurement(emul);
+            progressed = true;
+        }
+
+        if (!emul->measuring && (XENSIV_PAS_GAS_OP_MODE_CONTINUOUS == xensiv_pas_gas_emul_op_mode(emul))) {
+            if (now >= emul->next_start_ns) {
+                uint64_t start = emul->next_start_ns;
+                emul->next_start_ns += (uint64_t)xensiv_pas_gas_emul_meas_rate(emul) * 1000U * XENSIV_PAS_GAS_EMUL_NS_PER_MS;
+                xensiv_pas_gas_emul_start_measurement(emul, start);
+                progressed = true;
+            } else if (!emul->early && (XENSIV_PAS_GAS_INTERRUPT_FUNCTION_EARLY == xensiv_pas_gas_emul_int_func(emul)) &&
+                       (now >= xensiv_pas_gas_emul_early_ns(emul))) {
+                emul->early = true;
+                progressed = true;
+            }
+        }
+
+        xensiv_pas_gas_emul_update_int_pin(emul);
+    } while (progressed);
+}
+
+static void xensiv_pas_gas_emul_run_until(uint64_t target_ns) {
+    for (;;)
+    {
+        xensiv_pas_gas_emul_t *first = NULL;
+        uint64_t first_ns = target_ns;
+
+        for (xensiv_pas_gas_emul_t *emul = xensiv_pas_gas_emul_list; emul != NULL; emul = emul->next)
+        {
+            uint64_t ev = xensiv_pas_gas_emul_next_event_ns(emul);
+            if (ev <= first_ns) {
+                first_ns = ev;
+                first = emul;
+            }
+        }
+
+        if (first == NULL) {
+            break;
+        }
+
+        if (first_ns > xensiv_pas_gas_emul_clock_ns) {
+            xensiv_pas_gas_emul_clock_ns = first_ns;
+        }
+        xensiv_pas_gas_emul_process(first);
+    }
+
+    if (target_ns > xensiv_pas_gas_emul_clock_ns) {
+        xensiv_pas_gas_emul_clock_ns = target_ns;
+    }
+}
+
+static void xensiv_pas_gas_emul_reset(xensiv_pas_gas_emul_t *emul) {
+    xensiv_pas_gas_emul_load_defaults(emul);
+
+    if (emul->nvm_valid) {
+        for (uint8_t reg = 0U; reg < XENSIV_PAS_GAS_EMUL_REG_MAP_SIZE; ++reg)
+        {
+            if (xensiv_pas_gas_emul_is_config_reg(emul, reg)) {
+                emul->regs[reg] = emul->nvm[reg];
+            }
+        }
+        /* The sensor always starts in idle mode */
+        emul->regs[XENSIV_PAS_GAS_REG_MEAS_CFG] &= (uint8_t) ~XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK;
+    }
+
+    emul->fcs_offset = emul->nvm_fcs_offset;
+    emul->reg_ptr = 0U;
+    emul->ready = false;
+    emul->measuring = false;
+    emul->early = false;
+    emul->fcs_remaining = 0U;
+    emul->boot_done_ns = xensiv_pas_gas_emul_clock_ns + ((uint64_t)emul->timing.boot_ms * XENSIV_PAS_GAS_EMUL_NS_PER_MS);
+    emul->busy_until_ns = 0U;
+    emul->uart_cmd_len = 0U;
+    emul->uart_resp_len = 0U;
+    emul->uart_resp_pos = 0U;
+
+    xensiv_pas_gas_emul_update_int_pin(emul);
+}
+
+static void xensiv_pas_gas_emul_command(xensiv_pas_gas_emul_t *emul, uint8_t cmd) {
+    switch (cmd)
+    {
+        case XENSIV_PAS_GAS_CMD_SOFT_RESET:
+            xensiv_pas_gas_emul_reset(emul);
+            break;
+        case XENSIV_PAS_GAS_CO2_CMD_RESET_ABOC:
+            break;
+        case XENSIV_PAS_GAS_CO2_CMD_SAVE_FCS_CALIB_OFFSET:
+            emul->nvm_fcs_offset = emul->fcs_offset;
+            break;
+        case XENSIV_PAS_GAS_CO2_CMD_RESET_FCS:
+            emul->fcs_offset = 0;
+            emul->nvm_fcs_offset = 0;
+            break;
+        default:
+            emul->regs[XENSIV_PAS_GAS_REG_SENS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK;
+            break;
+    }
+}
+
+static void xensiv_pas_gas_emul_write_meas_cfg(xensiv_pas_gas_emul_t *emul, uint8_t val) {
+    uint8_t old_mode = xensiv_pas_gas_emul_op_mode(emul);
+    uint8_t old_boc = xensiv_pas_gas_emul_boc_cfg(emul);
+    uint8_t mask = (XENSIV_PAS_GAS_VARIANT_CO2 == emul->variant) ? 0x3FU : 0x0FU;
+
+    emul->regs[XENSIV_PAS_GAS_REG_MEAS_CFG] = (uint8_t)(val & mask);
+
+    uint8_t new_mode = xensiv_pas_gas_emul_op_mode(emul);
+
+    if ((XENSIV_PAS_GAS_BOC_CFG_FORCED == xensiv_pas_gas_emul_boc_cfg(emul)) && (XENSIV_PAS_GAS_BOC_CFG_FORCED != old_boc)) {
+        emul->fcs_remaining = emul->timing.fcs_cycles;
+    }
+
+    if (new_mode == old_mode) {
+        return;
+    }
+
+    emul->measuring = false;
+    emul->early = false;
+
+    if (XENSIV_PAS_GAS_OP_MODE_SINGLE == new_mode) {
+        xensiv_pas_gas_emul_start_measurement(emul, xensiv_pas_gas_emul_clock_ns);
+    } else if (XENSIV_PAS_GAS_OP_MODE_CONTINUOUS == new_mode) {
+        emul->next_start_ns = xensiv_pas_gas_emul_clock_ns;
+    }
+}
+
+static void xensiv_pas_gas_emul_write_reg(xensiv_pas_gas_emul_t *emul, uint8_t reg_addr, uint8_t val) {
+    uint8_t *regs = emul->regs;
+    uint8_t acc = xensiv_pas_gas_emul_access(emul, reg_addr);
+
+    if ((XENSIV_PAS_GAS_EMUL_ACC_WO != acc) && (XENSIV_PAS_GAS_EMUL_ACC_RW != acc)) {
+        regs[XENSIV_PAS_GAS_REG_SENS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK;
+        return;
+    }
+
+    switch (reg_addr)
+    {
+        case XENSIV_PAS_GAS_REG_SENS_STS:
+            if ((val & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_CLR_MSK) != 0U) {
+                regs[reg_addr] &= (uint8_t) ~XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK;
+            }
+            if ((val & XENSIV_PAS_GAS_REG_SENS_STS_ORVS_CLR_MSK) != 0U) {
+                regs[reg_addr] &= (uint8_t) ~XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK;
+            }
+            if ((val & XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_CLR_MSK) != 0U) {
+                regs[reg_addr] &= (uint8_t) ~XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK;
+            }
+            break;
+        case XENSIV_PAS_GAS_REG_MEAS_RATE_H:
+            regs[reg_addr] = (uint8_t)(val & 0x0FU);
+            break;
+        case XENSIV_PAS_GAS_REG_MEAS_CFG:
+            xensiv_pas_gas_emul_write_meas_cfg(emul, val);
+            break;
+        case XENSIV_PAS_GAS_REG_MEAS_STS:
+            if ((val & XENSIV_PAS_GAS_REG_MEAS_STS_ALARM_CLR_MSK) != 0U) {
+                regs[reg_addr] &= (uint8_t) ~XENSIV_PAS_GAS_REG_MEAS_STS_ALARM_MSK;
+            }
+            if ((val & XENSIV_PAS_GAS_REG_MEAS_STS_INT_STS_CLR_MSK) != 0U) {
+                regs[reg_addr] &= (uint8_t) ~XENSIV_PAS_GAS_REG_MEAS_STS_INT_STS_MSK;
+            }
+            break;
+        case XENSIV_PAS_GAS_REG_INT_CFG:
+            regs[reg_addr] = (uint8_t)(val & 0x1FU);
+            break;
+        case XENSIV_PAS_GAS_REG_SENS_RST:
+            xensiv_pas_gas_emul_command(emul, val);
+            break;
+        case XENSIV_PAS_GAS_A2L_REG_CFG_SAVE:
+            (void)memcpy(emul->nvm, regs, sizeof(emul->nvm));
+            emul->nvm_valid = true;
+            emul->busy_until_ns = xensiv_pas_gas_emul_clock_ns + ((uint64_t)emul->timing.cfg_save_ms * XENSIV_PAS_GAS_EMUL_NS_PER_MS);
+            break;
+        case XENSIV_PAS_GAS_A2L_REG_GAS_CFG:
+            regs[reg_addr] = (uint8_t)((regs[reg_addr] & XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_AVAIL_MASK) |
+                                       (val & XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_SEL_MASK));
+            break;
+        case XENSIV_PAS_GAS_A2L_REG_SELF_TEST_CLR:
+            regs[XENSIV_PAS_GAS_A2L_REG_SELF_TEST] &= (uint8_t) ~(val & 0x1FU);
+            break;
+        case XENSIV_PAS_GAS_A2L_REG_HC_CTRL:
+            regs[reg_addr] = (uint8_t)((regs[reg_addr] & 0x18U) | (val & 0x01U));
+            if ((val & 0x02U) != 0U) {
+                regs[reg_addr] &= (uint8_t) ~0x04U;
+            }
+            break;
+        default:
+            regs[reg_addr] = val;
+            break;
+    }
+
+    xensiv_pas_gas_emul_update_int_pin(emul);
+}
+
+static uint8_t xensiv_pas_gas_emul_read_reg(xensiv_pas_gas_emul_t *emul, uint8_t reg_addr) {
+    uint8_t *regs = emul->regs;
+    uint8_t acc = xensiv_pas_gas_emul_access(emul, reg_addr);
+    uint8_t val;
+
+    if ((XENSIV_PAS_GAS_EMUL_ACC_RO != acc) && (XENSIV_PAS_GAS_EMUL_ACC_RW != acc)) {
+        return 0U;
+    }
+
+    if ((XENSIV_PAS_GAS_VARIANT_A2L == emul->variant) && (XENSIV_PAS_GAS_A2L_REG_DEV_ID == reg_addr)) {
+        return emul->dev_id[regs[XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX] % XENSIV_PAS_GAS_EMUL_DEV_ID_LEN];
+    }
+
+    if ((XENSIV_PAS_GAS_VARIANT_R290 == emul->variant) && (XENSIV_PAS_GAS_R290_REG_DEV_ID == reg_addr)) {
+        return emul->dev_id[0];
+    }
+
+    val = regs[reg_addr];
+
+    if (XENSIV_PAS_GAS_REG_MEAS_STS == reg_addr) {
+        /* DRDY is cleared by reading the measurement status */
+        regs[reg_addr] &= (uint8_t) ~XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK;
+        xensiv_pas_gas_emul_update_int_pin(emul);
+    }
+
+    return val;
+}
+
+static inline uint8_t xensiv_pas_gas_emul_hex_digit(uint8_t digit) {
+    return (digit < 10U) ? (uint8_t)(digit + (uint8_t)'0') : (uint8_t)(digit - 10U + (uint8_t)'A');
+}
+
+static bool xensiv_pas_gas_emul_parse_hex(const uint8_t *ascii, uint8_t *val) {
+    uint8_t res = 0U;
+
+    for (uint8_t i = 0U; i < 2U; ++i)
+    {
+        uint8_t c = ascii[i];
+        res = (uint8_t)(res << 4);
+        if ((c >= (uint8_t)'0') && (c <= (uint8_t)'9')) {
+            res |= (uint8_t)(c - (uint8_t)'0');
+        } else if ((c >= (uint8_t)'A') && (c <= (uint8_t)'F')) {
+            res |= (uint8_t)(c - (uint8_t)'A' + 10U);
+        } else {
+            return false;
+        }
+    }
+
+    *val = res;
+    return true;
+}
+
+static void xensiv_pas_gas_emul_uart_execute(xensiv_pas_gas_emul_t *emul) {
+    const uint8_t *cmd = emul->uart_cmd;
+    size_t len = emul->uart_cmd_len;
+    uint8_t reg_addr;
+    uint8_t val;
+
+    emul->uart_cmd_len = 0U;
+    emul->uart_resp_pos = 0U;
+    emul->uart_resp_len = 0U;
+
+    if ((emul->comm_errors > 0U) || ((emul->write_errors > 0U) && (cmd[0] == (uint8_t)'w'))) {
+        if (emul->comm_errors > 0U) {
+            emul->comm_errors--;
+        } else {
+            emul->write_errors--;
+        }
+        if (cmd[0] == (uint8_t)'w') {
+            emul->uart_resp[0] = XENSIV_PAS_GAS_EMUL_UART_NAK;
+            emul->uart_resp[1] = (uint8_t)'\n';
+            emul->uart_resp_len = 2U;
+        }
+        return;
+    }
+
+    if ((len == 5U) && (cmd[0] == (uint8_t)'r') && (cmd[1] == (uint8_t)',') && xensiv_pas_gas_emul_parse_hex(&cmd[2], &reg_addr)) {
+        val = xensiv_pas_gas_emul_read_reg(emul, reg_addr);
+        emul->uart_resp[0] = xensiv_pas_gas_emul_hex_digit((uint8_t)(val >> 4));
+        emul->uart_resp[1] = xensiv_pas_gas_emul_hex_digit((uint8_t)(val & 0x0FU));
+        emul->uart_resp[2] = (uint8_t)'\n';
+        emul->uart_resp_len = 3U;
+    } else if ((len == 8U) && (cmd[0] == (uint8_t)'w') && (cmd[1] == (uint8_t)',') && (cmd[4] == (uint8_t)',') &&
+               xensiv_pas_gas_emul_parse_hex(&cmd[2], &reg_addr) && xensiv_pas_gas_emul_parse_hex(&cmd[5], &val)) {
+        xensiv_pas_gas_emul_write_reg(emul, reg_addr, val);
+        /* A soft reset does not acknowledge the command */
+        if ((XENSIV_PAS_GAS_REG_SENS_RST != reg_addr) || ((uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET != val)) {
+            emul->uart_resp[0] = XENSIV_PAS_GAS_EMUL_UART_ACK;
+            emul->uart_resp[1] = (uint8_t)'\n';
+            emul->uart_resp_len = 2U;
+        }
+    } else {
+        emul->regs[XENSIV_PAS_GAS_REG_SENS_STS] |= (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK;
+        emul->uart_resp[0] = XENSIV_PAS_GAS_EMUL_UART_NAK;
+        emul->uart_resp[1] = (uint8_t)'\n';
+        emul->uart_resp_len = 2U;
+    }
+}
+
+static void xensiv_pas_gas_emul_bus_time(uint32_t byte_ns, size_t bytes) {
+    xensiv_pas_gas_emul_bus_stats.bytes += bytes;
+    xensiv_pas_gas_emul_bus_stats.bus_ns += (uint64_t)byte_ns * bytes;
+    xensiv_pas_gas_emul_run_until(xensiv_pas_gas_emul_clock_ns + ((uint64_t)byte_ns * bytes));
+}
+
+void xensiv_pas_gas_emul_get_default_timing(xensiv_pas_gas_emul_timing_t *timing) {
+    xensiv_pas_gas_plat_assert(timing != NULL);
+
+    timing->boot_ms = 1000U;
+    timing->meas_duration_ms = 1150U;
+    timing->early_lead_ms = 1000U;
+    timing->cfg_save_ms = 30U;
+    timing->fcs_cycles = 3U;
+    timing->i2c_byte_ns = 90000U;       /* 100 kHz, 9 bits per byte */
+    timing->uart_byte_ns = 1041667U;    /* 9600 baud, 8N1 */
+}
+
+/* Removes an emulated sensor from the list of registered sensors, if it is registered */
+static void xensiv_pas_gas_emul_unlink(const xensiv_pas_gas_emul_t *emul) {
+    for (xensiv_pas_gas_emul_t **p = &xensiv_pas_gas_emul_list; *p != NULL; p = &(*p)->next)
+    {
+        if (*p == emul) {
+            *p = emul->next;
+            break;
+        }
+    }
+}
+
+void xensiv_pas_gas_emul_init(xensiv_pas_gas_emul_t *emul, xensiv_pas_gas_variant_t variant) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    /* A sensor initialized again is registered once */
+    xensiv_pas_gas_emul_unlink(emul);
+
+    (void)memset(emul, 0, sizeof(*emul));
+    emul->variant = variant;
+    xensiv_pas_gas_emul_get_default_timing(&emul->timing);
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_EMUL_DEV_ID_LEN; ++i)
+    {
+        emul->dev_id[i] = (uint8_t)(0x10U * (uint8_t)variant + i);
+    }
+
+    emul->gas_val = (XENSIV_PAS_GAS_VARIANT_CO2 == variant) ? 400U : 0U;
+    emul->trace_start_ns = xensiv_pas_gas_emul_clock_ns;
+
+    xensiv_pas_gas_emul_reset(emul);
+
+    emul->next = xensiv_pas_gas_emul_list;
+    xensiv_pas_gas_emul_list = emul;
+}
+
+void xensiv_pas_gas_emul_deinit(xensiv_pas_gas_emul_t *emul) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    xensiv_pas_gas_emul_unlink(emul);
+    emul->next = NULL;
+}
+
+void xensiv_pas_gas_emul_set_timing(xensiv_pas_gas_emul_t *emul, const xensiv_pas_gas_emul_timing_t *timing) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+    xensiv_pas_gas_plat_assert(timing != NULL);
+
+    emul->timing = *timing;
+}
+
+void xensiv_pas_gas_emul_set_gas(xensiv_pas_gas_emul_t *emul, uint16_t val) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    emul->trace = NULL;
+    emul->trace_len = 0U;
+    emul->gas_val = val;
+}
+
+void xensiv_pas_gas_emul_play_trace(xensiv_pas_gas_emul_t *emul, const xensiv_pas_gas_emul_trace_point_t *points, size_t len, bool loop) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+    xensiv_pas_gas_plat_assert((points != NULL) || (len == 0U));
+
+    emul->trace = points;
+    emul->trace_len = len;
+    emul->trace_loop = loop;
+    emul->trace_start_ns = xensiv_pas_gas_emul_clock_ns;
+}
+
+void xensiv_pas_gas_emul_set_device_id(xensiv_pas_gas_emul_t *emul, const uint8_t dev_id[XENSIV_PAS_GAS_EMUL_DEV_ID_LEN]) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+    xensiv_pas_gas_plat_assert(dev_id != NULL);
+
+    (void)memcpy(emul->dev_id, dev_id, XENSIV_PAS_GAS_EMUL_DEV_ID_LEN);
+}
+
+void xensiv_pas_gas_emul_power_cycle(xensiv_pas_gas_emul_t *emul) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    xensiv_pas_gas_emul_reset(emul);
+}
+
+uint8_t xensiv_pas_gas_emul_peek(const xensiv_pas_gas_emul_t *emul, uint8_t reg_addr) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+    xensiv_pas_gas_plat_assert(reg_addr < XENSIV_PAS_GAS_EMUL_REG_MAP_SIZE);
+
+    return emul->regs[reg_addr];
+}
+
+void xensiv_pas_gas_emul_set_bits(xensiv_pas_gas_emul_t *emul, uint8_t reg_addr, uint8_t mask) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+    xensiv_pas_gas_plat_assert(reg_addr < XENSIV_PAS_GAS_EMUL_REG_MAP_SIZE);
+
+    emul->regs[reg_addr] |= mask;
+    xensiv_pas_gas_emul_update_int_pin(emul);
+}
+
+void xensiv_pas_gas_emul_inject_comm_errors(xensiv_pas_gas_emul_t *emul, uint32_t count) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    emul->comm_errors = count;
+}
+
+void xensiv_pas_gas_emul_inject_write_errors(xensiv_pas_gas_emul_t *emul, uint32_t count) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    emul->write_errors = count;
+}
+
+bool xensiv_pas_gas_emul_get_int_pin(const xensiv_pas_gas_emul_t *emul) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    return emul->int_level;
+}
+
+void xensiv_pas_gas_emul_set_int_callback(xensiv_pas_gas_emul_t *emul, xensiv_pas_gas_emul_int_cb_t cb, void *arg) {
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    emul->int_cb = cb;
+    emul->int_cb_arg = arg;
+}
+
+uint64_t xensiv_pas_gas_emul_now_us(void) {
+    return xensiv_pas_gas_emul_clock_ns / XENSIV_PAS_GAS_EMUL_NS_PER_US;
+}
+
+void xensiv_pas_gas_emul_advance_us(uint64_t us) {
+    xensiv_pas_gas_emul_run_until(xensiv_pas_gas_emul_clock_ns + (us * XENSIV_PAS_GAS_EMUL_NS_PER_US));
+}
+
+uint64_t xensiv_pas_gas_emul_next_event_us(void) {
+    uint64_t next = XENSIV_PAS_GAS_EMUL_NEVER;
+
+    for (const xensiv_pas_gas_emul_t *emul = xensiv_pas_gas_emul_list; emul != NULL; emul = emul->next)
+    {
+        uint64_t ev = xensiv_pas_gas_emul_next_event_ns(emul);
+        if (ev < next) {
+            next = ev;
+        }
+    }
+
+    return (next == XENSIV_PAS_GAS_EMUL_NEVER) ? next : ((next + XENSIV_PAS_GAS_EMUL_NS_PER_US - 1U) / XENSIV_PAS_GAS_EMUL_NS_PER_US);
+}
+
+void xensiv_pas_gas_emul_get_bus_stats(xensiv_pas_gas_emul_bus_stats_t *stats) {
+    xensiv_pas_gas_plat_assert(stats != NULL);
+
+    *stats = xensiv_pas_gas_emul_bus_stats;
+}
+
+void xensiv_pas_gas_emul_reset_bus_stats(void) {
+    (void)memset(&xensiv_pas_gas_emul_bus_stats, 0, sizeof(xensiv_pas_gas_emul_bus_stats));
+}
+
+/********************************* Platform functions ************************************/
+
+int32_t xensiv_pas_gas_plat_i2c_transfer(void *ctx, uint16_t dev_addr, const uint8_t *tx_buffer, size_t tx_len, uint8_t *rx_buffer, size_t rx_len) {
+    xensiv_pas_gas_emul_t *emul = (xensiv_pas_gas_emul_t *)ctx;
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    size_t bytes = 1U + tx_len + ((rx_len > 0U) ? (1U + rx_len) : 0U);
+    xensiv_pas_gas_emul_bus_stats.i2c_transfers++;
+    xensiv_pas_gas_emul_bus_time(emul->timing.i2c_byte_ns, bytes);
+
+    if ((XENSIV_PAS_GAS_I2C_ADDR != dev_addr) || (xensiv_pas_gas_emul_clock_ns < emul->busy_until_ns)) {
+        /* Address not acknowledged */
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    if (emul->comm_errors > 0U) {
+        emul->comm_errors--;
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    if ((emul->write_errors > 0U) && (tx_len > 1U)) {
+        emul->write_errors--;
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    if (tx_len > 0U) {
+        emul->reg_ptr = tx_buffer[0];
+        for (size_t i = 1U; i < tx_len; ++i)
+        {
+            xensiv_pas_gas_emul_write_reg(emul, emul->reg_ptr, tx_buffer[i]);
+            emul->reg_ptr++;
+        }
+    }
+
+    for (size_t i = 0U; i < rx_len; ++i)
+    {
+        rx_buffer[i] = xensiv_pas_gas_emul_read_reg(emul, emul->reg_ptr);
+        emul->reg_ptr++;
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_plat_uart_write(void *ctx, uint8_t *data, size_t len) {
+    xensiv_pas_gas_emul_t *emul = (xensiv_pas_gas_emul_t *)ctx;
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    xensiv_pas_gas_emul_bus_stats.uart_writes++;
+    xensiv_pas_gas_emul_bus_time(emul->timing.uart_byte_ns, len);
+
+    if (xensiv_pas_gas_emul_clock_ns < emul->busy_until_ns) {
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    for (size_t i = 0U; i < len; ++i)
+    {
+        if (emul->uart_cmd_len < sizeof(emul->uart_cmd)) {
+            emul->uart_cmd[emul->uart_cmd_len++] = data[i];
+        }
+        if (data[i] == (uint8_t)'\n') {
+            xensiv_pas_gas_emul_uart_execute(emul);
+        }
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_plat_uart_read(void *ctx, uint8_t *data, size_t len) {
+    xensiv_pas_gas_emul_t *emul = (xensiv_pas_gas_emul_t *)ctx;
+    xensiv_pas_gas_plat_assert(emul != NULL);
+
+    xensiv_pas_gas_emul_bus_stats.uart_reads++;
+    xensiv_pas_gas_emul_bus_time(emul->timing.uart_byte_ns, len);
+
+    if ((emul->uart_resp_len - emul->uart_resp_pos) < len) {
+        /* Timeout, the sensor did not send enough characters */
+        emul->uart_resp_len = 0U;
+        emul->uart_resp_pos = 0U;
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    (void)memcpy(data, &emul->uart_resp[emul->uart_resp_pos], len);
+    emul->uart_resp_pos += len;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_plat_delay(uint32_t ms) {
+    xensiv_pas_gas_emul_bus_stats.delays++;
+    xensiv_pas_gas_emul_bus_stats.delay_ms += ms;
+    xensiv_pas_gas_emul_run_until(xensiv_pas_gas_emul_clock_ns + ((uint64_t)ms * XENSIV_PAS_GAS_EMUL_NS_PER_MS));
+}
+
+uint16_t xensiv_pas_gas_plat_htons(uint16_t x) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return x;
+#else
+    return (uint16_t)(((x & 0x00ffU) << 8) | ((x & 0xff00U) >> 8));
+#endif
+}
+
+uint64_t xensiv_pas_gas_plat_get_time_us(void) {
+    return xensiv_pas_gas_emul_clock_ns / XENSIV_PAS_GAS_EMUL_NS_PER_US;
+}
+
+void xensiv_pas_gas_plat_assert(int expr) {
+    assert(expr);
+    (void)expr;
+}
@@ -0,0 +1,308 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_emul.h
+ *
+ * Description: Register-level emulator of the XENSIV™ PAS GAS sensor family to be used
+ *              as a stand-in platform on host machines.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_EMUL_H_
+#define XENSIV_PAS_GAS_EMUL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_emul XENSIV™ PAS GAS sensor emulator
+ * \{
+ * Emulator of the XENSIV™ PAS GAS sensors (base, CO2, R290 and A2L register maps).
+ *
+ * The emulator implements all functions of \ref group_board_libs_platform, so linking it in place of a
+ * real platform port runs the unmodified driver against emulated sensors. The ctx passed to the
+ * driver init functions must point to an initialized \ref xensiv_pas_gas_emul_t, for both the I2C and
+ * the UART interface.
+ *
+ * All emulated sensors share one virtual clock. The clock advances with \ref xensiv_pas_gas_plat_delay,
+ * with the modeled transfer time of every bus access and with \ref xensiv_pas_gas_emul_advance_us.
+ * Sensor events (SEN_RDY after reset, measurement sequences at MEAS_RATE, DRDY, alarms, forced
+ * compensation completion and INT pin transitions) are processed in time order while the clock advances.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Size of the emulated register map */
+#define XENSIV_PAS_GAS_EMUL_REG_MAP_SIZE         (0x69U)
+
+/** Number of bytes of the emulated unique device ID */
+#define XENSIV_PAS_GAS_EMUL_DEV_ID_LEN           (8U)
+
+/********************************* Type definitions **************************************/
+
+/** Point of a scripted gas concentration trace */
+typedef struct
+{
+    uint32_t t_ms;                      /*!< Time offset from the start of the trace in milliseconds */
+    uint16_t val;                       /*!< Gas concentration reached at t_ms; values are linearly interpolated in between */
+} xensiv_pas_gas_emul_trace_point_t;
+
+/** Timing model of an emulated sensor */
+typedef struct
+{
+    uint32_t boot_ms;                   /*!< Time from reset until SENS_STS.SEN_RDY is set */
+    uint32_t meas_duration_ms;          /*!< Duration of a measurement sequence */
+    uint32_t early_lead_ms;             /*!< Time the EARLY notification precedes the start of a measurement sequence */
+    uint32_t cfg_save_ms;               /*!< Time the sensor is blocked writing its non-volatile memory */
+    uint8_t fcs_cycles;                 /*!< Number of measurement sequences needed to complete a forced compensation */
+    uint32_t i2c_byte_ns;               /*!< Bus time per I2C byte including the acknowledge bit */
+    uint32_t uart_byte_ns;              /*!< Bus time per UART character */
+} xensiv_pas_gas_emul_timing_t;
+
+/** Bus and delay counters of the emulated platform, accumulated over all emulated sensors */
+typedef struct
+{
+    uint32_t i2c_transfers;             /*!< Number of I2C transfers */
+    uint32_t uart_writes;               /*!< Number of UART writes, i.e. commands sent to the sensors */
+    uint32_t uart_reads;                /*!< Number of UART reads, i.e. responses read from the sensors */
+    uint64_t bytes;                     /*!< Bytes on the wire in both directions, including the I2C address bytes */
+    uint64_t bus_ns;                    /*!< Modeled time spent on the buses */
+    uint32_t delays;                    /*!< Number of calls to \ref xensiv_pas_gas_plat_delay */
+    uint64_t delay_ms;                  /*!< Cumulative time requested through \ref xensiv_pas_gas_plat_delay */
+} xensiv_pas_gas_emul_bus_stats_t;
+
+struct xensiv_pas_gas_emul_s;           /* Forward declaration */
+
+/**
+ * Callback invoked on every transition of the emulated INT pin
+ * @param[in] emul Emulated sensor
+ * @param[in] level New electrical level of the pin
+ * @param[in] time_us Virtual time of the transition in microseconds
+ * @param[in] arg User argument registered with \ref xensiv_pas_gas_emul_set_int_callback
+ */
+typedef void (*xensiv_pas_gas_emul_int_cb_t)(struct xensiv_pas_gas_emul_s *emul, bool level, uint64_t time_us, void *arg);
+
+/** Emulated sensor. The members are private to the emulator; use the functions below to access them. */
+typedef struct xensiv_pas_gas_emul_s
+{
+    xensiv_pas_gas_variant_t variant;                   /*!< Emulated sensor variant */
+    xensiv_pas_gas_emul_timing_t timing;                /*!< Timing model */
+    uint8_t regs[XENSIV_PAS_GAS_EMUL_REG_MAP_SIZE];     /*!< Register map */
+    uint8_t nvm[XENSIV_PAS_GAS_EMUL_REG_MAP_SIZE];      /*!< Configuration saved in non-volatile memory */
+    bool nvm_valid;                                     /*!< Non-volatile configuration present */
+    int32_t fcs_offset;                                 /*!< Active forced compensation offset */
+    int32_t nvm_fcs_offset;                             /*!< Forced compensation offset saved in non-volatile memory */
+    uint8_t dev_id[XENSIV_PAS_GAS_EMUL_DEV_ID_LEN];     /*!< Unique device ID */
+    uint8_t reg_ptr;                                    /*!< I2C register pointer */
+
+    bool ready;                                         /*!< Boot after reset completed */
+    bool measuring;                                     /*!< Measurement sequence in progress */
+    bool early;                                         /*!< EARLY notification active */
+    bool int_level;                                     /*!< Electrical level of the INT pin */
+    uint8_t fcs_remaining;                              /*!< Measurement sequences left until the forced compensation completes */
+    uint64_t boot_done_ns;                              /*!< Virtual time at which the boot completes */
+    uint64_t meas_end_ns;                               /*!< Virtual time at which the running measurement sequence completes */
+    uint64_t next_start_ns;                             /*!< Virtual time of the next measurement sequence start in continuous mode */
+    uint64_t busy_until_ns;                             /*!< Virtual time until which the serial interface does not respond */
+    uint32_t comm_errors;                               /*!< Number of upcoming bus accesses to fail */
+    uint32_t write_errors;                              /*!< Number of upcoming register writes to fail */
+
+    const xensiv_pas_gas_emul_trace_point_t *trace;     /*!< Scripted gas concentration trace */
+    size_t trace_len;                                   /*!< Number of points of the trace */
+    bool trace_loop;                                    /*!< Restart the trace after its last point */
+    uint64_t trace_start_ns;                            /*!< Virtual time at which the trace started */
+    uint16_t gas_val;                                   /*!< Gas concentration used when no trace is set */
+
+    uint8_t uart_cmd[16];                               /*!< UART command being received */
+    size_t uart_cmd_len;                                /*!< Number of received command characters */
+    uint8_t uart_resp[4];                               /*!< Pending UART response */
+    size_t uart_resp_len;                               /*!< Length of the pending UART response */
+    size_t uart_resp_pos;                               /*!< Number of response characters already read */
+
+    xensiv_pas_gas_emul_int_cb_t int_cb;                /*!< INT pin transition callback */
+    void *int_cb_arg;                                   /*!< User argument of the INT pin transition callback */
+
+    struct xensiv_pas_gas_emul_s *next;                 /*!< Next emulated sensor sharing the virtual clock */
+} xensiv_pas_gas_emul_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes an emulated sensor in its power-on state and registers it with the virtual clock.
+ * A sensor already registered is reset to its power-on state and stays registered once.
+ *
+ * @param[out] emul Emulated sensor allocated by the user
+ * @param[in] variant Sensor variant whose register map is emulated
+ */
+void xensiv_pas_gas_emul_init(xensiv_pas_gas_emul_t *emul, xensiv_pas_gas_variant_t variant);
+
+/**
+ * @brief Unregisters an emulated sensor from the virtual clock.
+ *
+ * @param[in] emul Emulated sensor
+ */
+void xensiv_pas_gas_emul_deinit(xensiv_pas_gas_emul_t *emul);
+
+/**
+ * @brief Gets the default timing model used by \ref xensiv_pas_gas_emul_init
+ *
+ * @param[out] timing Pointer to populate with the default timing model
+ */
+void xensiv_pas_gas_emul_get_default_timing(xensiv_pas_gas_emul_timing_t *timing);
+
+/**
+ * @brief Replaces the timing model of an emulated sensor
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] timing New timing model
+ */
+void xensiv_pas_gas_emul_set_timing(xensiv_pas_gas_emul_t *emul, const xensiv_pas_gas_emul_timing_t *timing);
+
+/**
+ * @brief Sets a constant gas concentration and stops any scripted trace
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] val Gas concentration reported by subsequent measurements
+ */
+void xensiv_pas_gas_emul_set_gas(xensiv_pas_gas_emul_t *emul, uint16_t val);
+
+/**
+ * @brief Starts playing a scripted gas concentration trace at the current virtual time.
+ * The trace is not copied and must stay valid while it is played. After the last point the value is held,
+ * or the trace restarts if loop is set.
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] points Trace points sorted by time
+ * @param[in] len Number of trace points
+ * @param[in] loop Restart the trace after its last point
+ */
+void xensiv_pas_gas_emul_play_trace(xensiv_pas_gas_emul_t *emul, const xensiv_pas_gas_emul_trace_point_t *points, size_t len, bool loop);
+
+/**
+ * @brief Sets the unique device ID reported through DEV_ID
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] dev_id Device ID bytes, index 0 first
+ */
+void xensiv_pas_gas_emul_set_device_id(xensiv_pas_gas_emul_t *emul, const uint8_t dev_id[XENSIV_PAS_GAS_EMUL_DEV_ID_LEN]);
+
+/**
+ * @brief Emulates a power cycle. The register map is reset and the configuration saved in non-volatile memory is restored.
+ *
+ * @param[in] emul Emulated sensor
+ */
+void xensiv_pas_gas_emul_power_cycle(xensiv_pas_gas_emul_t *emul);
+
+/**
+ * @brief Reads a register without any side effect on the sensor state
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] reg_addr Register address
+ * @return Register value
+ */
+uint8_t xensiv_pas_gas_emul_peek(const xensiv_pas_gas_emul_t *emul, uint8_t reg_addr);
+
+/**
+ * @brief Sets bits of a register directly, e.g. to inject SENS_STS or SELF_TEST error flags
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] reg_addr Register address
+ * @param[in] mask Bits to set
+ */
+void xensiv_pas_gas_emul_set_bits(xensiv_pas_gas_emul_t *emul, uint8_t reg_addr, uint8_t mask);
+
+/**
+ * @brief Makes the next bus accesses fail. A failing I2C transfer is not acknowledged, a failing UART write
+ * command is answered with NAK and a failing UART read command is not answered. The failing commands have no effect.
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] count Number of bus accesses to fail
+ */
+void xensiv_pas_gas_emul_inject_comm_errors(xensiv_pas_gas_emul_t *emul, uint32_t count);
+
+/**
+ * @brief Makes the next register writes fail as \ref xensiv_pas_gas_emul_inject_comm_errors does, while the reads
+ * in between succeed
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] count Number of register writes to fail
+ */
+void xensiv_pas_gas_emul_inject_write_errors(xensiv_pas_gas_emul_t *emul, uint32_t count);
+
+/**
+ * @brief Gets the electrical level of the emulated INT pin
+ *
+ * @param[in] emul Emulated sensor
+ * @return Level of the INT pin
+ */
+bool xensiv_pas_gas_emul_get_int_pin(const xensiv_pas_gas_emul_t *emul);
+
+/**
+ * @brief Registers a callback invoked on every transition of the emulated INT pin
+ *
+ * @param[in] emul Emulated sensor
+ * @param[in] cb Callback, NULL to unregister
+ * @param[in] arg User argument passed to the callback
+ */
+void xensiv_pas_gas_emul_set_int_callback(xensiv_pas_gas_emul_t *emul, xensiv_pas_gas_emul_int_cb_t cb, void *arg);
+
+/**
+ * @brief Gets the current virtual time
+ *
+ * @return Virtual time in microseconds
+ */
+uint64_t xensiv_pas_gas_emul_now_us(void);
+
+/**
+ * @brief Advances the virtual clock, processing the events of all emulated sensors in time order
+ *
+ * @param[in] us Number of microseconds to advance
+ */
+void xensiv_pas_gas_emul_advance_us(uint64_t us);
+
+/**
+ * @brief Gets the virtual time of the next pending event of any emulated sensor
+ *
+ * @return Virtual time in microseconds; UINT64_MAX if no event is pending
+ */
+uint64_t xensiv_pas_gas_emul_next_event_us(void);
+
+/**
+ * @brief Gets the bus and delay counters of the emulated platform
+ *
+ * @param[out] stats Pointer to populate with the counters
+ */
+void xensiv_pas_gas_emul_get_bus_stats(xensiv_pas_gas_emul_bus_stats_t *stats);
+
+/**
+ * @brief Resets the bus and delay counters of the emulated platform
+ */
+void xensiv_pas_gas_emul_reset_bus_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_emul */
+
+#endif /* XENSIV_PAS_GAS_EMUL_H_ */
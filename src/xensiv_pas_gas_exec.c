@@ -0,0 +1,313 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_exec.c
+ *
+ * Description: This file contains the multi-bus executor of the XENSIV™ PAS GAS sensor driver,
+ *              which runs the sensor operations of several buses in parallel.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "xensiv_pas_gas_exec.h"
+
+static int32_t xensiv_pas_gas_exec_run_get_result(xensiv_pas_gas_exec_job_t *job) {
+    return xensiv_pas_gas_get_result(job->dev, job->val);
+}
+
+static int32_t xensiv_pas_gas_exec_run_forced_compensation(xensiv_pas_gas_exec_job_t *job) {
+    return xensiv_pas_gas_perform_forced_compensation(job->dev, job->gas_ref);
+}
+
+static int32_t xensiv_pas_gas_exec_run_get_reg(xensiv_pas_gas_exec_job_t *job) {
+    return xensiv_pas_gas_get_reg(job->dev, job->reg_addr, job->data, job->len);
+}
+
+static int32_t xensiv_pas_gas_exec_run_set_reg(xensiv_pas_gas_exec_job_t *job) {
+    return xensiv_pas_gas_set_reg(job->dev, job->reg_addr, job->data, job->len);
+}
+
+/* Appends a bus to the run queue of a worker; called with the lock held */
+static void xensiv_pas_gas_exec_push(xensiv_pas_gas_exec_worker_t *worker, xensiv_pas_gas_exec_bus_t *bus) {
+    bus->next = NULL;
+    if (NULL == worker->tail) {
+        worker->head = bus;
+    } else {
+        worker->tail->next = bus;
+    }
+    worker->tail = bus;
+    worker->len++;
+}
+
+/* Removes the bus at the head of the run queue of a worker; called with the lock held */
+static xensiv_pas_gas_exec_bus_t *xensiv_pas_gas_exec_pop(xensiv_pas_gas_exec_worker_t *worker) {
+    xensiv_pas_gas_exec_bus_t *bus = worker->head;
+
+    if (NULL != bus) {
+        worker->head = bus->next;
+        if (NULL == worker->head) {
+            worker->tail = NULL;
+        }
+        worker->len--;
+    }
+
+    return bus;
+}
+
+/* Takes the next bus to run: from the own run queue, else from the longest one; called with the lock held */
+static xensiv_pas_gas_exec_bus_t *xensiv_pas_gas_exec_take(xensiv_pas_gas_exec_worker_t *worker) {
+    xensiv_pas_gas_exec_bus_t *bus = xensiv_pas_gas_exec_pop(worker);
+
+    if (NULL == bus) {
+        xensiv_pas_gas_exec_t *exec = worker->exec;
+        xensiv_pas_gas_exec_worker_t *victim = NULL;
+
+        for (uint8_t i = 0U; i < exec->num_workers; ++i)
+        {
+            if ((exec->workers[i].len > 0U) && ((NULL == victim) || (exec->workers[i].len > victim->len))) {
+                victim = &exec->workers[i];
+            }
+        }
+
+        if (NULL != victim) {
+            bus = xensiv_pas_gas_exec_pop(victim);
+            worker->steals++;
+        }
+    }
+
+    return bus;
+}
+
+static void *xensiv_pas_gas_exec_worker(void *arg) {
+    xensiv_pas_gas_exec_worker_t *worker = (xensiv_pas_gas_exec_worker_t *)arg;
+    xensiv_pas_gas_exec_t *exec = worker->exec;
+
+    (void)pthread_mutex_lock(&exec->lock);
+
+    while (!exec->stop || (exec->pending > 0U))
+    {
+        xensiv_pas_gas_exec_bus_t *bus = xensiv_pas_gas_exec_take(worker);
+
+        if (NULL == bus) {
+            (void)pthread_cond_wait(&exec->work, &exec->lock);
+            continue;
+        }
+
+        /* The bus is in no run queue while its job runs, no other worker can take it */
+        xensiv_pas_gas_exec_job_t *job = bus->head;
+        bus->head = job->next;
+        if (NULL == bus->head) {
+            bus->tail = NULL;
+        }
+        worker->jobs++;
+
+        (void)pthread_mutex_unlock(&exec->lock);
+
+        int32_t res = job->fn(job);
+        job->res = res;
+        if (NULL != job->done) {
+            job->done(job, res);
+        }
+
+        (void)pthread_mutex_lock(&exec->lock);
+
+        /* Rejoin at the tail so the other buses of this worker run first; an idle worker may steal it meanwhile */
+        if (NULL != bus->head) {
+            xensiv_pas_gas_exec_push(worker, bus);
+            (void)pthread_cond_signal(&exec->work);
+        } else {
+            bus->runnable = false;
+        }
+
+        exec->pending--;
+        if (0U == exec->pending) {
+            (void)pthread_cond_broadcast(&exec->idle);
+            if (exec->stop) {
+                (void)pthread_cond_broadcast(&exec->work);
+            }
+        }
+    }
+
+    (void)pthread_mutex_unlock(&exec->lock);
+
+    return NULL;
+}
+
+int32_t xensiv_pas_gas_exec_init(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_worker_t *workers, uint8_t num_workers) {
+    xensiv_pas_gas_plat_assert(exec != NULL);
+    xensiv_pas_gas_plat_assert(workers != NULL);
+
+    if (0U == num_workers) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    (void)memset(workers, 0, sizeof(*workers) * num_workers);
+    (void)pthread_mutex_init(&exec->lock, NULL);
+    (void)pthread_cond_init(&exec->work, NULL);
+    (void)pthread_cond_init(&exec->idle, NULL);
+    exec->workers = workers;
+    exec->next_home = 0U;
+    exec->pending = 0U;
+    exec->stop = false;
+
+    /* Set before the first thread starts, the workers read it when stealing */
+    exec->num_workers = num_workers;
+
+    for (uint8_t i = 0U; i < num_workers; ++i)
+    {
+        workers[i].exec = exec;
+        if (0 != pthread_create(&workers[i].thread, NULL, xensiv_pas_gas_exec_worker, &workers[i])) {
+            /* Only the threads created are joined */
+            (void)pthread_mutex_lock(&exec->lock);
+            exec->num_workers = i;
+            (void)pthread_mutex_unlock(&exec->lock);
+            xensiv_pas_gas_exec_deinit(exec);
+            return XENSIV_PAS_GAS_ERR_NOT_READY;
+        }
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_exec_deinit(xensiv_pas_gas_exec_t *exec) {
+    xensiv_pas_gas_plat_assert(exec != NULL);
+
+    (void)pthread_mutex_lock(&exec->lock);
+    exec->stop = true;
+    (void)pthread_cond_broadcast(&exec->work);
+    (void)pthread_mutex_unlock(&exec->lock);
+
+    for (uint8_t i = 0U; i < exec->num_workers; ++i)
+    {
+        (void)pthread_join(exec->workers[i].thread, NULL);
+    }
+
+    (void)pthread_cond_destroy(&exec->idle);
+    (void)pthread_cond_destroy(&exec->work);
+    (void)pthread_mutex_destroy(&exec->lock);
+    exec->num_workers = 0U;
+}
+
+void xensiv_pas_gas_exec_bus_init(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_bus_t *bus) {
+    xensiv_pas_gas_plat_assert(exec != NULL);
+    xensiv_pas_gas_plat_assert(bus != NULL);
+    xensiv_pas_gas_plat_assert(exec->num_workers > 0U);
+
+    (void)pthread_mutex_lock(&exec->lock);
+    bus->head = NULL;
+    bus->tail = NULL;
+    bus->runnable = false;
+    bus->next = NULL;
+    bus->home = exec->next_home;
+    exec->next_home = (uint8_t)((exec->next_home + 1U) % exec->num_workers);
+    (void)pthread_mutex_unlock(&exec->lock);
+}
+
+void xensiv_pas_gas_exec_job_call(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, xensiv_pas_gas_exec_fn_t fn, void *arg) {
+    xensiv_pas_gas_plat_assert(job != NULL);
+    xensiv_pas_gas_plat_assert(fn != NULL);
+
+    (void)memset(job, 0, sizeof(*job));
+    job->fn = fn;
+    job->dev = dev;
+    job->arg = arg;
+    job->res = XENSIV_PAS_GAS_PENDING;
+}
+
+void xensiv_pas_gas_exec_job_get_result(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint16_t *val) {
+    xensiv_pas_gas_plat_assert(val != NULL);
+
+    xensiv_pas_gas_exec_job_call(job, dev, xensiv_pas_gas_exec_run_get_result, NULL);
+    job->val = val;
+}
+
+void xensiv_pas_gas_exec_job_forced_compensation(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint16_t gas_ref) {
+    xensiv_pas_gas_exec_job_call(job, dev, xensiv_pas_gas_exec_run_forced_compensation, NULL);
+    job->gas_ref = gas_ref;
+}
+
+void xensiv_pas_gas_exec_job_get_reg(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    xensiv_pas_gas_plat_assert(data != NULL);
+
+    xensiv_pas_gas_exec_job_call(job, dev, xensiv_pas_gas_exec_run_get_reg, NULL);
+    job->reg_addr = reg_addr;
+    job->data = data;
+    job->len = len;
+}
+
+void xensiv_pas_gas_exec_job_set_reg(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len) {
+    xensiv_pas_gas_plat_assert(data != NULL);
+
+    xensiv_pas_gas_exec_job_call(job, dev, xensiv_pas_gas_exec_run_set_reg, NULL);
+    job->reg_addr = reg_addr;
+    job->data = (uint8_t *)data;
+    job->len = len;
+}
+
+void xensiv_pas_gas_exec_submit(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_bus_t *bus, xensiv_pas_gas_exec_job_t *job) {
+    xensiv_pas_gas_plat_assert(exec != NULL);
+    xensiv_pas_gas_plat_assert(bus != NULL);
+    xensiv_pas_gas_plat_assert(job != NULL);
+
+    (void)pthread_mutex_lock(&exec->lock);
+
+    job->res = XENSIV_PAS_GAS_PENDING;
+    job->next = NULL;
+    if (NULL == bus->tail) {
+        bus->head = job;
+    } else {
+        bus->tail->next = job;
+    }
+    bus->tail = job;
+    exec->pending++;
+
+    if (!bus->runnable) {
+        bus->runnable = true;
+        xensiv_pas_gas_exec_push(&exec->workers[bus->home], bus);
+        (void)pthread_cond_signal(&exec->work);
+    }
+
+    (void)pthread_mutex_unlock(&exec->lock);
+}
+
+void xensiv_pas_gas_exec_wait(xensiv_pas_gas_exec_t *exec) {
+    xensiv_pas_gas_plat_assert(exec != NULL);
+
+    (void)pthread_mutex_lock(&exec->lock);
+    while (exec->pending > 0U)
+    {
+        (void)pthread_cond_wait(&exec->idle, &exec->lock);
+    }
+    (void)pthread_mutex_unlock(&exec->lock);
+}
+
+void xensiv_pas_gas_exec_get_stats(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_stats_t *stats) {
+    xensiv_pas_gas_plat_assert(exec != NULL);
+    xensiv_pas_gas_plat_assert(stats != NULL);
+
+    stats->jobs = 0U;
+    stats->steals = 0U;
+
+    (void)pthread_mutex_lock(&exec->lock);
+    for (uint8_t i = 0U; i < exec->num_workers; ++i)
+    {
+        stats->jobs += exec->workers[i].jobs;
+        stats->steals += exec->workers[i].steals;
+    }
+    (void)pthread_mutex_unlock(&exec->lock);
+}
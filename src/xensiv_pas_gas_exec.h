@@ -0,0 +1,263 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_exec.h
+ *
+ * Description: This file contains the multi-bus executor of the XENSIV™ PAS GAS sensor driver,
+ *              which runs the sensor operations of several buses in parallel.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_EXEC_H_
+#define XENSIV_PAS_GAS_EXEC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_exec XENSIV™ PAS GAS sensor multi-bus executor
+ * \{
+ * Pool of worker threads which runs the blocking driver functions on several I2C buses and UART ports
+ * in parallel.
+ *
+ * Each bus or port is a \ref xensiv_pas_gas_exec_bus_t holding a queue of jobs, which are run one at a
+ * time and in submission order, so the accesses of the sensors on a bus never overlap. A bus with queued
+ * jobs is runnable and sits in the run queue of one worker, its home worker on submission. A worker runs
+ * one job of the bus at the head of its run queue and then appends the bus to its run queue again if jobs
+ * are left. A worker with an empty run queue steals the bus at the head of the longest run queue of the
+ * other workers. A bus is thus run by at most one worker at a time, and all buses with queued jobs make
+ * progress as long as there are as many workers as buses; additional workers stay idle.
+ *
+ * The jobs are the driver functions, e.g. \ref xensiv_pas_gas_get_result or \ref
+ * xensiv_pas_gas_perform_forced_compensation, bound to a sensor with the xensiv_pas_gas_exec_job_*
+ * functions; any other sequence of driver calls is run as a \ref xensiv_pas_gas_exec_fn_t:
+ * \code
+ *  static xensiv_pas_gas_exec_worker_t workers[4];
+ *  xensiv_pas_gas_exec_init(&exec, workers, 4U);
+ *  xensiv_pas_gas_exec_bus_init(&exec, &bus[0]);
+ *  ...
+ *  for (i = 0; i < n; ++i) {
+ *      xensiv_pas_gas_exec_job_get_result(&job[i], &dev[i], &val[i]);
+ *      xensiv_pas_gas_exec_submit(&exec, &bus[bus_of(i)], &job[i]);
+ *  }
+ *  xensiv_pas_gas_exec_wait(&exec);                    // job[i].res holds the result of each job
+ * \endcode
+ *
+ * The platform functions are called from the worker threads, concurrently for different buses; they must
+ * be thread safe across the ctx of different buses, as the ones of xensiv_pas_gas_linux.c are. The driver
+ * itself keeps no state outside the device structures, except in the trace rings and recordings attached
+ * to them, which must not be shared by the sensors of different buses. The executor uses POSIX threads and is built as a
+ * separate library.
+ */
+
+/********************************* Type definitions **************************************/
+
+struct xensiv_pas_gas_exec_job_s;       /* Forward declaration */
+
+/**
+ * Function run as a job
+ * @param[in] job Job being run, with the device and argument it was set up with
+ * @return Result of the job, stored in res
+ */
+typedef int32_t (*xensiv_pas_gas_exec_fn_t)(struct xensiv_pas_gas_exec_job_s *job);
+
+/**
+ * Callback invoked on the worker thread once a job completed
+ * @param[in] job Completed job; it may be submitted again from the callback
+ * @param[in] res Result of the job
+ */
+typedef void (*xensiv_pas_gas_exec_done_t)(struct xensiv_pas_gas_exec_job_s *job, int32_t res);
+
+/** Job of the executor. The members other than res, arg and done are private to the executor. */
+typedef struct xensiv_pas_gas_exec_job_s
+{
+    xensiv_pas_gas_exec_fn_t fn;            /*!< Function run by the job */
+    const xensiv_pas_gas_t *dev;            /*!< Sensor device */
+    void *arg;                              /*!< User argument of fn */
+    xensiv_pas_gas_exec_done_t done;        /*!< Completion callback; NULL for none */
+    int32_t res;                            /*!< Result once the job completed; XENSIV_PAS_GAS_PENDING before */
+    uint8_t reg_addr;                       /*!< Start register address of a register access */
+    uint8_t len;                            /*!< Number of registers accessed */
+    uint8_t *data;                          /*!< Data of a register access */
+    uint16_t gas_ref;                       /*!< Reference of a forced compensation */
+    uint16_t *val;                          /*!< Pointer to populate with the gas concentration */
+    struct xensiv_pas_gas_exec_job_s *next; /*!< Next job queued on the bus */
+} xensiv_pas_gas_exec_job_t;
+
+/** I2C bus or UART port of the executor. The members are private to the executor. */
+typedef struct xensiv_pas_gas_exec_bus_s
+{
+    xensiv_pas_gas_exec_job_t *head;        /*!< First queued job */
+    xensiv_pas_gas_exec_job_t *tail;        /*!< Last queued job */
+    bool runnable;                          /*!< The bus is in a run queue or being run */
+    uint8_t home;                           /*!< Worker whose run queue the bus joins on submission */
+    struct xensiv_pas_gas_exec_bus_s *next; /*!< Next bus in the run queue */
+} xensiv_pas_gas_exec_bus_t;
+
+struct xensiv_pas_gas_exec_s;           /* Forward declaration */
+
+/** Worker of the executor. The members are private to the executor. */
+typedef struct
+{
+    struct xensiv_pas_gas_exec_s *exec;     /*!< Executor */
+    pthread_t thread;                       /*!< Worker thread */
+    xensiv_pas_gas_exec_bus_t *head;        /*!< First bus of the run queue */
+    xensiv_pas_gas_exec_bus_t *tail;        /*!< Last bus of the run queue */
+    uint32_t len;                           /*!< Number of buses in the run queue */
+    uint32_t jobs;                          /*!< Number of jobs run */
+    uint32_t steals;                        /*!< Number of buses stolen from other workers */
+} xensiv_pas_gas_exec_worker_t;
+
+/** Executor. The members are private to the executor. */
+typedef struct xensiv_pas_gas_exec_s
+{
+    pthread_mutex_t lock;                   /*!< Protects the queues and counters */
+    pthread_cond_t work;                    /*!< Signaled when a bus becomes runnable or on stop */
+    pthread_cond_t idle;                    /*!< Signaled when the last pending job completed */
+    xensiv_pas_gas_exec_worker_t *workers;  /*!< Workers */
+    uint8_t num_workers;                    /*!< Number of workers */
+    uint8_t next_home;                      /*!< Home worker of the next bus */
+    uint32_t pending;                       /*!< Number of jobs submitted and not completed */
+    bool stop;                              /*!< The workers exit once no job is pending */
+} xensiv_pas_gas_exec_t;
+
+/** Counters of the executor, accumulated over all workers */
+typedef struct
+{
+    uint32_t jobs;                          /*!< Number of jobs run */
+    uint32_t steals;                        /*!< Number of buses stolen from other workers */
+} xensiv_pas_gas_exec_stats_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the executor and starts its worker threads
+ *
+ * @param[out] exec Executor allocated by the user
+ * @param[in] workers Workers allocated by the user, kept until \ref xensiv_pas_gas_exec_deinit
+ * @param[in] num_workers Number of workers
+ * @return XENSIV_PAS_GAS_OK if all workers were started; XENSIV_PAS_GAS_INVALID_PARAMETER if num_workers is 0;
+ * XENSIV_PAS_GAS_ERR_NOT_READY if a thread could not be created, the executor is then not initialized
+ */
+int32_t xensiv_pas_gas_exec_init(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_worker_t *workers, uint8_t num_workers);
+
+/**
+ * @brief Runs the pending jobs to completion and stops the worker threads
+ *
+ * @param[in] exec Executor
+ */
+void xensiv_pas_gas_exec_deinit(xensiv_pas_gas_exec_t *exec);
+
+/**
+ * @brief Initializes a bus of the executor.
+ * The buses are assigned their home workers in turn.
+ *
+ * @param[in] exec Executor
+ * @param[out] bus Bus allocated by the user
+ */
+void xensiv_pas_gas_exec_bus_init(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_bus_t *bus);
+
+/**
+ * @brief Sets up a job running a function
+ *
+ * @param[out] job Job allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device passed to fn in the job
+ * @param[in] fn Function to run
+ * @param[in] arg User argument passed to fn in the job
+ */
+void xensiv_pas_gas_exec_job_call(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, xensiv_pas_gas_exec_fn_t fn, void *arg);
+
+/**
+ * @brief Sets up a job running \ref xensiv_pas_gas_get_result
+ *
+ * @param[out] job Job allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[out] val Pointer to populate with the gas concentration
+ */
+void xensiv_pas_gas_exec_job_get_result(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint16_t *val);
+
+/**
+ * @brief Sets up a job running \ref xensiv_pas_gas_perform_forced_compensation
+ *
+ * @param[out] job Job allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] gas_ref Reference gas concentration
+ */
+void xensiv_pas_gas_exec_job_forced_compensation(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint16_t gas_ref);
+
+/**
+ * @brief Sets up a job running \ref xensiv_pas_gas_get_reg
+ *
+ * @param[out] job Job allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] reg_addr Start register address
+ * @param[out] data Buffer to populate with the register values
+ * @param[in] len Number of registers to read
+ */
+void xensiv_pas_gas_exec_job_get_reg(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t *data, uint8_t len);
+
+/**
+ * @brief Sets up a job running \ref xensiv_pas_gas_set_reg
+ *
+ * @param[out] job Job allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] reg_addr Start register address
+ * @param[in] data Register values; they are kept until the job completed
+ * @param[in] len Number of registers to write
+ */
+void xensiv_pas_gas_exec_job_set_reg(xensiv_pas_gas_exec_job_t *job, const xensiv_pas_gas_t *dev, uint8_t reg_addr, const uint8_t *data, uint8_t len);
+
+/**
+ * @brief Queues a job on a bus.
+ * The job runs after the jobs queued before on the same bus. It can be called from any thread, including
+ * from a completion callback.
+ *
+ * @param[in] exec Executor
+ * @param[in] bus Bus of the sensor of the job
+ * @param[in] job Job set up with one of the xensiv_pas_gas_exec_job_* functions, kept until it completed
+ */
+void xensiv_pas_gas_exec_submit(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_bus_t *bus, xensiv_pas_gas_exec_job_t *job);
+
+/**
+ * @brief Waits until all submitted jobs completed, including the jobs submitted while waiting
+ *
+ * @param[in] exec Executor
+ */
+void xensiv_pas_gas_exec_wait(xensiv_pas_gas_exec_t *exec);
+
+/**
+ * @brief Gets the counters of the executor
+ *
+ * @param[in] exec Executor
+ * @param[out] stats Pointer to populate with the counters
+ */
+void xensiv_pas_gas_exec_get_stats(xensiv_pas_gas_exec_t *exec, xensiv_pas_gas_exec_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_exec */
+
+#endif /* XENSIV_PAS_GAS_EXEC_H_ */
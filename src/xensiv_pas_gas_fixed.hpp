@@ -0,0 +1,134 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_fixed.hpp
+ *
+ * Description: This file contains the C++ facade of the XENSIV™ PAS GAS sensor driver with the
+ *              interface and variant fixed at compile time.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_FIXED_HPP_
+#define XENSIV_PAS_GAS_FIXED_HPP_
+
+#include <cstdint>
+
+#include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_co2.h"
+#include "xensiv_pas_gas_r290.h"
+#include "xensiv_pas_gas_a2l.h"
+
+/**
+ * \addtogroup group_board_libs_fixed XENSIV™ PAS GAS sensor C++ facade with fixed interface and variant
+ * \{
+ * Header-only C++17 facade selecting the communication interface and the sensor variant as template
+ * parameters. The variant specific entry points are chosen at compile time, and an interface or variant
+ * left out of the driver with the XENSIV_PAS_GAS_ENABLE_* macros fails to compile instead of failing an
+ * assertion at runtime. Built with the same macros reduced to this interface and variant, the register
+ * accesses below the facade are direct calls as well:
+ * \code
+ *  xensiv_pas_gas::fixed_sensor<XENSIV_PAS_GAS_INTERFACE_I2C, XENSIV_PAS_GAS_VARIANT_A2L> sensor;
+ *  if (XENSIV_PAS_GAS_OK == sensor.init(ctx)) {
+ *      xensiv_pas_gas_start_continuous_mode(sensor.get(), 10U);    // Any xensiv_pas_gas_* function
+ *      ...
+ *      int32_t res = sensor.get_result(val);
+ *  }
+ * \endcode
+ */
+
+namespace xensiv_pas_gas
+{
+/** XENSIV™ PAS GAS sensor device with the interface and the variant fixed at compile time */
+template<xensiv_pas_gas_interface_t Itf, xensiv_pas_gas_variant_t Variant>
+class fixed_sensor
+{
+    static_assert(((XENSIV_PAS_GAS_INTERFACE_I2C == Itf) && XENSIV_PAS_GAS_ENABLE_I2C) ||
+                  ((XENSIV_PAS_GAS_INTERFACE_UART == Itf) && XENSIV_PAS_GAS_ENABLE_UART),
+                  "Interface not compiled into the driver");
+    static_assert(((XENSIV_PAS_GAS_VARIANT_CO2 == Variant) && XENSIV_PAS_GAS_ENABLE_CO2) ||
+                  ((XENSIV_PAS_GAS_VARIANT_R290 == Variant) && XENSIV_PAS_GAS_ENABLE_R290) ||
+                  ((XENSIV_PAS_GAS_VARIANT_A2L == Variant) && XENSIV_PAS_GAS_ENABLE_A2L),
+                  "Variant not compiled into the driver");
+
+public:
+    /** Communication interface */
+    static constexpr xensiv_pas_gas_interface_t itf = Itf;
+    /** Sensor variant */
+    static constexpr xensiv_pas_gas_variant_t variant = Variant;
+
+    fixed_sensor() noexcept : dev_ {} {}
+
+    /** Device structure, for the xensiv_pas_gas_* functions */
+    xensiv_pas_gas_t *get() noexcept {
+        return &dev_;
+    }
+
+    /** Device structure, for the xensiv_pas_gas_* functions */
+    const xensiv_pas_gas_t *get() const noexcept {
+        return &dev_;
+    }
+
+    /** Initializes the sensor, see \ref xensiv_pas_gas_co2_init, \ref xensiv_pas_gas_r290_init and \ref xensiv_pas_gas_a2l_init */
+    int32_t init(void *ctx) noexcept {
+        if constexpr (XENSIV_PAS_GAS_VARIANT_CO2 == Variant) {
+            return xensiv_pas_gas_co2_init(&dev_, Itf, ctx);
+        } else if constexpr (XENSIV_PAS_GAS_VARIANT_R290 == Variant) {
+            return xensiv_pas_gas_r290_init(&dev_, Itf, ctx);
+        } else {
+            return xensiv_pas_gas_a2l_init(&dev_, Itf, ctx);
+        }
+    }
+
+    /** Adopts a sensor configured before a restart, see \ref xensiv_pas_gas_co2_attach, \ref xensiv_pas_gas_r290_attach and \ref xensiv_pas_gas_a2l_attach */
+    int32_t attach(void *ctx, bool *warm = nullptr) noexcept {
+        if constexpr (XENSIV_PAS_GAS_VARIANT_CO2 == Variant) {
+            return xensiv_pas_gas_co2_attach(&dev_, Itf, ctx, warm);
+        } else if constexpr (XENSIV_PAS_GAS_VARIANT_R290 == Variant) {
+            return xensiv_pas_gas_r290_attach(&dev_, Itf, ctx, warm);
+        } else {
+            return xensiv_pas_gas_a2l_attach(&dev_, Itf, ctx, warm);
+        }
+    }
+
+    /** Reads registers, see \ref xensiv_pas_gas_get_reg */
+    int32_t get_reg(uint8_t reg_addr, uint8_t *data, uint8_t len) const noexcept {
+        return xensiv_pas_gas_get_reg(&dev_, reg_addr, data, len);
+    }
+
+    /** Writes registers, see \ref xensiv_pas_gas_set_reg */
+    int32_t set_reg(uint8_t reg_addr, const uint8_t *data, uint8_t len) const noexcept {
+        return xensiv_pas_gas_set_reg(&dev_, reg_addr, data, len);
+    }
+
+    /** Reads a gas concentration result, see \ref xensiv_pas_gas_get_result */
+    int32_t get_result(uint16_t &val) const noexcept {
+        return xensiv_pas_gas_get_result(&dev_, &val);
+    }
+
+    /** Performs a forced compensation, see \ref xensiv_pas_gas_perform_forced_compensation */
+    int32_t perform_forced_compensation(uint16_t gas_ref) const noexcept {
+        return xensiv_pas_gas_perform_forced_compensation(&dev_, gas_ref);
+    }
+
+private:
+    xensiv_pas_gas_t dev_;
+};
+} /* namespace xensiv_pas_gas */
+
+/** \} group_board_libs_fixed */
+
+#endif /* XENSIV_PAS_GAS_FIXED_HPP_ */
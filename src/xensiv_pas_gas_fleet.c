@@ -0,0 +1,259 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_fleet.c
+ *
+ * Description: This file contains the orchestrator of the forced compensation of a fleet of
+ *              XENSIV™ PAS GAS sensors.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_fleet.h"
+
+#define XENSIV_PAS_GAS_FLEET_DEFAULT_BUS_GAP_US      (5000UL)
+#define XENSIV_PAS_GAS_FLEET_DEFAULT_POLL_MS         (0UL)
+#define XENSIV_PAS_GAS_FLEET_DEFAULT_TIMEOUT_CYCLES  (30U)
+#define XENSIV_PAS_GAS_FLEET_DEFAULT_MAX_ACTIVE      (0U)
+
+#define XENSIV_PAS_GAS_FLEET_US_PER_S                (1000000UL)
+#define XENSIV_PAS_GAS_FLEET_MS_PER_S                (1000UL)
+
+static uint64_t xensiv_pas_gas_fleet_timeout_us(const xensiv_pas_gas_fleet_t *fleet, const xensiv_pas_gas_fleet_sensor_t *sensor) {
+    return (uint64_t)fleet->config.timeout_cycles * sensor->dev->fcs_meas_rate_s * XENSIV_PAS_GAS_FLEET_US_PER_S;
+}
+
+static void xensiv_pas_gas_fleet_start(xensiv_pas_gas_fleet_t *fleet, xensiv_pas_gas_fleet_sensor_t *sensor, uint64_t time_us) {
+    sensor->state = XENSIV_PAS_GAS_FLEET_STATE_RUNNING;
+    sensor->start_us = time_us;
+
+    xensiv_pas_gas_async_forced_compensation(&sensor->op, sensor->dev, sensor->gas_ref);
+    sensor->op.poll_ms = (fleet->config.poll_ms != 0U) ? fleet->config.poll_ms : ((uint32_t)sensor->dev->fcs_meas_rate_s * XENSIV_PAS_GAS_FLEET_MS_PER_S);
+    sensor->op.timeout_cycles = fleet->config.timeout_cycles;
+    fleet->active++;
+
+    if (fleet->notify != NULL) {
+        fleet->notify(fleet->ctx, sensor);
+    }
+}
+
+static void xensiv_pas_gas_fleet_finish(xensiv_pas_gas_fleet_t *fleet, xensiv_pas_gas_fleet_sensor_t *sensor, int32_t res, uint64_t time_us) {
+    if (XENSIV_PAS_GAS_OK == res) {
+        sensor->state = XENSIV_PAS_GAS_FLEET_STATE_DONE;
+    } else if (XENSIV_PAS_GAS_TIMEOUT == res) {
+        sensor->state = XENSIV_PAS_GAS_FLEET_STATE_TIMEOUT;
+    } else {
+        sensor->state = XENSIV_PAS_GAS_FLEET_STATE_FAILED;
+    }
+    sensor->res = res;
+    sensor->end_us = time_us;
+    fleet->active--;
+    fleet->pending--;
+
+    if (fleet->notify != NULL) {
+        fleet->notify(fleet->ctx, sensor);
+    }
+}
+
+void xensiv_pas_gas_fleet_get_default_config(xensiv_pas_gas_fleet_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->bus_gap_us = XENSIV_PAS_GAS_FLEET_DEFAULT_BUS_GAP_US;
+    config->poll_ms = XENSIV_PAS_GAS_FLEET_DEFAULT_POLL_MS;
+    config->timeout_cycles = XENSIV_PAS_GAS_FLEET_DEFAULT_TIMEOUT_CYCLES;
+    config->max_active = XENSIV_PAS_GAS_FLEET_DEFAULT_MAX_ACTIVE;
+}
+
+int32_t xensiv_pas_gas_fleet_init(xensiv_pas_gas_fleet_t *fleet, const xensiv_pas_gas_fleet_config_t *config, xensiv_pas_gas_fleet_notify_fptr_t notify, void *ctx) {
+    xensiv_pas_gas_plat_assert(fleet != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if (config->timeout_cycles == 0U) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    fleet->config = *config;
+    fleet->notify = notify;
+    fleet->ctx = ctx;
+    fleet->head = NULL;
+    fleet->tail = NULL;
+    fleet->active = 0U;
+    fleet->pending = 0U;
+    for (uint8_t bus = 0U; bus < XENSIV_PAS_GAS_FLEET_MAX_BUSES; ++bus)
+    {
+        fleet->bus_free_us[bus] = 0U;
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_fleet_add(xensiv_pas_gas_fleet_t *fleet, xensiv_pas_gas_fleet_sensor_t *sensor, const xensiv_pas_gas_t *dev, uint8_t bus, uint16_t gas_ref) {
+    xensiv_pas_gas_plat_assert(fleet != NULL);
+    xensiv_pas_gas_plat_assert(sensor != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    if (bus >= XENSIV_PAS_GAS_FLEET_MAX_BUSES) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    sensor->dev = dev;
+    sensor->bus = bus;
+    sensor->gas_ref = gas_ref;
+    sensor->state = XENSIV_PAS_GAS_FLEET_STATE_QUEUED;
+    sensor->res = XENSIV_PAS_GAS_PENDING;
+    sensor->accesses = 0U;
+    sensor->start_us = 0U;
+    sensor->end_us = 0U;
+    sensor->next = NULL;
+
+    if (fleet->tail != NULL) {
+        fleet->tail->next = sensor;
+    } else {
+        fleet->head = sensor;
+    }
+    fleet->tail = sensor;
+    fleet->pending++;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_fleet_step(xensiv_pas_gas_fleet_t *fleet, uint64_t time_us) {
+    xensiv_pas_gas_plat_assert(fleet != NULL);
+
+    xensiv_pas_gas_fleet_sensor_t *next[XENSIV_PAS_GAS_FLEET_MAX_BUSES] = { NULL };
+    xensiv_pas_gas_fleet_sensor_t *sensor;
+
+    for (sensor = fleet->head; sensor != NULL; sensor = sensor->next)
+    {
+        if ((XENSIV_PAS_GAS_FLEET_STATE_QUEUED == sensor->state) &&
+            ((fleet->config.max_active == 0U) || (fleet->active < fleet->config.max_active))) {
+            xensiv_pas_gas_fleet_start(fleet, sensor, time_us);
+        }
+
+        if (XENSIV_PAS_GAS_FLEET_STATE_RUNNING != sensor->state) {
+            continue;
+        }
+
+        /* The sensor waiting longest for its access goes first */
+        uint64_t due_us = xensiv_pas_gas_async_get_due_us(&sensor->op);
+        if ((due_us <= time_us) &&
+            ((next[sensor->bus] == NULL) || (due_us < xensiv_pas_gas_async_get_due_us(&next[sensor->bus]->op)))) {
+            next[sensor->bus] = sensor;
+        }
+    }
+
+    for (uint8_t bus = 0U; bus < XENSIV_PAS_GAS_FLEET_MAX_BUSES; ++bus)
+    {
+        sensor = next[bus];
+        if ((sensor == NULL) || (fleet->bus_free_us[bus] > time_us)) {
+            continue;
+        }
+
+        int32_t res = xensiv_pas_gas_async_step(&sensor->op, time_us);
+        if (XENSIV_PAS_GAS_PENDING == res) {
+            sensor->accesses++;
+            fleet->bus_free_us[bus] = time_us + fleet->config.bus_gap_us;
+        } else {
+            /* Completing an operation does not access the bus */
+            xensiv_pas_gas_fleet_finish(fleet, sensor, res, time_us);
+        }
+    }
+
+    return (fleet->pending == 0U) ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_PENDING;
+}
+
+uint64_t xensiv_pas_gas_fleet_get_due_us(const xensiv_pas_gas_fleet_t *fleet) {
+    xensiv_pas_gas_plat_assert(fleet != NULL);
+
+    uint64_t due_us = UINT64_MAX;
+
+    for (const xensiv_pas_gas_fleet_sensor_t *sensor = fleet->head; sensor != NULL; sensor = sensor->next)
+    {
+        if ((XENSIV_PAS_GAS_FLEET_STATE_QUEUED == sensor->state) &&
+            ((fleet->config.max_active == 0U) || (fleet->active < fleet->config.max_active))) {
+            return 0U;
+        }
+
+        if (XENSIV_PAS_GAS_FLEET_STATE_RUNNING == sensor->state) {
+            uint64_t op_due_us = xensiv_pas_gas_async_get_due_us(&sensor->op);
+            uint64_t bus_free_us = fleet->bus_free_us[sensor->bus];
+            uint64_t sensor_due_us = (op_due_us > bus_free_us) ? op_due_us : bus_free_us;
+
+            if (sensor_due_us < due_us) {
+                due_us = sensor_due_us;
+            }
+        }
+    }
+
+    return due_us;
+}
+
+void xensiv_pas_gas_fleet_get_progress(const xensiv_pas_gas_fleet_t *fleet, const xensiv_pas_gas_fleet_sensor_t *sensor, uint64_t time_us, xensiv_pas_gas_fleet_progress_t *progress) {
+    xensiv_pas_gas_plat_assert(fleet != NULL);
+    xensiv_pas_gas_plat_assert(sensor != NULL);
+    xensiv_pas_gas_plat_assert(progress != NULL);
+
+    progress->state = sensor->state;
+    progress->res = sensor->res;
+    progress->timeout_us = xensiv_pas_gas_fleet_timeout_us(fleet, sensor);
+    progress->accesses = sensor->accesses;
+
+    switch (sensor->state)
+    {
+        case XENSIV_PAS_GAS_FLEET_STATE_QUEUED:
+            progress->elapsed_us = 0U;
+            break;
+        case XENSIV_PAS_GAS_FLEET_STATE_RUNNING:
+            progress->elapsed_us = (time_us > sensor->start_us) ? (time_us - sensor->start_us) : 0U;
+            break;
+        default:
+            progress->elapsed_us = sensor->end_us - sensor->start_us;
+            break;
+    }
+}
+
+void xensiv_pas_gas_fleet_get_stats(const xensiv_pas_gas_fleet_t *fleet, xensiv_pas_gas_fleet_stats_t *stats) {
+    xensiv_pas_gas_plat_assert(fleet != NULL);
+    xensiv_pas_gas_plat_assert(stats != NULL);
+
+    stats->queued = 0U;
+    stats->running = 0U;
+    stats->done = 0U;
+    stats->failed = 0U;
+    stats->timed_out = 0U;
+
+    for (const xensiv_pas_gas_fleet_sensor_t *sensor = fleet->head; sensor != NULL; sensor = sensor->next)
+    {
+        switch (sensor->state)
+        {
+            case XENSIV_PAS_GAS_FLEET_STATE_QUEUED:
+                stats->queued++;
+                break;
+            case XENSIV_PAS_GAS_FLEET_STATE_RUNNING:
+                stats->running++;
+                break;
+            case XENSIV_PAS_GAS_FLEET_STATE_DONE:
+                stats->done++;
+                break;
+            case XENSIV_PAS_GAS_FLEET_STATE_FAILED:
+                stats->failed++;
+                break;
+            default:
+                stats->timed_out++;
+                break;
+        }
+    }
+}
@@ -0,0 +1,235 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_fleet.h
+ *
+ * Description: This file contains the orchestrator of the forced compensation of a fleet of
+ *              XENSIV™ PAS GAS sensors.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_FLEET_H_
+#define XENSIV_PAS_GAS_FLEET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas_async.h"
+
+/**
+ * \addtogroup group_board_libs_fleet XENSIV™ PAS GAS sensor fleet forced compensation
+ * \{
+ * Orchestrator which runs the forced compensation of many sensors at once, e.g. a commissioning batch, so
+ * that the calibration takes as long as the slowest sensor instead of the sum of all sensors.
+ *
+ * Each sensor runs \ref xensiv_pas_gas_async_forced_compensation: it is set to continuous mode at its
+ * fcs_meas_rate_s with the forced BOC, MEAS_CFG is read every poll_ms until the sensor clears the forced
+ * BOC, and for the CO2 variant the offset is saved with the SAVE_FCS_CALIB_OFFSET command. The sensors
+ * measure on their own, so only the register accesses are shared: on each bus at most one access is
+ * performed every bus_gap_us, and among the sensors of a bus the one waiting longest is served first.
+ * At most max_active sensors are compensated at a time, the others wait in the order they were added.
+ *
+ * A sensor whose forced BOC is still set timeout_cycles measurement periods after it was written is set to
+ * idle with the automatic BOC by the operation itself and reported with \ref XENSIV_PAS_GAS_TIMEOUT; the
+ * limit only applies while MEAS_CFG is polled, so the save of a completed CO2 offset is never cut short. A sensor failing with a communication
+ * error does not affect the others.
+ *
+ * The orchestrator drives all sensors from a single thread; no other operation may run on the sensors
+ * until they are finished. The timestamps are passed by the application, in microseconds of any monotonic
+ * clock:
+ * \code
+ *  xensiv_pas_gas_fleet_config_t config;
+ *  xensiv_pas_gas_fleet_get_default_config(&config);
+ *  xensiv_pas_gas_fleet_init(&fleet, &config, on_progress, NULL);
+ *  for (i = 0U; i < n; ++i) {
+ *      xensiv_pas_gas_fleet_add(&fleet, &sensors[i], &devs[i], bus_of[i], 400U);
+ *  }
+ *
+ *  while (XENSIV_PAS_GAS_PENDING == xensiv_pas_gas_fleet_step(&fleet, now_us())) {
+ *      sleep_until_us(xensiv_pas_gas_fleet_get_due_us(&fleet));
+ *  }
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Number of buses, numbered from 0, the orchestrator spaces the accesses of */
+#define XENSIV_PAS_GAS_FLEET_MAX_BUSES           (8U)
+
+/********************************* Type definitions **************************************/
+
+/** Progress of the forced compensation of a sensor */
+typedef enum
+{
+    XENSIV_PAS_GAS_FLEET_STATE_QUEUED = 0U,             /**< Waiting for a free slot */
+    XENSIV_PAS_GAS_FLEET_STATE_RUNNING = 1U,            /**< Forced compensation in progress */
+    XENSIV_PAS_GAS_FLEET_STATE_DONE = 2U,               /**< Forced compensation completed and, for the CO2 variant, saved */
+    XENSIV_PAS_GAS_FLEET_STATE_FAILED = 3U,             /**< Forced compensation aborted by an error */
+    XENSIV_PAS_GAS_FLEET_STATE_TIMEOUT = 4U             /**< Forced compensation not completed in time, the sensor was set to idle */
+} xensiv_pas_gas_fleet_state_t;
+
+/** Configuration of the orchestrator */
+typedef struct
+{
+    uint32_t bus_gap_us;                    /*!< Minimum time between two register accesses on the same bus */
+    uint32_t poll_ms;                       /*!< Interval between the MEAS_CFG reads of a sensor; 0 for once per measurement period */
+    uint16_t timeout_cycles;                /*!< Number of measurement periods after which the forced compensation of a sensor is abandoned */
+    uint16_t max_active;                    /*!< Maximum number of sensors compensated at a time; 0 for no limit */
+} xensiv_pas_gas_fleet_config_t;
+
+/** Sensor of the fleet, allocated by the user. The members are private to the orchestrator. */
+typedef struct xensiv_pas_gas_fleet_sensor_s
+{
+    const xensiv_pas_gas_t *dev;            /*!< Sensor device */
+    uint8_t bus;                            /*!< Bus the sensor is connected to */
+    uint16_t gas_ref;                       /*!< Reference gas concentration */
+    xensiv_pas_gas_fleet_state_t state;     /*!< Progress */
+    int32_t res;                            /*!< Result once finished; XENSIV_PAS_GAS_PENDING before */
+    uint16_t accesses;                      /*!< Number of register accesses performed */
+    uint64_t start_us;                      /*!< Time the forced compensation was started */
+    uint64_t end_us;                        /*!< Time the sensor finished */
+    xensiv_pas_gas_async_t op;              /*!< Operation in progress */
+    struct xensiv_pas_gas_fleet_sensor_s *next; /*!< Next sensor of the fleet */
+} xensiv_pas_gas_fleet_sensor_t;
+
+/** Progress report of a sensor */
+typedef struct
+{
+    xensiv_pas_gas_fleet_state_t state;     /*!< Progress */
+    int32_t res;                            /*!< Result once finished; XENSIV_PAS_GAS_PENDING before */
+    uint64_t elapsed_us;                    /*!< Time since the start of the forced compensation, up to its end */
+    uint64_t timeout_us;                    /*!< Time allowed for the forced compensation */
+    uint16_t accesses;                      /*!< Number of register accesses performed */
+} xensiv_pas_gas_fleet_progress_t;
+
+/** Number of sensors of the fleet in each state */
+typedef struct
+{
+    uint16_t queued;                        /*!< Waiting for a free slot */
+    uint16_t running;                       /*!< Forced compensation in progress */
+    uint16_t done;                          /*!< Completed successfully */
+    uint16_t failed;                        /*!< Aborted by an error */
+    uint16_t timed_out;                     /*!< Not completed in time */
+} xensiv_pas_gas_fleet_stats_t;
+
+/**
+ * Function called when a sensor starts and when it finishes
+ *
+ * @param[in] ctx Context passed to \ref xensiv_pas_gas_fleet_init
+ * @param[in] sensor Sensor whose state changed, see \ref xensiv_pas_gas_fleet_get_progress
+ */
+typedef void (*xensiv_pas_gas_fleet_notify_fptr_t)(void *ctx, const xensiv_pas_gas_fleet_sensor_t *sensor);
+
+/** State of the orchestrator. The members are private to the orchestrator. */
+typedef struct
+{
+    xensiv_pas_gas_fleet_config_t config;   /*!< Configuration */
+    xensiv_pas_gas_fleet_notify_fptr_t notify;  /*!< Progress notification; NULL for none */
+    void *ctx;                              /*!< Context of the notification */
+    xensiv_pas_gas_fleet_sensor_t *head;    /*!< First sensor */
+    xensiv_pas_gas_fleet_sensor_t *tail;    /*!< Last sensor */
+    uint16_t active;                        /*!< Number of running sensors */
+    uint16_t pending;                       /*!< Number of sensors not finished */
+    uint64_t bus_free_us[XENSIV_PAS_GAS_FLEET_MAX_BUSES];  /*!< Time from which each bus can be accessed again */
+} xensiv_pas_gas_fleet_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default orchestrator configuration.
+ * bus_gap_us 5 ms, one MEAS_CFG read per measurement period, timeout after 30 measurement periods, no
+ * limit on the number of sensors compensated at a time.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_fleet_get_default_config(xensiv_pas_gas_fleet_config_t *config);
+
+/**
+ * @brief Initializes an empty fleet
+ *
+ * @param[out] fleet Orchestrator state allocated by the user
+ * @param[in] config Orchestrator configuration
+ * @param[in] notify Function called when a sensor starts and when it finishes, from \ref xensiv_pas_gas_fleet_step;
+ * NULL for none
+ * @param[in] ctx Context passed to notify
+ * @return XENSIV_PAS_GAS_OK if the fleet was initialized; XENSIV_PAS_GAS_INVALID_PARAMETER if timeout_cycles is 0
+ */
+int32_t xensiv_pas_gas_fleet_init(xensiv_pas_gas_fleet_t *fleet, const xensiv_pas_gas_fleet_config_t *config, xensiv_pas_gas_fleet_notify_fptr_t notify, void *ctx);
+
+/**
+ * @brief Adds a sensor to the fleet.
+ * The forced compensation of the sensor starts at the next step with a free slot.
+ *
+ * @param[in] fleet Orchestrator state
+ * @param[out] sensor Sensor state allocated by the user; it is kept until the fleet is finished
+ * @param[in] dev Pointer to the initialized XENSIV™ PAS GAS sensor device
+ * @param[in] bus Bus the sensor is connected to, below \ref XENSIV_PAS_GAS_FLEET_MAX_BUSES
+ * @param[in] gas_ref Reference gas concentration the sensor is exposed to
+ * @return XENSIV_PAS_GAS_OK if the sensor was added; XENSIV_PAS_GAS_INVALID_PARAMETER if the bus is out of range
+ */
+int32_t xensiv_pas_gas_fleet_add(xensiv_pas_gas_fleet_t *fleet, xensiv_pas_gas_fleet_sensor_t *sensor, const xensiv_pas_gas_t *dev, uint8_t bus, uint16_t gas_ref);
+
+/**
+ * @brief Advances the forced compensation of the fleet.
+ * Starts the queued sensors there is a slot for, abandons the sensors which timed out and performs the
+ * register accesses due at time_us, at most one per bus.
+ *
+ * @param[in] fleet Orchestrator state
+ * @param[in] time_us Current time
+ * @return XENSIV_PAS_GAS_PENDING if the fleet must be stepped again at \ref xensiv_pas_gas_fleet_get_due_us;
+ * XENSIV_PAS_GAS_OK once all sensors are finished, whatever their result
+ */
+int32_t xensiv_pas_gas_fleet_step(xensiv_pas_gas_fleet_t *fleet, uint64_t time_us);
+
+/**
+ * @brief Gets the time of the next step of the fleet
+ *
+ * @param[in] fleet Orchestrator state
+ * @return Time at which \ref xensiv_pas_gas_fleet_step must be called; 0 if it can be called immediately;
+ * UINT64_MAX if all sensors are finished
+ */
+uint64_t xensiv_pas_gas_fleet_get_due_us(const xensiv_pas_gas_fleet_t *fleet);
+
+/**
+ * @brief Gets the progress of a sensor
+ *
+ * @param[in] fleet Orchestrator state
+ * @param[in] sensor Sensor of the fleet
+ * @param[in] time_us Current time
+ * @param[out] progress Pointer to populate with the progress
+ */
+void xensiv_pas_gas_fleet_get_progress(const xensiv_pas_gas_fleet_t *fleet, const xensiv_pas_gas_fleet_sensor_t *sensor, uint64_t time_us, xensiv_pas_gas_fleet_progress_t *progress);
+
+/**
+ * @brief Gets the number of sensors of the fleet in each state
+ *
+ * @param[in] fleet Orchestrator state
+ * @param[out] stats Pointer to populate with the counts
+ */
+void xensiv_pas_gas_fleet_get_stats(const xensiv_pas_gas_fleet_t *fleet, xensiv_pas_gas_fleet_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_fleet */
+
+#endif /* XENSIV_PAS_GAS_FLEET_H_ */
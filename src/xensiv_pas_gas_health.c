@@ -0,0 +1,143 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_health.c
+ *
+ * Description: This file contains the fleet-wide health monitor of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_health.h"
+#include "xensiv_pas_gas_a2l_regs.h"
+#include "xensiv_pas_gas_r290_regs.h"
+
+extern bool xensiv_pas_gas_base_reaches(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len);
+
+#define XENSIV_PAS_GAS_HEALTH_DEFAULT_PERIOD_US     (60000000ULL)
+
+/* Reads SENS_STS and SELF_TEST into a health word */
+static int32_t xensiv_pas_gas_health_read(const xensiv_pas_gas_t *dev, uint32_t *health) {
+    uint8_t sens_sts;
+    uint8_t self_test = 0U;
+    int32_t res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, &sens_sts, 1U);
+
+    if ((XENSIV_PAS_GAS_OK == res) && xensiv_pas_gas_base_reaches(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_SELF_TEST, 1U)) {
+        if (XENSIV_PAS_GAS_VARIANT_A2L == dev->variant) {
+            res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_SELF_TEST, &self_test, 1U);
+        } else if (XENSIV_PAS_GAS_VARIANT_R290 == dev->variant) {
+            res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_R290_REG_SELF_TEST, &self_test, 1U);
+        } else {
+            /* The CO2 variant has no self test */
+        }
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        *health = ((uint32_t)self_test << XENSIV_PAS_GAS_HEALTH_SELF_TEST_POS) |
+                  ((uint32_t)sens_sts << XENSIV_PAS_GAS_HEALTH_SENS_STS_POS);
+    }
+
+    return res;
+}
+
+void xensiv_pas_gas_health_get_default_config(xensiv_pas_gas_health_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->period_us = XENSIV_PAS_GAS_HEALTH_DEFAULT_PERIOD_US;
+    config->fault_mask = XENSIV_PAS_GAS_HEALTH_DEFAULT_FAULT_MSK;
+}
+
+int32_t xensiv_pas_gas_health_init(xensiv_pas_gas_health_t *mon, const xensiv_pas_gas_t *const *devs, size_t dev_count,
+                                   const xensiv_pas_gas_health_config_t *config) {
+    xensiv_pas_gas_plat_assert(mon != NULL);
+    xensiv_pas_gas_plat_assert(devs != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if ((dev_count == 0U) || (dev_count > XENSIV_PAS_GAS_HEALTH_MAX_DEVS)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    mon->devs = devs;
+    mon->dev_count = dev_count;
+    mon->config = *config;
+    mon->next_idx = 0U;
+    mon->started = false;
+    mon->next_us = 0U;
+    mon->fleet = 0U;
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HEALTH_MAX_DEVS; ++i)
+    {
+        mon->health[i] = 0U;
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_health_step(xensiv_pas_gas_health_t *mon, uint64_t time_us, xensiv_pas_gas_health_event_t *event) {
+    xensiv_pas_gas_plat_assert(mon != NULL);
+    xensiv_pas_gas_plat_assert(event != NULL);
+
+    if (mon->started && (time_us < mon->next_us)) {
+        return XENSIV_PAS_GAS_READ_NRDY;
+    }
+
+    size_t idx = mon->next_idx;
+    mon->next_idx = (idx + 1U) % mon->dev_count;
+    mon->next_us = time_us + (mon->config.period_us / mon->dev_count);
+    mon->started = true;
+
+    uint32_t prev = mon->health[idx];
+    uint32_t health;
+
+    if (XENSIV_PAS_GAS_OK != xensiv_pas_gas_health_read(mon->devs[idx], &health)) {
+        health = prev | XENSIV_PAS_GAS_HEALTH_COMM_ERR_MSK;
+    }
+
+    mon->health[idx] = health;
+    if ((health & mon->config.fault_mask) != 0U) {
+        mon->fleet |= (1UL << idx);
+    } else {
+        mon->fleet &= ~(1UL << idx);
+    }
+
+    if (health == prev) {
+        return XENSIV_PAS_GAS_READ_NRDY;
+    }
+
+    event->dev_idx = idx;
+    event->health = health;
+    event->changed = health ^ prev;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+uint64_t xensiv_pas_gas_health_get_due_us(const xensiv_pas_gas_health_t *mon) {
+    xensiv_pas_gas_plat_assert(mon != NULL);
+
+    return mon->started ? mon->next_us : 0U;
+}
+
+uint32_t xensiv_pas_gas_health_get_health(const xensiv_pas_gas_health_t *mon, size_t dev_idx) {
+    xensiv_pas_gas_plat_assert(mon != NULL);
+    xensiv_pas_gas_plat_assert(dev_idx < mon->dev_count);
+
+    return mon->health[dev_idx];
+}
+
+uint32_t xensiv_pas_gas_health_get_fleet(const xensiv_pas_gas_health_t *mon) {
+    xensiv_pas_gas_plat_assert(mon != NULL);
+
+    return mon->fleet;
+}
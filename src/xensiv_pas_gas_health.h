@@ -0,0 +1,184 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_health.h
+ *
+ * Description: This file contains the fleet-wide health monitor of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_HEALTH_H_
+#define XENSIV_PAS_GAS_HEALTH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_health XENSIV™ PAS GAS sensor health monitor
+ * \{
+ * Monitor which polls SENS_STS and, for the R290 and A2L variants, SELF_TEST of a fleet of sensors and reports
+ * the bit transitions only.
+ *
+ * The health of each sensor is kept in a word holding SELF_TEST, SENS_STS and a communication error bit. The
+ * sensors are polled one at a time in round robin, spread evenly over period_us, with two single-byte reads
+ * (the registers are not contiguous; one read for the CO2 variant and over UART, where SELF_TEST is beyond the
+ * register range and left 0). The monitor never blocks: call
+ * \ref xensiv_pas_gas_health_step whenever the bus is idle, e.g. from the idle loop or after the result reads,
+ * and it only accesses the bus once a poll is due. The fleet bitmap holds one bit per sensor whose health word
+ * has a bit of fault_mask set.
+ *
+ * \code
+ *  static const xensiv_pas_gas_t *const devs[] = { &dev0, &dev1, &dev2 };
+ *  xensiv_pas_gas_health_config_t config;
+ *  xensiv_pas_gas_health_get_default_config(&config);
+ *  xensiv_pas_gas_health_init(&mon, devs, 3U, &config);
+ *
+ *  // Bus idle
+ *  if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_health_step(&mon, now_us(), &event)) {
+ *      report(event.dev_idx, event.changed, event.health);
+ *  }
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Maximum number of sensors monitored by one health monitor */
+#define XENSIV_PAS_GAS_HEALTH_MAX_DEVS              (32U)
+
+/** Position of SELF_TEST in the health word */
+#define XENSIV_PAS_GAS_HEALTH_SELF_TEST_POS         (0U)
+
+/** SELF_TEST bits of the health word, always 0 for the CO2 variant and over UART */
+#define XENSIV_PAS_GAS_HEALTH_SELF_TEST_MSK         (0xFFUL << XENSIV_PAS_GAS_HEALTH_SELF_TEST_POS)
+
+/** Position of SENS_STS in the health word */
+#define XENSIV_PAS_GAS_HEALTH_SENS_STS_POS          (8U)
+
+/** SENS_STS bits of the health word */
+#define XENSIV_PAS_GAS_HEALTH_SENS_STS_MSK          (0xFFUL << XENSIV_PAS_GAS_HEALTH_SENS_STS_POS)
+
+/** Communication error bit of the health word, set while the sensor cannot be read; the other bits then keep their last value */
+#define XENSIV_PAS_GAS_HEALTH_COMM_ERR_MSK          (1UL << 16U)
+
+/** Default fault mask: SELF_TEST voltage, temperature, SIMIC, emitter, ABOC drift and lifetime errors, SENS_STS ICCERR,
+ * ORVS and ORTMP, and the communication error */
+#define XENSIV_PAS_GAS_HEALTH_DEFAULT_FAULT_MSK     ((0x3FUL << XENSIV_PAS_GAS_HEALTH_SELF_TEST_POS) | \
+                                                     (0x38UL << XENSIV_PAS_GAS_HEALTH_SENS_STS_POS) | \
+                                                     XENSIV_PAS_GAS_HEALTH_COMM_ERR_MSK)
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the health monitor */
+typedef struct
+{
+    uint64_t period_us;                     /*!< Interval between two polls of the same sensor */
+    uint32_t fault_mask;                    /*!< Bits of the health word which mark a sensor as faulty in the fleet bitmap */
+} xensiv_pas_gas_health_config_t;
+
+/** Health transition of a sensor */
+typedef struct
+{
+    size_t dev_idx;                         /*!< Index of the sensor in the monitored array */
+    uint32_t health;                        /*!< New health word */
+    uint32_t changed;                       /*!< Bits of the health word which changed */
+} xensiv_pas_gas_health_event_t;
+
+/** State of the health monitor. The members are private to the monitor. */
+typedef struct
+{
+    const xensiv_pas_gas_t *const *devs;    /*!< Monitored sensor devices */
+    size_t dev_count;                       /*!< Number of monitored sensor devices */
+    xensiv_pas_gas_health_config_t config;  /*!< Configuration */
+    size_t next_idx;                        /*!< Index of the next sensor to poll */
+    bool started;                           /*!< next_us is valid */
+    uint64_t next_us;                       /*!< Time the next poll is due */
+    uint32_t fleet;                         /*!< Fleet bitmap */
+    uint32_t health[XENSIV_PAS_GAS_HEALTH_MAX_DEVS];    /*!< Health word of each sensor */
+} xensiv_pas_gas_health_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default configuration.
+ * period_us 60 s, fault_mask \ref XENSIV_PAS_GAS_HEALTH_DEFAULT_FAULT_MSK.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_health_get_default_config(xensiv_pas_gas_health_config_t *config);
+
+/**
+ * @brief Initializes the monitor. The health words start at 0, so the first poll of each sensor reports its initial health.
+ *
+ * @param[out] mon Monitor state allocated by the user
+ * @param[in] devs Array of pointers to the monitored sensor devices, must remain valid while the monitor is used
+ * @param[in] dev_count Number of devices, at most \ref XENSIV_PAS_GAS_HEALTH_MAX_DEVS
+ * @param[in] config Monitor configuration
+ * @return XENSIV_PAS_GAS_OK if the monitor was initialized; XENSIV_PAS_GAS_INVALID_PARAMETER if dev_count is out of range
+ */
+int32_t xensiv_pas_gas_health_init(xensiv_pas_gas_health_t *mon, const xensiv_pas_gas_t *const *devs, size_t dev_count,
+                                   const xensiv_pas_gas_health_config_t *config);
+
+/**
+ * @brief Polls the next sensor if its poll is due. Call it when the bus is idle.
+ *
+ * @param[in] mon Monitor state
+ * @param[in] time_us Current time, in microseconds of any monotonic clock
+ * @param[out] event Pointer to populate with the health transition
+ * @return XENSIV_PAS_GAS_OK if the health of the polled sensor changed; XENSIV_PAS_GAS_READ_NRDY if no poll was due or
+ * the health did not change. A communication error is reported as a transition of \ref XENSIV_PAS_GAS_HEALTH_COMM_ERR_MSK.
+ */
+int32_t xensiv_pas_gas_health_step(xensiv_pas_gas_health_t *mon, uint64_t time_us, xensiv_pas_gas_health_event_t *event);
+
+/**
+ * @brief Gets the time the next poll is due
+ *
+ * @param[in] mon Monitor state
+ * @return Time at which \ref xensiv_pas_gas_health_step accesses the bus
+ */
+uint64_t xensiv_pas_gas_health_get_due_us(const xensiv_pas_gas_health_t *mon);
+
+/**
+ * @brief Gets the health word of a sensor
+ *
+ * @param[in] mon Monitor state
+ * @param[in] dev_idx Index of the sensor in the monitored array
+ * @return Health word, see \ref XENSIV_PAS_GAS_HEALTH_SELF_TEST_MSK, \ref XENSIV_PAS_GAS_HEALTH_SENS_STS_MSK and
+ * \ref XENSIV_PAS_GAS_HEALTH_COMM_ERR_MSK
+ */
+uint32_t xensiv_pas_gas_health_get_health(const xensiv_pas_gas_health_t *mon, size_t dev_idx);
+
+/**
+ * @brief Gets the fleet bitmap
+ *
+ * @param[in] mon Monitor state
+ * @return Bit i set if the health word of sensor i has a bit of fault_mask set
+ */
+uint32_t xensiv_pas_gas_health_get_fleet(const xensiv_pas_gas_health_t *mon);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_health */
+
+#endif /* XENSIV_PAS_GAS_HEALTH_H_ */
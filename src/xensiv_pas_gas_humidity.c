@@ -0,0 +1,228 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_humidity.c
+ *
+ * Description: This file contains the humidity compensation feed of the XENSIV™ PAS GAS A2L sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_humidity.h"
+
+extern bool xensiv_pas_gas_base_reaches(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len);
+
+/* Temperature step of the saturation vapour density table, in 0.01 °C */
+#define XENSIV_PAS_GAS_HUMIDITY_TEMP_STEP                   (200)
+
+/* Saturation vapour density in mg/m³ from -40 °C to 86 °C in 2 °C steps,
+ * 216.7 * 6.112 * exp(17.62 * T / (243.12 + T)) / (273.15 + T) */
+static const uint32_t xensiv_pas_gas_humidity_sat_density[] =
+{
+    177U, 215U, 261U, 316U, 380U, 456U, 545U, 650U,
+    772U, 914U, 1078U, 1269U, 1489U, 1741U, 2032U, 2364U,
+    2743U, 3174U, 3665U, 4220U, 4849U, 5558U, 6356U, 7253U,
+    8258U, 9383U, 10639U, 12039U, 13597U, 15326U, 17243U, 19364U,
+    21707U, 24291U, 27136U, 30264U, 33697U, 37459U, 41576U, 46074U,
+    50983U, 56332U, 62152U, 68478U, 75343U, 82785U, 90842U, 99553U,
+    108962U, 119111U, 130048U, 141819U, 154475U, 168066U, 182649U, 198277U,
+    215010U, 232907U, 252032U, 272449U, 294224U, 317427U, 342130U, 368406U,
+};
+
+uint32_t xensiv_pas_gas_humidity_abs_from_rel(uint16_t rh, int16_t temp) {
+    if (rh > XENSIV_PAS_GAS_HUMIDITY_RH_MAX) {
+        rh = XENSIV_PAS_GAS_HUMIDITY_RH_MAX;
+    }
+
+    int32_t t = temp;
+    if (t < XENSIV_PAS_GAS_HUMIDITY_TEMP_MIN) {
+        t = XENSIV_PAS_GAS_HUMIDITY_TEMP_MIN;
+    } else if (t > XENSIV_PAS_GAS_HUMIDITY_TEMP_MAX) {
+        t = XENSIV_PAS_GAS_HUMIDITY_TEMP_MAX;
+    }
+
+    uint32_t offset = (uint32_t)(t - XENSIV_PAS_GAS_HUMIDITY_TEMP_MIN);
+    size_t idx = offset / XENSIV_PAS_GAS_HUMIDITY_TEMP_STEP;
+    uint32_t frac = offset % XENSIV_PAS_GAS_HUMIDITY_TEMP_STEP;
+    uint32_t sat = xensiv_pas_gas_humidity_sat_density[idx];
+
+    if (frac != 0U) {
+        sat += ((xensiv_pas_gas_humidity_sat_density[idx + 1U] - sat) * frac) / XENSIV_PAS_GAS_HUMIDITY_TEMP_STEP;
+    }
+
+    /* At most 368406 * 10000, which fits in 32 bits */
+    return ((sat * rh) + (XENSIV_PAS_GAS_HUMIDITY_RH_MAX / 2U)) / XENSIV_PAS_GAS_HUMIDITY_RH_MAX;
+}
+
+#if XENSIV_PAS_GAS_ENABLE_A2L
+
+#define XENSIV_PAS_GAS_HUMIDITY_FEED_DEFAULT_THRESHOLD_MG   (500UL)
+#define XENSIV_PAS_GAS_HUMIDITY_FEED_DEFAULT_MAX_AGE_US     (600000000ULL)
+
+/* mg/m³ per LSB of ABS_HUM_REF */
+#define XENSIV_PAS_GAS_HUMIDITY_MG_PER_LSB                  (1000UL)
+
+static uint16_t xensiv_pas_gas_humidity_to_ref(uint32_t abs_mg) {
+    uint32_t ref = (abs_mg + (XENSIV_PAS_GAS_HUMIDITY_MG_PER_LSB / 2U)) / XENSIV_PAS_GAS_HUMIDITY_MG_PER_LSB;
+
+    return (ref > XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX) ? XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX : (uint16_t)ref;
+}
+
+static uint32_t xensiv_pas_gas_humidity_all_mask(size_t dev_count) {
+    return (dev_count == XENSIV_PAS_GAS_HUMIDITY_FEED_MAX_DEVS) ? UINT32_MAX : ((1UL << dev_count) - 1U);
+}
+
+void xensiv_pas_gas_humidity_feed_get_default_config(xensiv_pas_gas_humidity_feed_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->threshold_mg = XENSIV_PAS_GAS_HUMIDITY_FEED_DEFAULT_THRESHOLD_MG;
+    config->max_age_us = XENSIV_PAS_GAS_HUMIDITY_FEED_DEFAULT_MAX_AGE_US;
+}
+
+int32_t xensiv_pas_gas_humidity_feed_init(xensiv_pas_gas_humidity_feed_t *feed, const xensiv_pas_gas_t *const *devs, size_t dev_count,
+                                          const xensiv_pas_gas_humidity_feed_config_t *config) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+    xensiv_pas_gas_plat_assert(devs != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if ((dev_count == 0U) || (dev_count > XENSIV_PAS_GAS_HUMIDITY_FEED_MAX_DEVS)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    /* ABS_HUM_REF and HC_CTRL are beyond the UART register range */
+    for (size_t i = 0U; i < dev_count; ++i)
+    {
+        if (!xensiv_pas_gas_base_reaches(devs[i], XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H, 3U)) {
+            return XENSIV_PAS_GAS_INVALID_PARAMETER;
+        }
+    }
+
+    feed->devs = devs;
+    feed->dev_count = dev_count;
+    feed->config = *config;
+    feed->abs_mg = 0U;
+    feed->has_written = false;
+    feed->written_mg = 0U;
+    feed->written_us = 0U;
+    feed->stale_mask = 0U;
+    feed->enabled_mask = 0U;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_humidity_feed_update(xensiv_pas_gas_humidity_feed_t *feed, uint64_t time_us, uint16_t rh, int16_t temp) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+
+    feed->abs_mg = xensiv_pas_gas_humidity_abs_from_rel(rh, temp);
+
+    uint32_t delta = (feed->abs_mg > feed->written_mg) ? (feed->abs_mg - feed->written_mg) : (feed->written_mg - feed->abs_mg);
+    bool changed = (delta >= feed->config.threshold_mg) &&
+                   (xensiv_pas_gas_humidity_to_ref(feed->abs_mg) != xensiv_pas_gas_humidity_to_ref(feed->written_mg));
+
+    if (!feed->has_written || changed ||
+        ((feed->config.max_age_us != 0U) && ((time_us - feed->written_us) >= feed->config.max_age_us))) {
+        feed->written_mg = feed->abs_mg;
+        feed->written_us = time_us;
+        feed->has_written = true;
+        feed->stale_mask = xensiv_pas_gas_humidity_all_mask(feed->dev_count);
+    }
+
+    int32_t res = XENSIV_PAS_GAS_OK;
+    uint16_t ref = xensiv_pas_gas_humidity_to_ref(feed->written_mg);
+
+    for (size_t i = 0U; i < feed->dev_count; ++i)
+    {
+        uint32_t bit = 1UL << i;
+        int32_t dev_res = XENSIV_PAS_GAS_OK;
+
+        if ((feed->stale_mask & bit) != 0U) {
+            dev_res = xensiv_pas_gas_a2l_set_absolute_humidity_ref(feed->devs[i], ref);
+            if (XENSIV_PAS_GAS_OK == dev_res) {
+                feed->stale_mask &= ~bit;
+            }
+        }
+
+        /* The compensation is only enabled once the sensor holds a reference */
+        if ((XENSIV_PAS_GAS_OK == dev_res) && ((feed->stale_mask & bit) == 0U) && ((feed->enabled_mask & bit) == 0U)) {
+            xensiv_pas_gas_a2l_humidity_control_t hc_control = { .u = 0U };
+            hc_control.b.hc_enable = 1U;
+            hc_control.b.hc_err_clr = 1U;
+            dev_res = xensiv_pas_gas_a2l_set_humidity_control(feed->devs[i], hc_control);
+            if (XENSIV_PAS_GAS_OK == dev_res) {
+                feed->enabled_mask |= bit;
+            }
+        }
+
+        if ((XENSIV_PAS_GAS_OK != dev_res) && (XENSIV_PAS_GAS_OK == res)) {
+            res = dev_res;
+        }
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_humidity_feed_check(xensiv_pas_gas_humidity_feed_t *feed) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    for (size_t i = 0U; i < feed->dev_count; ++i)
+    {
+        uint32_t bit = 1UL << i;
+        xensiv_pas_gas_a2l_humidity_control_t hc_control;
+        int32_t dev_res = xensiv_pas_gas_a2l_get_humidity_control(feed->devs[i], &hc_control);
+
+        if (XENSIV_PAS_GAS_OK == dev_res) {
+            if ((hc_control.b.hc_enable == 0U) || (hc_control.b.hum_err != 0U) ||
+                (hc_control.b.hum_stale != 0U) || (hc_control.b.hum_mis_abs != 0U)) {
+                feed->stale_mask |= bit;
+                feed->enabled_mask &= ~bit;
+            }
+        } else if (XENSIV_PAS_GAS_OK == res) {
+            res = dev_res;
+        }
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_humidity_feed_stop(xensiv_pas_gas_humidity_feed_t *feed) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+
+    int32_t res = XENSIV_PAS_GAS_OK;
+    xensiv_pas_gas_a2l_humidity_control_t hc_control = { .u = 0U };
+
+    for (size_t i = 0U; i < feed->dev_count; ++i)
+    {
+        int32_t dev_res = xensiv_pas_gas_a2l_set_humidity_control(feed->devs[i], hc_control);
+
+        if (XENSIV_PAS_GAS_OK == dev_res) {
+            feed->enabled_mask &= ~(1UL << i);
+        } else if (XENSIV_PAS_GAS_OK == res) {
+            res = dev_res;
+        }
+    }
+
+    return res;
+}
+
+uint32_t xensiv_pas_gas_humidity_feed_get_abs_humidity(const xensiv_pas_gas_humidity_feed_t *feed) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+
+    return feed->abs_mg;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_A2L */
@@ -0,0 +1,181 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_humidity.h
+ *
+ * Description: This file contains the humidity compensation feed of the XENSIV™ PAS GAS A2L sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_HUMIDITY_H_
+#define XENSIV_PAS_GAS_HUMIDITY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas_a2l.h"
+
+/**
+ * \addtogroup group_board_libs_humidity XENSIV™ PAS GAS A2L sensor humidity compensation feed
+ * \{
+ * Feed which converts the relative humidity and temperature of a host sensor into the absolute humidity and
+ * forwards it to the ABS_HUM_REF register of one or more A2L sensors.
+ *
+ * The absolute humidity is computed in fixed point from a table of the saturation vapour density (Magnus formula)
+ * in 2 °C steps from -40 °C to 86 °C, interpolated linearly; the interpolation error stays below 0.5 %.
+ * ABS_HUM_REF is only written when the absolute humidity moves by threshold_mg or more from the value last
+ * written and the register value changes, or when the value last written is older than max_age_us. Each write
+ * is a single 2-byte burst per sensor; a sensor whose write failed is written again at the next reading.
+ *
+ * The humidity compensation is enabled through HC_CTRL right after the first ABS_HUM_REF write to a sensor, so
+ * that the sensor never runs the compensation without a reference. \ref xensiv_pas_gas_humidity_feed_check
+ * reads back HC_CTRL and schedules the sensors that report an error, a stale or a missing reference, or lost the
+ * enable bit, e.g. after a reset, for a new write and enable.
+ *
+ * The feed requires the sensors to be connected over I2C, since ABS_HUM_REF and HC_CTRL are beyond the UART
+ * register range.
+ *
+ * \code
+ *  static const xensiv_pas_gas_t *const devs[] = { &dev0, &dev1 };
+ *  xensiv_pas_gas_humidity_feed_config_t config;
+ *  xensiv_pas_gas_humidity_feed_get_default_config(&config);
+ *  xensiv_pas_gas_humidity_feed_init(&feed, devs, 2U, &config);
+ *
+ *  // On each host sensor reading, 45.00 %RH at 23.50 °C
+ *  xensiv_pas_gas_humidity_feed_update(&feed, now_us(), 4500U, 2350);
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Maximum number of sensors fed by one humidity feed */
+#define XENSIV_PAS_GAS_HUMIDITY_FEED_MAX_DEVS       (32U)
+
+/** Lowest temperature covered by the saturation vapour density table, in 0.01 °C; lower temperatures are clamped */
+#define XENSIV_PAS_GAS_HUMIDITY_TEMP_MIN            (-4000)
+
+/** Highest temperature covered by the saturation vapour density table, in 0.01 °C; higher temperatures are clamped */
+#define XENSIV_PAS_GAS_HUMIDITY_TEMP_MAX            (8600)
+
+/** Highest relative humidity, in 0.01 %RH; higher values are clamped */
+#define XENSIV_PAS_GAS_HUMIDITY_RH_MAX              (10000U)
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the humidity compensation feed */
+typedef struct
+{
+    uint32_t threshold_mg;                  /*!< Change of the absolute humidity, in mg/m³, from which ABS_HUM_REF is written */
+    uint64_t max_age_us;                    /*!< Age of the value last written from which ABS_HUM_REF is written again; 0 to disable */
+} xensiv_pas_gas_humidity_feed_config_t;
+
+/** State of the humidity compensation feed. The members are private to the feed. */
+typedef struct
+{
+    const xensiv_pas_gas_t *const *devs;    /*!< Fed sensor devices */
+    size_t dev_count;                       /*!< Number of fed sensor devices */
+    xensiv_pas_gas_humidity_feed_config_t config;   /*!< Configuration */
+    uint32_t abs_mg;                        /*!< Absolute humidity of the last reading, in mg/m³ */
+    bool has_written;                       /*!< A value has been selected for writing */
+    uint32_t written_mg;                    /*!< Absolute humidity last selected for writing, in mg/m³ */
+    uint64_t written_us;                    /*!< Time the value was selected */
+    uint32_t stale_mask;                    /*!< Sensors whose ABS_HUM_REF does not hold written_mg yet, one bit per device */
+    uint32_t enabled_mask;                  /*!< Sensors whose humidity compensation has been enabled, one bit per device */
+} xensiv_pas_gas_humidity_feed_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Computes the absolute humidity from the relative humidity and the temperature
+ *
+ * @param[in] rh Relative humidity in 0.01 %RH
+ * @param[in] temp Temperature in 0.01 °C
+ * @return Absolute humidity in mg/m³
+ */
+uint32_t xensiv_pas_gas_humidity_abs_from_rel(uint16_t rh, int16_t temp);
+
+/**
+ * @brief Gets the default configuration.
+ * threshold_mg 500 mg/m³, max_age_us 10 min.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_humidity_feed_get_default_config(xensiv_pas_gas_humidity_feed_config_t *config);
+
+/**
+ * @brief Initializes the feed. ABS_HUM_REF is written and the humidity compensation enabled on all sensors at
+ * the first reading.
+ *
+ * @param[out] feed Feed state allocated by the user
+ * @param[in] devs Array of pointers to the fed A2L sensor devices, must remain valid while the feed is used
+ * @param[in] dev_count Number of devices, at most \ref XENSIV_PAS_GAS_HUMIDITY_FEED_MAX_DEVS
+ * @param[in] config Feed configuration
+ * @return XENSIV_PAS_GAS_OK if the feed was initialized; XENSIV_PAS_GAS_INVALID_PARAMETER if dev_count is out of range
+ * or a device is connected over UART, which does not reach ABS_HUM_REF and HC_CTRL
+ */
+int32_t xensiv_pas_gas_humidity_feed_init(xensiv_pas_gas_humidity_feed_t *feed, const xensiv_pas_gas_t *const *devs, size_t dev_count,
+                                          const xensiv_pas_gas_humidity_feed_config_t *config);
+
+/**
+ * @brief Passes a reading of the host humidity sensor to the feed, which writes ABS_HUM_REF and enables the
+ * humidity compensation if needed
+ *
+ * @param[in] feed Feed state
+ * @param[in] time_us Time of the reading, in microseconds of any monotonic clock
+ * @param[in] rh Relative humidity in 0.01 %RH
+ * @param[in] temp Temperature in 0.01 °C
+ * @return XENSIV_PAS_GAS_OK if the reading was processed; the first error of the writes otherwise
+ */
+int32_t xensiv_pas_gas_humidity_feed_update(xensiv_pas_gas_humidity_feed_t *feed, uint64_t time_us, uint16_t rh, int16_t temp);
+
+/**
+ * @brief Reads HC_CTRL of all sensors. The sensors reporting an out of range humidity, a stale or missing
+ * reference, or with the compensation disabled, are written and enabled again at the next reading; a pending
+ * out of range humidity error is cleared along with the enable.
+ *
+ * @param[in] feed Feed state
+ * @return XENSIV_PAS_GAS_OK if all sensors were read; the first error of the reads otherwise
+ */
+int32_t xensiv_pas_gas_humidity_feed_check(xensiv_pas_gas_humidity_feed_t *feed);
+
+/**
+ * @brief Disables the humidity compensation of all sensors. The next reading enables it again.
+ *
+ * @param[in] feed Feed state
+ * @return XENSIV_PAS_GAS_OK if all sensors were disabled; the first error of the writes otherwise
+ */
+int32_t xensiv_pas_gas_humidity_feed_stop(xensiv_pas_gas_humidity_feed_t *feed);
+
+/**
+ * @brief Gets the absolute humidity of the last reading
+ *
+ * @param[in] feed Feed state
+ * @return Absolute humidity in mg/m³
+ */
+uint32_t xensiv_pas_gas_humidity_feed_get_abs_humidity(const xensiv_pas_gas_humidity_feed_t *feed);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_humidity */
+
+#endif /* XENSIV_PAS_GAS_HUMIDITY_H_ */
@@ -0,0 +1,352 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_inventory.c
+ *
+ * Description: This file contains the persistent sensor inventory of the XENSIV™ PAS GAS sensor
+ *              driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "xensiv_pas_gas_inventory.h"
+#include "xensiv_pas_gas_config.h"
+#include "xensiv_pas_gas_a2l_regs.h"
+#include "xensiv_pas_gas_r290_regs.h"
+
+extern void xensiv_pas_gas_base_setup(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
+extern bool xensiv_pas_gas_base_reaches(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t len);
+extern void xensiv_pas_gas_co2_setup(xensiv_pas_gas_t *dev);
+extern void xensiv_pas_gas_r290_setup(xensiv_pas_gas_t *dev);
+extern void xensiv_pas_gas_a2l_setup(xensiv_pas_gas_t *dev);
+
+#define XENSIV_PAS_GAS_INVENTORY_VERSION         (1U)
+#define XENSIV_PAS_GAS_INVENTORY_FNV_OFFSET      (2166136261UL)
+#define XENSIV_PAS_GAS_INVENTORY_FNV_PRIME       (16777619UL)
+
+/* Header layout */
+#define XENSIV_PAS_GAS_INVENTORY_HDR_MAGIC       (0U)
+#define XENSIV_PAS_GAS_INVENTORY_HDR_VERSION     (4U)
+#define XENSIV_PAS_GAS_INVENTORY_HDR_RECORD_SIZE (5U)
+#define XENSIV_PAS_GAS_INVENTORY_HDR_CAPACITY    (6U)
+#define XENSIV_PAS_GAS_INVENTORY_HDR_COUNT       (8U)
+#define XENSIV_PAS_GAS_INVENTORY_HDR_CRC         (XENSIV_PAS_GAS_INVENTORY_HDR_SIZE - 1U)
+
+/* Record layout */
+#define XENSIV_PAS_GAS_INVENTORY_REC_BUS         (0U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_MUX         (1U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_ITF         (2U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_VARIANT     (3U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_IDENT       (4U)      /* PROD_ID, SENS_STS, MEAS_RATE_H, MEAS_RATE_L, MEAS_CFG as read */
+#define XENSIV_PAS_GAS_INVENTORY_REC_UID_LEN     (9U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_UID         (10U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_HASH        (18U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_FLAGS       (22U)
+#define XENSIV_PAS_GAS_INVENTORY_REC_CRC         (XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE - 1U)
+
+#define XENSIV_PAS_GAS_INVENTORY_REC_FLAG_VALID  (0x01U)
+
+/* PROD_ID, SENS_STS, MEAS_RATE_H, MEAS_RATE_L and MEAS_CFG read in a single burst */
+#define XENSIV_PAS_GAS_INVENTORY_IDENT_LEN       (5U)
+#define XENSIV_PAS_GAS_INVENTORY_IDENT_STS       (1U)
+
+#define XENSIV_PAS_GAS_INVENTORY_STS_MSK         (XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK | XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK | \
+                                                  XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK | XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK)
+
+static const uint8_t xensiv_pas_gas_inventory_magic[4] = { 'X', 'P', 'G', 'I' };
+
+static uint16_t xensiv_pas_gas_inventory_get_u16(const uint8_t *p) {
+    return (uint16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8U));
+}
+
+static void xensiv_pas_gas_inventory_put_u16(uint8_t *p, uint16_t val) {
+    p[0] = (uint8_t)(val & 0xFFU);
+    p[1] = (uint8_t)(val >> 8U);
+}
+
+static void xensiv_pas_gas_inventory_write_header(xensiv_pas_gas_inventory_t *inv) {
+    uint8_t *hdr = inv->image;
+
+    xensiv_pas_gas_inventory_put_u16(&hdr[XENSIV_PAS_GAS_INVENTORY_HDR_COUNT], inv->count);
+    hdr[XENSIV_PAS_GAS_INVENTORY_HDR_CRC] = xensiv_pas_gas_crc8(hdr, XENSIV_PAS_GAS_INVENTORY_HDR_CRC);
+}
+
+static uint8_t *xensiv_pas_gas_inventory_get_rec(const xensiv_pas_gas_inventory_t *inv, uint16_t idx) {
+    return &inv->image[XENSIV_PAS_GAS_INVENTORY_HDR_SIZE + ((size_t)idx * XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE)];
+}
+
+static bool xensiv_pas_gas_inventory_rec_valid(const uint8_t *rec) {
+    return ((rec[XENSIV_PAS_GAS_INVENTORY_REC_FLAGS] & XENSIV_PAS_GAS_INVENTORY_REC_FLAG_VALID) != 0U) &&
+           (rec[XENSIV_PAS_GAS_INVENTORY_REC_CRC] == xensiv_pas_gas_crc8(rec, XENSIV_PAS_GAS_INVENTORY_REC_CRC));
+}
+
+/* Valid record of the key; NULL if there is none */
+static uint8_t *xensiv_pas_gas_inventory_find(const xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key) {
+    for (uint16_t i = 0U; i < inv->count; ++i)
+    {
+        uint8_t *rec = xensiv_pas_gas_inventory_get_rec(inv, i);
+        if ((rec[XENSIV_PAS_GAS_INVENTORY_REC_BUS] == key->bus) && (rec[XENSIV_PAS_GAS_INVENTORY_REC_MUX] == key->mux_channel) &&
+            (rec[XENSIV_PAS_GAS_INVENTORY_REC_ITF] == (uint8_t)key->itf) && xensiv_pas_gas_inventory_rec_valid(rec)) {
+            return rec;
+        }
+    }
+
+    return NULL;
+}
+
+/* Compares the live device ID with the cached unique device ID, reading a single byte of it */
+static int32_t xensiv_pas_gas_inventory_check_id(const xensiv_pas_gas_t *dev, const uint8_t *rec, bool *same) {
+    const uint8_t *cached = &rec[XENSIV_PAS_GAS_INVENTORY_REC_UID];
+    uint8_t len = rec[XENSIV_PAS_GAS_INVENTORY_REC_UID_LEN];
+    uint8_t buf[2];
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    if ((0U == len) || (len > XENSIV_PAS_GAS_UNIQUE_ID_MAX_LEN)) {
+        /* The unique device ID was not read before recording */
+    } else if ((XENSIV_PAS_GAS_VARIANT_A2L == dev->variant) && xensiv_pas_gas_base_reaches(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX, 2U)) {
+        /* DEV_ID_IDX and DEV_ID are contiguous: the byte at the current index comes along with the index */
+        res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX, buf, 2U);
+        *same = (XENSIV_PAS_GAS_OK == res) && (buf[0] < len) && (cached[buf[0]] == buf[1]);
+    } else if ((XENSIV_PAS_GAS_VARIANT_R290 == dev->variant) && xensiv_pas_gas_base_reaches(dev, (uint8_t)XENSIV_PAS_GAS_R290_REG_DEV_ID, 1U)) {
+        res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_R290_REG_DEV_ID, buf, 1U);
+        *same = (XENSIV_PAS_GAS_OK == res) && (cached[0] == buf[0]);
+    } else {
+        /* The CO2 variant has no device ID, and DEV_ID is beyond the UART register range */
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_inventory_open(xensiv_pas_gas_inventory_t *inv, uint8_t *image, size_t size, bool *formatted) {
+    xensiv_pas_gas_plat_assert(inv != NULL);
+    xensiv_pas_gas_plat_assert(image != NULL);
+
+    if (size < XENSIV_PAS_GAS_INVENTORY_SIZE(1U)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    size_t fit = (size - XENSIV_PAS_GAS_INVENTORY_HDR_SIZE) / XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE;
+    uint16_t capacity = xensiv_pas_gas_inventory_get_u16(&image[XENSIV_PAS_GAS_INVENTORY_HDR_CAPACITY]);
+    uint16_t count = xensiv_pas_gas_inventory_get_u16(&image[XENSIV_PAS_GAS_INVENTORY_HDR_COUNT]);
+    bool valid = (0 == memcmp(&image[XENSIV_PAS_GAS_INVENTORY_HDR_MAGIC], xensiv_pas_gas_inventory_magic, sizeof(xensiv_pas_gas_inventory_magic))) &&
+                 (XENSIV_PAS_GAS_INVENTORY_VERSION == image[XENSIV_PAS_GAS_INVENTORY_HDR_VERSION]) &&
+                 (XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE == image[XENSIV_PAS_GAS_INVENTORY_HDR_RECORD_SIZE]) &&
+                 (image[XENSIV_PAS_GAS_INVENTORY_HDR_CRC] == xensiv_pas_gas_crc8(image, XENSIV_PAS_GAS_INVENTORY_HDR_CRC)) &&
+                 (capacity > 0U) && (capacity <= fit) && (count <= capacity);
+
+    inv->image = image;
+
+    if (valid) {
+        inv->capacity = capacity;
+        inv->count = count;
+    } else {
+        inv->capacity = (fit > XENSIV_PAS_GAS_INVENTORY_MAX_RECORDS) ? XENSIV_PAS_GAS_INVENTORY_MAX_RECORDS : (uint16_t)fit;
+        inv->count = 0U;
+
+        (void)memset(image, 0, XENSIV_PAS_GAS_INVENTORY_SIZE((size_t)inv->capacity));
+        (void)memcpy(&image[XENSIV_PAS_GAS_INVENTORY_HDR_MAGIC], xensiv_pas_gas_inventory_magic, sizeof(xensiv_pas_gas_inventory_magic));
+        image[XENSIV_PAS_GAS_INVENTORY_HDR_VERSION] = XENSIV_PAS_GAS_INVENTORY_VERSION;
+        image[XENSIV_PAS_GAS_INVENTORY_HDR_RECORD_SIZE] = XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE;
+        xensiv_pas_gas_inventory_put_u16(&image[XENSIV_PAS_GAS_INVENTORY_HDR_CAPACITY], inv->capacity);
+        xensiv_pas_gas_inventory_write_header(inv);
+    }
+
+    if (formatted != NULL) {
+        *formatted = !valid;
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+uint32_t xensiv_pas_gas_inventory_hash(const void *data, size_t len) {
+    xensiv_pas_gas_plat_assert((data != NULL) || (len == 0U));
+
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t hash = XENSIV_PAS_GAS_INVENTORY_FNV_OFFSET;
+
+    for (size_t i = 0U; i < len; ++i)
+    {
+        hash = (hash ^ p[i]) * XENSIV_PAS_GAS_INVENTORY_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+int32_t xensiv_pas_gas_inventory_attach(const xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key, xensiv_pas_gas_t *dev, void *ctx, uint32_t config_hash, bool *match) {
+    xensiv_pas_gas_plat_assert(inv != NULL);
+    xensiv_pas_gas_plat_assert(key != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+    xensiv_pas_gas_plat_assert(match != NULL);
+
+    *match = false;
+
+    const uint8_t *rec = xensiv_pas_gas_inventory_find(inv, key);
+    if (NULL == rec) {
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    switch ((xensiv_pas_gas_variant_t)rec[XENSIV_PAS_GAS_INVENTORY_REC_VARIANT])
+    {
+#if XENSIV_PAS_GAS_ENABLE_CO2
+        case XENSIV_PAS_GAS_VARIANT_CO2:
+            xensiv_pas_gas_co2_setup(dev);
+            break;
+#endif
+#if XENSIV_PAS_GAS_ENABLE_R290
+        case XENSIV_PAS_GAS_VARIANT_R290:
+            xensiv_pas_gas_r290_setup(dev);
+            break;
+#endif
+#if XENSIV_PAS_GAS_ENABLE_A2L
+        case XENSIV_PAS_GAS_VARIANT_A2L:
+            xensiv_pas_gas_a2l_setup(dev);
+            break;
+#endif
+        default:
+            return XENSIV_PAS_GAS_OK;
+    }
+    xensiv_pas_gas_base_setup(dev, key->itf, ctx);
+
+    uint8_t ident[XENSIV_PAS_GAS_INVENTORY_IDENT_LEN];
+    int32_t res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_PROD_ID, ident, XENSIV_PAS_GAS_INVENTORY_IDENT_LEN);
+    bool same = false;
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        /* SENS_STS is compared on its ready and error flags only */
+        const uint8_t *cached = &rec[XENSIV_PAS_GAS_INVENTORY_REC_IDENT];
+        same = ((ident[XENSIV_PAS_GAS_INVENTORY_IDENT_STS] & XENSIV_PAS_GAS_INVENTORY_STS_MSK) == XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK) &&
+               (ident[0] == cached[0]) &&
+               (0 == memcmp(&ident[XENSIV_PAS_GAS_INVENTORY_IDENT_STS + 1U], &cached[XENSIV_PAS_GAS_INVENTORY_IDENT_STS + 1U],
+                            XENSIV_PAS_GAS_INVENTORY_IDENT_LEN - XENSIV_PAS_GAS_INVENTORY_IDENT_STS - 1U)) &&
+               (xensiv_pas_gas_inventory_get_u16(&rec[XENSIV_PAS_GAS_INVENTORY_REC_HASH]) == (uint16_t)(config_hash & 0xFFFFU)) &&
+               (xensiv_pas_gas_inventory_get_u16(&rec[XENSIV_PAS_GAS_INVENTORY_REC_HASH + 2U]) == (uint16_t)(config_hash >> 16U));
+    }
+
+    if ((XENSIV_PAS_GAS_OK == res) && same) {
+        /* The signature is lost on a reset, when the registers compared above may hold their reset values */
+        uint8_t scratch_pad;
+        res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_SCRATCH_PAD, &scratch_pad, 1U);
+        same = (XENSIV_PAS_GAS_ATTACH_SIGNATURE == scratch_pad);
+    }
+
+    if ((XENSIV_PAS_GAS_OK == res) && same) {
+        /* Another sensor of the same product, configured alike, may have been fitted at the location */
+        res = xensiv_pas_gas_inventory_check_id(dev, rec, &same);
+    }
+
+    if ((XENSIV_PAS_GAS_OK == res) && same) {
+        uint8_t len = rec[XENSIV_PAS_GAS_INVENTORY_REC_UID_LEN];
+        dev->unique_id.len = (len > XENSIV_PAS_GAS_UNIQUE_ID_MAX_LEN) ? 0U : len;
+        (void)memcpy(dev->unique_id.id, &rec[XENSIV_PAS_GAS_INVENTORY_REC_UID], dev->unique_id.len);
+        *match = true;
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_inventory_record(xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key, const xensiv_pas_gas_t *dev, uint32_t config_hash) {
+    xensiv_pas_gas_plat_assert(inv != NULL);
+    xensiv_pas_gas_plat_assert(key != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    if ((XENSIV_PAS_GAS_VARIANT_CO2 != dev->variant) && (XENSIV_PAS_GAS_VARIANT_R290 != dev->variant) &&
+        (XENSIV_PAS_GAS_VARIANT_A2L != dev->variant)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    uint8_t *rec = xensiv_pas_gas_inventory_find(inv, key);
+
+    /* Reuse an invalid record before appending one */
+    for (uint16_t i = 0U; (NULL == rec) && (i < inv->count); ++i)
+    {
+        uint8_t *free_rec = xensiv_pas_gas_inventory_get_rec(inv, i);
+        if (!xensiv_pas_gas_inventory_rec_valid(free_rec)) {
+            rec = free_rec;
+        }
+    }
+
+    bool append = (NULL == rec);
+    if (append) {
+        if (inv->count >= inv->capacity) {
+            return XENSIV_PAS_GAS_INVALID_PARAMETER;
+        }
+        rec = xensiv_pas_gas_inventory_get_rec(inv, inv->count);
+    }
+
+    uint8_t ident[XENSIV_PAS_GAS_INVENTORY_IDENT_LEN];
+    int32_t res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_PROD_ID, ident, XENSIV_PAS_GAS_INVENTORY_IDENT_LEN);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        (void)memset(rec, 0, XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE);
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_BUS] = key->bus;
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_MUX] = key->mux_channel;
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_ITF] = (uint8_t)key->itf;
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_VARIANT] = (uint8_t)dev->variant;
+        (void)memcpy(&rec[XENSIV_PAS_GAS_INVENTORY_REC_IDENT], ident, XENSIV_PAS_GAS_INVENTORY_IDENT_LEN);
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_UID_LEN] = dev->unique_id.len;
+        (void)memcpy(&rec[XENSIV_PAS_GAS_INVENTORY_REC_UID], dev->unique_id.id, dev->unique_id.len);
+        xensiv_pas_gas_inventory_put_u16(&rec[XENSIV_PAS_GAS_INVENTORY_REC_HASH], (uint16_t)(config_hash & 0xFFFFU));
+        xensiv_pas_gas_inventory_put_u16(&rec[XENSIV_PAS_GAS_INVENTORY_REC_HASH + 2U], (uint16_t)(config_hash >> 16U));
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_FLAGS] = XENSIV_PAS_GAS_INVENTORY_REC_FLAG_VALID;
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_CRC] = xensiv_pas_gas_crc8(rec, XENSIV_PAS_GAS_INVENTORY_REC_CRC);
+
+        if (append) {
+            inv->count++;
+            xensiv_pas_gas_inventory_write_header(inv);
+        }
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_inventory_lookup(const xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key, xensiv_pas_gas_inventory_entry_t *entry) {
+    xensiv_pas_gas_plat_assert(inv != NULL);
+    xensiv_pas_gas_plat_assert(key != NULL);
+    xensiv_pas_gas_plat_assert(entry != NULL);
+
+    const uint8_t *rec = xensiv_pas_gas_inventory_find(inv, key);
+    if (NULL == rec) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    const uint8_t *ident = &rec[XENSIV_PAS_GAS_INVENTORY_REC_IDENT];
+    uint8_t len = rec[XENSIV_PAS_GAS_INVENTORY_REC_UID_LEN];
+
+    entry->variant = (xensiv_pas_gas_variant_t)rec[XENSIV_PAS_GAS_INVENTORY_REC_VARIANT];
+    entry->id.u = ident[0];
+    entry->meas_rate = (uint16_t)(((uint16_t)ident[2] << 8U) | ident[3]);
+    entry->meas_cfg.u = ident[4];
+    entry->unique_id.len = (len > XENSIV_PAS_GAS_UNIQUE_ID_MAX_LEN) ? 0U : len;
+    (void)memcpy(entry->unique_id.id, &rec[XENSIV_PAS_GAS_INVENTORY_REC_UID], entry->unique_id.len);
+    entry->config_hash = (uint32_t)xensiv_pas_gas_inventory_get_u16(&rec[XENSIV_PAS_GAS_INVENTORY_REC_HASH]) |
+                         ((uint32_t)xensiv_pas_gas_inventory_get_u16(&rec[XENSIV_PAS_GAS_INVENTORY_REC_HASH + 2U]) << 16U);
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_inventory_remove(xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key) {
+    xensiv_pas_gas_plat_assert(inv != NULL);
+    xensiv_pas_gas_plat_assert(key != NULL);
+
+    uint8_t *rec = xensiv_pas_gas_inventory_find(inv, key);
+    if (rec != NULL) {
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_FLAGS] = 0U;
+        rec[XENSIV_PAS_GAS_INVENTORY_REC_CRC] = xensiv_pas_gas_crc8(rec, XENSIV_PAS_GAS_INVENTORY_REC_CRC);
+    }
+}
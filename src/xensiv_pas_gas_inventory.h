@@ -0,0 +1,206 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_inventory.h
+ *
+ * Description: This file contains the persistent sensor inventory of the XENSIV™ PAS GAS sensor
+ *              driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_INVENTORY_H_
+#define XENSIV_PAS_GAS_INVENTORY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_inventory XENSIV™ PAS GAS sensor inventory
+ * \{
+ * Persistent cache of the identity and configuration of the sensors of a gateway, so that a restart only
+ * probes and provisions the sensors which changed.
+ *
+ * The inventory maps the bus, the multiplexer channel and the interface of each sensor to the last known
+ * unique device ID, product and revision (\ref xensiv_pas_gas_get_id), variant, measurement configuration and
+ * a hash of the configuration applied by the application. \ref xensiv_pas_gas_inventory_attach sets up the
+ * device structure from the cached variant and checks the live sensor against the cache with one burst read
+ * of PROD_ID to MEAS_CFG and one read of the scratch pad signature (\ref xensiv_pas_gas_mark_configured),
+ * which is lost when the sensor was reset or power cycled. For the R290 and A2L variants over I2C, one more
+ * read compares a byte of the live device ID with the cache, so that another sensor configured alike is not
+ * taken for the recorded one. A matching sensor is used as is and its unique device ID is restored from the
+ * cache. Only a mismatching sensor is initialized, provisioned and recorded again:
+ * \code
+ *  static uint8_t image[XENSIV_PAS_GAS_INVENTORY_SIZE(256U)];    // e.g. mmap() of a file
+ *  xensiv_pas_gas_inventory_open(&inv, image, sizeof(image), NULL);
+ *
+ *  xensiv_pas_gas_inventory_key_t key = { .bus = 0U, .mux_channel = 3U, .itf = XENSIV_PAS_GAS_INTERFACE_I2C };
+ *  uint32_t hash = xensiv_pas_gas_inventory_hash(app_profile, sizeof(app_profile));   // Byte description of the configuration
+ *  if ((XENSIV_PAS_GAS_OK != xensiv_pas_gas_inventory_attach(&inv, &key, &dev, ctx, hash, &match)) || !match) {
+ *      xensiv_pas_gas_a2l_init(&dev, key.itf, ctx);
+ *      xensiv_pas_gas_a2l_get_unique_id(&dev, &id);
+ *      ...                                                         // Provisioning
+ *      xensiv_pas_gas_mark_configured(&dev);
+ *      xensiv_pas_gas_inventory_record(&inv, &key, &dev, hash);
+ *  }
+ * \endcode
+ *
+ * The inventory image has a fixed layout of single bytes, multi-byte values are stored little-endian, so it
+ * can be mapped from a file and shared between hosts of any byte order. A 16-byte header is followed by
+ * 32-byte records protected by a CRC-8 each; recording a sensor only changes its record and, when a record
+ * is appended, the header. A record torn by an interrupted write fails its CRC and is probed again.
+ * Writing the image back to the file, e.g. with msync(), is left to the application.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Size of the inventory image header in bytes */
+#define XENSIV_PAS_GAS_INVENTORY_HDR_SIZE        (16U)
+
+/** Size of an inventory record in bytes */
+#define XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE     (32U)
+
+/** Size of an inventory image holding n records */
+#define XENSIV_PAS_GAS_INVENTORY_SIZE(n)         (XENSIV_PAS_GAS_INVENTORY_HDR_SIZE + ((n) * XENSIV_PAS_GAS_INVENTORY_RECORD_SIZE))
+
+/** Maximum number of records of an inventory image */
+#define XENSIV_PAS_GAS_INVENTORY_MAX_RECORDS     (UINT16_MAX)
+
+/********************************* Type definitions **************************************/
+
+/** Location of a sensor on the gateway */
+typedef struct
+{
+    uint8_t bus;                            /*!< Bus number, defined by the application */
+    uint8_t mux_channel;                    /*!< Channel of the bus multiplexer, defined by the application */
+    xensiv_pas_gas_interface_t itf;         /*!< Communication interface of the sensor */
+} xensiv_pas_gas_inventory_key_t;
+
+/** Cached identity of a sensor */
+typedef struct
+{
+    xensiv_pas_gas_variant_t variant;       /*!< Sensor variant */
+    xensiv_pas_gas_id_t id;                 /*!< Product and revision */
+    uint16_t meas_rate;                     /*!< Measurement rate in seconds */
+    xensiv_pas_gas_measurement_config_t meas_cfg;   /*!< Measurement configuration */
+    xensiv_pas_gas_unique_id_t unique_id;   /*!< Unique device ID; len is 0 if it was not read before recording */
+    uint32_t config_hash;                   /*!< Hash of the configuration applied by the application */
+} xensiv_pas_gas_inventory_entry_t;
+
+/** Inventory bound to an image. The members are private to the inventory. */
+typedef struct
+{
+    uint8_t *image;                         /*!< Inventory image */
+    uint16_t capacity;                      /*!< Number of records the image holds */
+    uint16_t count;                         /*!< Number of records in use, including invalid ones */
+} xensiv_pas_gas_inventory_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Binds the inventory to an image.
+ * An image with a valid header whose capacity fits into size is adopted with its records. Any other
+ * content is discarded and the image is formatted for as many records as fit into size.
+ *
+ * @param[out] inv Inventory state allocated by the user
+ * @param[in] image Inventory image, e.g. a file mapped into memory; it is kept until the inventory is no longer used
+ * @param[in] size Size of the image in bytes
+ * @param[out] formatted Pointer to populate with true if the image was formatted; may be NULL
+ * @return XENSIV_PAS_GAS_OK if the image was adopted or formatted; XENSIV_PAS_GAS_INVALID_PARAMETER if size cannot
+ * hold a single record
+ */
+int32_t xensiv_pas_gas_inventory_open(xensiv_pas_gas_inventory_t *inv, uint8_t *image, size_t size, bool *formatted);
+
+/**
+ * @brief Computes the hash of a configuration description, to be stored with the records.
+ * The description is hashed byte by byte with FNV-1a; it must not contain padding bytes of undefined value.
+ *
+ * @param[in] data Configuration description
+ * @param[in] len Length of the description in bytes
+ * @return 32-bit hash
+ */
+uint32_t xensiv_pas_gas_inventory_hash(const void *data, size_t len);
+
+/**
+ * @brief Sets up the device from the cached record and checks the live sensor against it.
+ * The device structure is set up as by the attach function of the cached variant, without accessing the
+ * bus. One burst reads PROD_ID, SENS_STS, MEAS_RATE and MEAS_CFG, followed by one read of the scratch pad.
+ * The sensor matches if it is ready, its product, revision and measurement configuration equal the
+ * record, the scratch pad holds \ref XENSIV_PAS_GAS_ATTACH_SIGNATURE and config_hash equals the recorded
+ * hash. If the record holds a unique device ID, the live device ID is then read over I2C and must equal it:
+ * the DEV_ID_IDX and DEV_ID burst of the A2L variant, DEV_ID of the R290 variant. The unique device ID of a
+ * matching sensor is then restored into the device structure.
+ * Without a record for the key, the bus is not accessed and the device structure is left untouched.
+ *
+ * @param[in] inv Inventory state
+ * @param[in] key Location of the sensor
+ * @param[in out] dev Pointer to a XENSIV™ PAS GAS sensor device structure allocated by user
+ * @param[in] ctx Pointer to the platform-specific I2C or UART communication handler
+ * @param[in] config_hash Hash of the configuration the application expects
+ * @param[out] match Pointer to populate with true if the sensor can be used without provisioning
+ * @return XENSIV_PAS_GAS_OK if the sensor was checked or there is no record for the key; an error indicating
+ * what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_inventory_attach(const xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key, xensiv_pas_gas_t *dev, void *ctx, uint32_t config_hash, bool *match);
+
+/**
+ * @brief Records the sensor after its provisioning.
+ * One burst reads PROD_ID, SENS_STS, MEAS_RATE and MEAS_CFG from the sensor; the variant and the unique
+ * device ID cached in the device structure are stored with them. Call it once the configuration of the
+ * sensor is complete and marked with \ref xensiv_pas_gas_mark_configured. The record of the key is
+ * replaced, or a free record is used.
+ *
+ * @param[in] inv Inventory state
+ * @param[in] key Location of the sensor
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] config_hash Hash of the configuration applied by the application
+ * @return XENSIV_PAS_GAS_OK if the sensor was recorded; XENSIV_PAS_GAS_INVALID_PARAMETER if the variant is not
+ * CO2, R290 or A2L or the image is full; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_inventory_record(xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key, const xensiv_pas_gas_t *dev, uint32_t config_hash);
+
+/**
+ * @brief Gets the cached identity of a sensor
+ *
+ * @param[in] inv Inventory state
+ * @param[in] key Location of the sensor
+ * @param[out] entry Pointer to populate with the cached identity
+ * @return XENSIV_PAS_GAS_OK if the inventory holds a valid record for the key; XENSIV_PAS_GAS_INVALID_PARAMETER otherwise
+ */
+int32_t xensiv_pas_gas_inventory_lookup(const xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key, xensiv_pas_gas_inventory_entry_t *entry);
+
+/**
+ * @brief Removes the record of a sensor, e.g. after the sensor was taken out of service.
+ * The record is reused by the next sensor recorded.
+ *
+ * @param[in] inv Inventory state
+ * @param[in] key Location of the sensor
+ */
+void xensiv_pas_gas_inventory_remove(xensiv_pas_gas_inventory_t *inv, const xensiv_pas_gas_inventory_key_t *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_inventory */
+
+#endif /* XENSIV_PAS_GAS_INVENTORY_H_ */
@@ -0,0 +1,533 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_linux.c
+ *
+ * Description: Linux platform of the XENSIV™ PAS GAS sensor driver, with file descriptors to
+ *              multiplex the sensor waits in an event loop.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _DEFAULT_SOURCE
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/timerfd.h>
+#include <linux/gpio.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "xensiv_pas_gas_linux.h"
+
+#define XENSIV_PAS_GAS_LINUX_US_PER_S            (1000000ULL)
+#define XENSIV_PAS_GAS_LINUX_NS_PER_US           (1000ULL)
+#define XENSIV_PAS_GAS_LINUX_NS_PER_MS           (1000000L)
+#define XENSIV_PAS_GAS_LINUX_US_PER_MS           (1000ULL)
+
+/* Consumer label of the requested GPIO lines */
+#define XENSIV_PAS_GAS_LINUX_GPIO_CONSUMER       "xensiv_pas_gas"
+
+static uint64_t xensiv_pas_gas_linux_timespec_to_us(const struct timespec *ts) {
+    return ((uint64_t)ts->tv_sec * XENSIV_PAS_GAS_LINUX_US_PER_S) + ((uint64_t)ts->tv_nsec / XENSIV_PAS_GAS_LINUX_NS_PER_US);
+}
+
+/* Arms the bus timer at due_us; 0 fires immediately, UINT64_MAX disarms it */
+static int32_t xensiv_pas_gas_linux_arm(xensiv_pas_gas_linux_bus_t *bus, uint64_t due_us) {
+    struct itimerspec spec;
+    (void)memset(&spec, 0, sizeof(spec));
+
+    if (UINT64_MAX != due_us) {
+        spec.it_value.tv_sec = (time_t)(due_us / XENSIV_PAS_GAS_LINUX_US_PER_S);
+        spec.it_value.tv_nsec = (long)((due_us % XENSIV_PAS_GAS_LINUX_US_PER_S) * XENSIV_PAS_GAS_LINUX_NS_PER_US);
+
+        /* An all-zero value disarms the timer; any absolute time in the past fires at once */
+        if ((0 == spec.it_value.tv_sec) && (0 == spec.it_value.tv_nsec)) {
+            spec.it_value.tv_nsec = 1;
+        }
+    }
+
+    return (0 == timerfd_settime(bus->timer_fd, TFD_TIMER_ABSTIME, &spec, NULL)) ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_ERR_COMM;
+}
+
+/* Adds the serial port to the epoll set of the bus with the given events, or removes it for 0 */
+static int32_t xensiv_pas_gas_linux_watch(xensiv_pas_gas_linux_bus_t *bus, uint32_t events) {
+    if (events == bus->uart_watched) {
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    struct epoll_event ev = { .events = events, .data.fd = bus->fd };
+    int ctl = (0U == events) ? EPOLL_CTL_DEL : ((0U == bus->uart_watched) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD);
+
+    if (0 != epoll_ctl(bus->epoll_fd, ctl, bus->fd, &ev)) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+    bus->uart_watched = events;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+static int32_t xensiv_pas_gas_linux_bus_open(xensiv_pas_gas_linux_bus_t *bus, int fd, xensiv_pas_gas_interface_t itf) {
+    bus->fd = fd;
+    bus->itf = itf;
+    bus->timeout_ms = XENSIV_PAS_GAS_LINUX_UART_TIMEOUT_MS;
+    bus->op = NULL;
+    bus->stepping = false;
+    bus->uart_events = 0U;
+    bus->uart_watched = 0U;
+    bus->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    bus->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+    struct epoll_event ev = { .events = EPOLLIN, .data.fd = bus->timer_fd };
+    if ((bus->timer_fd < 0) || (bus->epoll_fd < 0) || (0 != epoll_ctl(bus->epoll_fd, EPOLL_CTL_ADD, bus->timer_fd, &ev))) {
+        xensiv_pas_gas_linux_bus_close(bus);
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+/* Waits until the serial port is ready for the given poll events */
+static int32_t xensiv_pas_gas_linux_uart_wait(const xensiv_pas_gas_linux_bus_t *bus, short events) {
+    struct pollfd pfd = { .fd = bus->fd, .events = events, .revents = 0 };
+    int ret;
+
+    do
+    {
+        ret = poll(&pfd, 1U, (int)bus->timeout_ms);
+    } while ((ret < 0) && (EINTR == errno));
+
+    return ((ret > 0) && (0 != (pfd.revents & events))) ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_ERR_COMM;
+}
+
+/* Starts a pass of a step. The commands and responses of the access are kept while the step waits for the
+ * serial port, so that the repeated step does not send them again */
+static void xensiv_pas_gas_linux_uart_begin(xensiv_pas_gas_linux_bus_t *bus) {
+    if (0U == bus->uart_events) {
+        bus->uart_sent = 0U;
+        bus->uart_tx_done = 0U;
+        bus->uart_rx_len = 0U;
+    }
+    bus->uart_events = 0U;
+    bus->uart_cmd = 0U;
+    bus->uart_rx_pos = 0U;
+}
+
+/* Defers the step until the serial port is ready for the events, unless timeout_ms already elapsed */
+static int32_t xensiv_pas_gas_linux_uart_await(xensiv_pas_gas_linux_bus_t *bus, uint32_t events) {
+    if (xensiv_pas_gas_plat_get_time_us() >= bus->uart_deadline_us) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+    bus->uart_events = events;
+
+    return XENSIV_PAS_GAS_PENDING;
+}
+
+/* Sends the next command of a step without waiting; a command sent by a previous pass is skipped */
+static int32_t xensiv_pas_gas_linux_uart_send(xensiv_pas_gas_linux_bus_t *bus, const uint8_t *data, size_t len) {
+    if (bus->uart_cmd < bus->uart_sent) {
+        bus->uart_cmd++;
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    if (0U == bus->uart_tx_done) {
+        /* Drop a late response of a previous command that timed out */
+        (void)tcflush(bus->fd, TCIFLUSH);
+        bus->uart_deadline_us = xensiv_pas_gas_plat_get_time_us() + ((uint64_t)bus->timeout_ms * XENSIV_PAS_GAS_LINUX_US_PER_MS);
+    }
+
+    while (bus->uart_tx_done < len)
+    {
+        ssize_t ret = write(bus->fd, &data[bus->uart_tx_done], len - bus->uart_tx_done);
+        if (ret > 0) {
+            bus->uart_tx_done += (size_t)ret;
+        } else if ((ret < 0) && (EAGAIN == errno)) {
+            return xensiv_pas_gas_linux_uart_await(bus, EPOLLOUT);
+        } else if ((0 == ret) || (EINTR != errno)) {
+            return XENSIV_PAS_GAS_ERR_COMM;
+        }
+    }
+
+    bus->uart_tx_done = 0U;
+    bus->uart_sent++;
+    bus->uart_cmd++;
+    bus->uart_deadline_us = xensiv_pas_gas_plat_get_time_us() + ((uint64_t)bus->timeout_ms * XENSIV_PAS_GAS_LINUX_US_PER_MS);
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+/* Hands the next response of a step to the driver, reading what the serial port holds without waiting */
+static int32_t xensiv_pas_gas_linux_uart_receive(xensiv_pas_gas_linux_bus_t *bus, uint8_t *data, size_t len) {
+    size_t end = bus->uart_rx_pos + len;
+
+    if (end > sizeof(bus->uart_rx)) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    while (bus->uart_rx_len < end)
+    {
+        ssize_t ret = read(bus->fd, &bus->uart_rx[bus->uart_rx_len], end - bus->uart_rx_len);
+        if (ret > 0) {
+            bus->uart_rx_len += (size_t)ret;
+        } else if ((ret < 0) && (EAGAIN == errno)) {
+            return xensiv_pas_gas_linux_uart_await(bus, EPOLLIN);
+        } else if ((0 == ret) || (EINTR != errno)) {
+            return XENSIV_PAS_GAS_ERR_COMM;
+        }
+    }
+
+    (void)memcpy(data, &bus->uart_rx[bus->uart_rx_pos], len);
+    bus->uart_rx_pos = end;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_linux_i2c_open(xensiv_pas_gas_linux_bus_t *bus, const char *path) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+    xensiv_pas_gas_plat_assert(path != NULL);
+
+    int fd = open(path, O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+        bus->fd = -1;
+        bus->timer_fd = -1;
+        bus->epoll_fd = -1;
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    return xensiv_pas_gas_linux_bus_open(bus, fd, XENSIV_PAS_GAS_INTERFACE_I2C);
+}
+
+int32_t xensiv_pas_gas_linux_uart_open(xensiv_pas_gas_linux_bus_t *bus, const char *path) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+    xensiv_pas_gas_plat_assert(path != NULL);
+
+    bus->fd = -1;
+    bus->timer_fd = -1;
+    bus->epoll_fd = -1;
+
+    int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    struct termios tio;
+    if (0 != tcgetattr(fd, &tio)) {
+        (void)close(fd);
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    cfmakeraw(&tio);
+    tio.c_cflag &= ~(tcflag_t)(CSTOPB | PARENB | CRTSCTS);
+    tio.c_cflag |= (tcflag_t)(CLOCAL | CREAD);
+    (void)cfsetispeed(&tio, B9600);
+    (void)cfsetospeed(&tio, B9600);
+
+    if (0 != tcsetattr(fd, TCSANOW, &tio)) {
+        (void)close(fd);
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+    (void)tcflush(fd, TCIOFLUSH);
+
+    return xensiv_pas_gas_linux_bus_open(bus, fd, XENSIV_PAS_GAS_INTERFACE_UART);
+}
+
+void xensiv_pas_gas_linux_bus_close(xensiv_pas_gas_linux_bus_t *bus) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+
+    if (bus->epoll_fd >= 0) {
+        (void)close(bus->epoll_fd);
+    }
+    if (bus->timer_fd >= 0) {
+        (void)close(bus->timer_fd);
+    }
+    if (bus->fd >= 0) {
+        (void)close(bus->fd);
+    }
+
+    bus->fd = -1;
+    bus->timer_fd = -1;
+    bus->epoll_fd = -1;
+    bus->op = NULL;
+}
+
+int xensiv_pas_gas_linux_bus_get_fd(const xensiv_pas_gas_linux_bus_t *bus) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+
+    return bus->epoll_fd;
+}
+
+int xensiv_pas_gas_linux_bus_get_io_fd(const xensiv_pas_gas_linux_bus_t *bus) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+
+    return bus->fd;
+}
+
+int32_t xensiv_pas_gas_linux_bus_start(xensiv_pas_gas_linux_bus_t *bus, xensiv_pas_gas_async_t *op) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+    xensiv_pas_gas_plat_assert(op != NULL);
+    xensiv_pas_gas_plat_assert(op->dev->ctx == bus);
+
+    if (xensiv_pas_gas_linux_bus_is_busy(bus)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    int32_t res = xensiv_pas_gas_linux_arm(bus, xensiv_pas_gas_async_get_due_us(op));
+    if (XENSIV_PAS_GAS_OK == res) {
+        bus->op = op;
+        bus->uart_events = 0U;
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_linux_bus_step(xensiv_pas_gas_linux_bus_t *bus) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+
+    if (NULL == bus->op) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    /* Consume the expiration, a spurious wake-up finds the timer not expired */
+    uint64_t expirations;
+    (void)read(bus->timer_fd, &expirations, sizeof(expirations));
+
+    int32_t res;
+    uint64_t now_us;
+    uint64_t due_us;
+
+    bus->stepping = true;
+    do
+    {
+        xensiv_pas_gas_linux_uart_begin(bus);
+        now_us = xensiv_pas_gas_plat_get_time_us();
+        res = xensiv_pas_gas_async_step(bus->op, now_us);
+        due_us = xensiv_pas_gas_async_get_due_us(bus->op);
+    } while ((XENSIV_PAS_GAS_PENDING == res) && (0U == bus->uart_events) && (due_us <= now_us));
+    bus->stepping = false;
+
+    if (XENSIV_PAS_GAS_PENDING != res) {
+        bus->op = NULL;
+        bus->uart_events = 0U;
+        (void)xensiv_pas_gas_linux_arm(bus, UINT64_MAX);
+        (void)xensiv_pas_gas_linux_watch(bus, 0U);
+    } else {
+        /* The timer also bounds the wait for the serial port */
+        bool awaits_port = (0U != bus->uart_events);
+        int32_t armed = xensiv_pas_gas_linux_arm(bus, awaits_port ? bus->uart_deadline_us : due_us);
+        if (XENSIV_PAS_GAS_OK == armed) {
+            armed = xensiv_pas_gas_linux_watch(bus, bus->uart_events);
+        }
+        if (XENSIV_PAS_GAS_OK != armed) {
+            /* Without the timer or the port the operation cannot be stepped again */
+            bus->op = NULL;
+            bus->uart_events = 0U;
+            (void)xensiv_pas_gas_linux_watch(bus, 0U);
+            res = XENSIV_PAS_GAS_ERR_COMM;
+        }
+    }
+
+    return res;
+}
+
+bool xensiv_pas_gas_linux_bus_is_busy(const xensiv_pas_gas_linux_bus_t *bus) {
+    xensiv_pas_gas_plat_assert(bus != NULL);
+
+    return (NULL != bus->op);
+}
+
+int32_t xensiv_pas_gas_linux_gpio_open(xensiv_pas_gas_linux_gpio_t *gpio, const char *chip_path, uint32_t line) {
+    xensiv_pas_gas_plat_assert(gpio != NULL);
+    xensiv_pas_gas_plat_assert(chip_path != NULL);
+
+    gpio->fd = -1;
+
+    int chip_fd = open(chip_path, O_RDWR | O_CLOEXEC);
+    if (chip_fd < 0) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    struct gpio_v2_line_request req;
+    (void)memset(&req, 0, sizeof(req));
+    req.offsets[0] = line;
+    req.num_lines = 1U;
+    req.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    (void)strncpy(req.consumer, XENSIV_PAS_GAS_LINUX_GPIO_CONSUMER, sizeof(req.consumer) - 1U);
+
+    int ret = ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &req);
+    (void)close(chip_fd);
+
+    if ((ret < 0) || (0 != fcntl(req.fd, F_SETFL, O_NONBLOCK))) {
+        if (ret >= 0) {
+            (void)close(req.fd);
+        }
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    gpio->fd = req.fd;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_linux_gpio_close(xensiv_pas_gas_linux_gpio_t *gpio) {
+    xensiv_pas_gas_plat_assert(gpio != NULL);
+
+    if (gpio->fd >= 0) {
+        (void)close(gpio->fd);
+    }
+    gpio->fd = -1;
+}
+
+int xensiv_pas_gas_linux_gpio_get_fd(const xensiv_pas_gas_linux_gpio_t *gpio) {
+    xensiv_pas_gas_plat_assert(gpio != NULL);
+
+    return gpio->fd;
+}
+
+int32_t xensiv_pas_gas_linux_gpio_read(xensiv_pas_gas_linux_gpio_t *gpio, bool *level, uint64_t *time_us) {
+    xensiv_pas_gas_plat_assert(gpio != NULL);
+    xensiv_pas_gas_plat_assert(level != NULL);
+    xensiv_pas_gas_plat_assert(time_us != NULL);
+
+    struct gpio_v2_line_event event;
+    ssize_t ret = read(gpio->fd, &event, sizeof(event));
+
+    if (ret < 0) {
+        return ((EAGAIN == errno) || (EINTR == errno)) ? XENSIV_PAS_GAS_READ_NRDY : XENSIV_PAS_GAS_ERR_COMM;
+    }
+    if ((size_t)ret != sizeof(event)) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    *level = (GPIO_V2_LINE_EVENT_RISING_EDGE == event.id);
+    *time_us = event.timestamp_ns / XENSIV_PAS_GAS_LINUX_NS_PER_US;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_plat_i2c_transfer(void *ctx, uint16_t dev_addr, const uint8_t *tx_buffer, size_t tx_len, uint8_t *rx_buffer, size_t rx_len) {
+    xensiv_pas_gas_linux_bus_t *bus = (xensiv_pas_gas_linux_bus_t *)ctx;
+
+    /* Write and read are combined with a repeated start */
+    struct i2c_msg msgs[2] = {
+        { .addr = dev_addr, .flags = 0U, .len = (uint16_t)tx_len, .buf = (uint8_t *)tx_buffer },
+        { .addr = dev_addr, .flags = I2C_M_RD, .len = (uint16_t)rx_len, .buf = rx_buffer }
+    };
+    struct i2c_rdwr_ioctl_data xfer = { .msgs = msgs, .nmsgs = (NULL != rx_buffer) ? 2U : 1U };
+
+    return (ioctl(bus->fd, I2C_RDWR, &xfer) < 0) ? XENSIV_PAS_GAS_ERR_COMM : XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_plat_uart_read(void *ctx, uint8_t *data, size_t len) {
+    xensiv_pas_gas_linux_bus_t *bus = (xensiv_pas_gas_linux_bus_t *)ctx;
+    size_t done = 0U;
+
+    if (bus->stepping) {
+        return xensiv_pas_gas_linux_uart_receive(bus, data, len);
+    }
+
+    while (done < len)
+    {
+        if (XENSIV_PAS_GAS_OK != xensiv_pas_gas_linux_uart_wait(bus, POLLIN)) {
+            return XENSIV_PAS_GAS_ERR_COMM;
+        }
+
+        ssize_t ret = read(bus->fd, &data[done], len - done);
+        if (ret > 0) {
+            done += (size_t)ret;
+        } else if ((0 == ret) || ((EAGAIN != errno) && (EINTR != errno))) {
+            return XENSIV_PAS_GAS_ERR_COMM;
+        }
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_plat_uart_write(void *ctx, uint8_t *data, size_t len) {
+    xensiv_pas_gas_linux_bus_t *bus = (xensiv_pas_gas_linux_bus_t *)ctx;
+    size_t done = 0U;
+
+    if (bus->stepping) {
+        return xensiv_pas_gas_linux_uart_send(bus, data, len);
+    }
+
+    /* Drop a late response of a previous command that timed out */
+    (void)tcflush(bus->fd, TCIFLUSH);
+
+    while (done < len)
+    {
+        ssize_t ret = write(bus->fd, &data[done], len - done);
+        if (ret > 0) {
+            done += (size_t)ret;
+        } else if ((ret < 0) && (EAGAIN == errno)) {
+            if (XENSIV_PAS_GAS_OK != xensiv_pas_gas_linux_uart_wait(bus, POLLOUT)) {
+                return XENSIV_PAS_GAS_ERR_COMM;
+            }
+        } else if ((0 == ret) || (EINTR != errno)) {
+            return XENSIV_PAS_GAS_ERR_COMM;
+        }
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_plat_delay(uint32_t ms) {
+    struct timespec ts = { .tv_sec = (time_t)(ms / 1000U), .tv_nsec = (long)(ms % 1000U) * XENSIV_PAS_GAS_LINUX_NS_PER_MS };
+
+    while ((0 != nanosleep(&ts, &ts)) && (EINTR == errno))
+    {
+    }
+}
+
+uint16_t xensiv_pas_gas_plat_htons(uint16_t x) {
+    return htons(x);
+}
+
+void xensiv_pas_gas_plat_assert(int expr) {
+    assert(expr);
+    (void)expr;
+}
+
+uint64_t xensiv_pas_gas_plat_get_time_us(void) {
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return xensiv_pas_gas_linux_timespec_to_us(&ts);
+}
+
+int32_t xensiv_pas_gas_plat_pwm_capture(void *ctx, xensiv_pas_gas_pwm_edge_t *edges, size_t max_edges, size_t *count) {
+    xensiv_pas_gas_linux_gpio_t *gpio = (xensiv_pas_gas_linux_gpio_t *)ctx;
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    *count = 0U;
+    while ((*count < max_edges) && (XENSIV_PAS_GAS_OK == res))
+    {
+        res = xensiv_pas_gas_linux_gpio_read(gpio, &edges[*count].level, &edges[*count].time_us);
+        if (XENSIV_PAS_GAS_OK == res) {
+            (*count)++;
+        }
+    }
+
+    return (XENSIV_PAS_GAS_READ_NRDY == res) ? XENSIV_PAS_GAS_OK : res;
+}
@@ -0,0 +1,242 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_linux.h
+ *
+ * Description: Linux platform of the XENSIV™ PAS GAS sensor driver, with file descriptors to
+ *              multiplex the sensor waits in an event loop.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_LINUX_H_
+#define XENSIV_PAS_GAS_LINUX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_async.h"
+
+/**
+ * \addtogroup group_board_libs_linux XENSIV™ PAS GAS sensor Linux platform
+ * \{
+ * Linux implementation of \ref group_board_libs_platform over the i2c-dev, tty and GPIO character
+ * device interfaces. Linking it in place of a platform port runs the driver on a Linux host.
+ *
+ * The ctx passed to the driver init functions must point to a \ref xensiv_pas_gas_linux_bus_t opened with
+ * \ref xensiv_pas_gas_linux_i2c_open or \ref xensiv_pas_gas_linux_uart_open; the ctx passed to \ref
+ * xensiv_pas_gas_co2_pwm_read must point to a \ref xensiv_pas_gas_linux_gpio_t. The I2C address of the
+ * sensors is fixed, so each bus carries one sensor.
+ *
+ * The blocking driver functions wait in \ref xensiv_pas_gas_plat_delay. To serve many buses from one
+ * thread, the operations of \ref group_board_libs_async are run on the bus instead: the bus keeps a timerfd
+ * armed at the time the operation must be stepped again, i.e. at the end of the spacing after each register
+ * access, of the soft reset delay or of the forced compensation poll interval. The timerfd and the GPIO
+ * line file descriptors are added to an epoll set:
+ * \code
+ *  xensiv_pas_gas_async_read_result(&op, &dev, &val);
+ *  xensiv_pas_gas_linux_bus_start(&bus, &op);
+ *  ev.data.ptr = &bus;
+ *  epoll_ctl(epfd, EPOLL_CTL_ADD, xensiv_pas_gas_linux_bus_get_fd(&bus), &ev);
+ *
+ *  // EPOLLIN on the bus
+ *  if (XENSIV_PAS_GAS_PENDING != (res = xensiv_pas_gas_linux_bus_step(&bus))) {
+ *      ...                                             // val is valid if res is XENSIV_PAS_GAS_OK
+ *  }
+ *
+ *  // EPOLLIN on the INT pin
+ *  while (XENSIV_PAS_GAS_OK == xensiv_pas_gas_linux_gpio_read(&gpio, &level, &time_us)) {
+ *      ...
+ *  }
+ * \endcode
+ *
+ * An I2C transfer returns once the adapter completed it. A step on a UART bus does not wait for the sensor:
+ * it sends the command and returns XENSIV_PAS_GAS_PENDING, and the bus file descriptor, an epoll set of the
+ * timer and of the serial port, becomes readable once the response arrived. The next step resumes the access
+ * from the responses received so far. An access whose response is missing for timeout_ms fails with
+ * XENSIV_PAS_GAS_ERR_COMM, as with the blocking functions, which still wait for the response in poll(). All
+ * timestamps, including the GPIO edge timestamps and \ref xensiv_pas_gas_plat_get_time_us, are taken from
+ * CLOCK_MONOTONIC.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Default time in milliseconds a UART access waits for the sensor response */
+#define XENSIV_PAS_GAS_LINUX_UART_TIMEOUT_MS     (100U)
+
+/** Bytes of the UART responses kept during a step, those of a read of all the registers reachable over UART */
+#define XENSIV_PAS_GAS_LINUX_UART_RX_SIZE        (3U * (XENSIV_PAS_GAS_REG_SENS_RST + 1U))
+
+/********************************* Type definitions **************************************/
+
+/** Bus of the Linux platform. The members are private to the platform. */
+typedef struct
+{
+    int fd;                                 /*!< File descriptor of the I2C adapter or of the serial port */
+    int timer_fd;                           /*!< Timer armed at the due time of the running operation */
+    int epoll_fd;                           /*!< Set of the timer and, while a step waits for it, of the serial port */
+    xensiv_pas_gas_interface_t itf;         /*!< Communication interface */
+    uint32_t timeout_ms;                    /*!< Time a UART access waits for the sensor response */
+    xensiv_pas_gas_async_t *op;             /*!< Running operation; NULL if the bus is idle */
+    bool stepping;                          /*!< The UART functions are called by a step and must not wait */
+    uint32_t uart_events;                   /*!< Events of the serial port the step waits for; 0 if none */
+    uint32_t uart_watched;                  /*!< Events of the serial port in the epoll set */
+    uint64_t uart_deadline_us;              /*!< Time after which the awaited command or response fails */
+    uint8_t uart_cmd;                       /*!< Index of the next command issued by the step */
+    uint8_t uart_sent;                      /*!< Number of commands of the step already sent */
+    size_t uart_tx_done;                    /*!< Bytes of the command being sent already written */
+    size_t uart_rx_len;                     /*!< Bytes of the responses of the step received */
+    size_t uart_rx_pos;                     /*!< Bytes of the responses of the step already handed to the driver */
+    uint8_t uart_rx[XENSIV_PAS_GAS_LINUX_UART_RX_SIZE];  /*!< Responses of the step */
+} xensiv_pas_gas_linux_bus_t;
+
+/** GPIO line of the Linux platform, capturing both edges. The members are private to the platform. */
+typedef struct
+{
+    int fd;                                 /*!< File descriptor of the requested line */
+} xensiv_pas_gas_linux_gpio_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opens an I2C adapter, e.g. "/dev/i2c-1"
+ *
+ * @param[out] bus Bus allocated by the user
+ * @param[in] path Path of the i2c-dev device
+ * @return XENSIV_PAS_GAS_OK if the adapter and the timer were opened; XENSIV_PAS_GAS_ERR_COMM otherwise
+ */
+int32_t xensiv_pas_gas_linux_i2c_open(xensiv_pas_gas_linux_bus_t *bus, const char *path);
+
+/**
+ * @brief Opens a serial port, e.g. "/dev/ttyUSB0", and configures it to 9600 baud, 8N1, raw mode.
+ * The response timeout is set to \ref XENSIV_PAS_GAS_LINUX_UART_TIMEOUT_MS.
+ *
+ * @param[out] bus Bus allocated by the user
+ * @param[in] path Path of the tty device
+ * @return XENSIV_PAS_GAS_OK if the port and the timer were opened; XENSIV_PAS_GAS_ERR_COMM otherwise
+ */
+int32_t xensiv_pas_gas_linux_uart_open(xensiv_pas_gas_linux_bus_t *bus, const char *path);
+
+/**
+ * @brief Closes a bus. A running operation is abandoned.
+ *
+ * @param[in] bus Bus
+ */
+void xensiv_pas_gas_linux_bus_close(xensiv_pas_gas_linux_bus_t *bus);
+
+/**
+ * @brief Gets the file descriptor to wait on for the bus.
+ * The descriptor becomes readable once the running operation must be stepped with \ref
+ * xensiv_pas_gas_linux_bus_step: at the due time of its next step or, on a UART bus, once the serial port is
+ * ready for the command or the response the step waits for. It stays unreadable while the bus is idle.
+ *
+ * @param[in] bus Bus
+ * @return File descriptor of the epoll set of the bus timer and of the serial port
+ */
+int xensiv_pas_gas_linux_bus_get_fd(const xensiv_pas_gas_linux_bus_t *bus);
+
+/**
+ * @brief Gets the file descriptor of the I2C adapter or of the serial port.
+ * The serial port is non-blocking. Its readiness during a step is already reported by \ref
+ * xensiv_pas_gas_linux_bus_get_fd, which is the descriptor to wait on to step the bus.
+ *
+ * @param[in] bus Bus
+ * @return File descriptor of the i2c-dev or of the tty device
+ */
+int xensiv_pas_gas_linux_bus_get_io_fd(const xensiv_pas_gas_linux_bus_t *bus);
+
+/**
+ * @brief Runs an operation on the bus.
+ * The operation must have been started on a sensor of this bus with one of the functions of \ref
+ * group_board_libs_async; it is stepped the first time once the bus file descriptor becomes readable.
+ *
+ * @param[in] bus Bus
+ * @param[in] op Operation state, kept until the operation is completed
+ * @return XENSIV_PAS_GAS_OK if the operation was scheduled; XENSIV_PAS_GAS_INVALID_PARAMETER if another operation
+ * is running on the bus; XENSIV_PAS_GAS_ERR_COMM if the timer could not be armed
+ */
+int32_t xensiv_pas_gas_linux_bus_start(xensiv_pas_gas_linux_bus_t *bus, xensiv_pas_gas_async_t *op);
+
+/**
+ * @brief Advances the running operation and re-arms the bus timer.
+ * Steps the operation as long as its next step is due, then arms the timer at the time of the next step.
+ * Calling it before the file descriptor became readable has no effect. On a UART bus the step returns
+ * XENSIV_PAS_GAS_PENDING instead of waiting for the serial port, the file descriptor then becomes readable once
+ * the port is ready or timeout_ms elapsed.
+ *
+ * @param[in] bus Bus
+ * @return XENSIV_PAS_GAS_PENDING if the operation is still running; XENSIV_PAS_GAS_INVALID_PARAMETER if no operation
+ * is running on the bus; otherwise the result of the operation, the bus is then idle
+ */
+int32_t xensiv_pas_gas_linux_bus_step(xensiv_pas_gas_linux_bus_t *bus);
+
+/**
+ * @brief Checks whether an operation is running on the bus
+ *
+ * @param[in] bus Bus
+ * @return True if an operation is running
+ */
+bool xensiv_pas_gas_linux_bus_is_busy(const xensiv_pas_gas_linux_bus_t *bus);
+
+/**
+ * @brief Requests a GPIO line as input reporting both edges, e.g. the INT or PWM pin of the sensor
+ *
+ * @param[out] gpio GPIO line allocated by the user
+ * @param[in] chip_path Path of the GPIO character device, e.g. "/dev/gpiochip0"
+ * @param[in] line Line offset on the chip
+ * @return XENSIV_PAS_GAS_OK if the line was requested; XENSIV_PAS_GAS_ERR_COMM otherwise
+ */
+int32_t xensiv_pas_gas_linux_gpio_open(xensiv_pas_gas_linux_gpio_t *gpio, const char *chip_path, uint32_t line);
+
+/**
+ * @brief Releases a GPIO line
+ *
+ * @param[in] gpio GPIO line
+ */
+void xensiv_pas_gas_linux_gpio_close(xensiv_pas_gas_linux_gpio_t *gpio);
+
+/**
+ * @brief Gets the file descriptor to wait on for the GPIO line.
+ * The descriptor is readable while edges are queued.
+ *
+ * @param[in] gpio GPIO line
+ * @return File descriptor of the line
+ */
+int xensiv_pas_gas_linux_gpio_get_fd(const xensiv_pas_gas_linux_gpio_t *gpio);
+
+/**
+ * @brief Reads the next queued edge without blocking
+ *
+ * @param[in] gpio GPIO line
+ * @param[out] level Pointer to populate with the pin level after the edge; true for a rising edge
+ * @param[out] time_us Pointer to populate with the kernel timestamp of the edge
+ * @return XENSIV_PAS_GAS_OK if an edge was read; XENSIV_PAS_GAS_READ_NRDY if no edge is queued;
+ * XENSIV_PAS_GAS_ERR_COMM otherwise
+ */
+int32_t xensiv_pas_gas_linux_gpio_read(xensiv_pas_gas_linux_gpio_t *gpio, bool *level, uint64_t *time_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_linux */
+
+#endif /* XENSIV_PAS_GAS_LINUX_H_ */
@@ -0,0 +1,177 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_multigas.c
+ *
+ * Description: This file contains the time-multiplexed multi-gas measurement scheduler of the XENSIV™
+ *              PAS GAS A2L sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_multigas.h"
+
+#if XENSIV_PAS_GAS_ENABLE_A2L
+
+#define XENSIV_PAS_GAS_MULTIGAS_DEFAULT_RATE_S      (10U)
+
+/* Selects a gas, writing the cached GAS_CFG */
+static int32_t xensiv_pas_gas_multigas_select(xensiv_pas_gas_multigas_t *sched, uint8_t gas) {
+    xensiv_pas_gas_a2l_gas_config_t gas_cfg = sched->gas_cfg;
+    gas_cfg.b.gas_select = gas;
+
+    int32_t res = xensiv_pas_gas_a2l_set_gas_config(sched->dev, gas_cfg);
+    if (XENSIV_PAS_GAS_OK == res) {
+        sched->gas_cfg = gas_cfg;
+        sched->dwell = 0U;
+    }
+
+    return res;
+}
+
+/* Next gas of the mask after the selected one, wrapping around */
+static uint8_t xensiv_pas_gas_multigas_next(const xensiv_pas_gas_multigas_t *sched) {
+    uint8_t gas = sched->gas_cfg.b.gas_select;
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_MULTIGAS_MAX_GASES; ++i)
+    {
+        gas = (uint8_t)((gas + 1U) % XENSIV_PAS_GAS_MULTIGAS_MAX_GASES);
+        if ((sched->config.gas_mask & XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(gas)) != 0U) {
+            break;
+        }
+    }
+
+    return gas;
+}
+
+void xensiv_pas_gas_multigas_get_default_config(xensiv_pas_gas_multigas_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->gas_mask = (uint8_t)(XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(XENSIV_PAS_GAS_A2L_GAS_R454B) |
+                                 XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(XENSIV_PAS_GAS_A2L_GAS_R32));
+    config->samples_per_gas = 1U;
+    config->rate_s = XENSIV_PAS_GAS_MULTIGAS_DEFAULT_RATE_S;
+}
+
+int32_t xensiv_pas_gas_multigas_start(xensiv_pas_gas_multigas_t *sched, const xensiv_pas_gas_t *dev, const xensiv_pas_gas_multigas_config_t *config) {
+    xensiv_pas_gas_plat_assert(sched != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if ((config->gas_mask == 0U) || (config->gas_mask >= XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(XENSIV_PAS_GAS_MULTIGAS_MAX_GASES)) ||
+        (config->samples_per_gas == 0U) || (config->rate_s < dev->meas_rate_min) || (config->rate_s > XENSIV_PAS_GAS_MEAS_RATE_MAX)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    sched->dev = dev;
+    sched->config = *config;
+    sched->dwell = 0U;
+    sched->switch_res = XENSIV_PAS_GAS_OK;
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_MULTIGAS_MAX_GASES; ++i)
+    {
+        sched->streams[i].head = 0U;
+        sched->streams[i].count = 0U;
+        sched->streams[i].seq = 0U;
+    }
+
+    int32_t res = xensiv_pas_gas_a2l_get_gas_config(dev, &sched->gas_cfg);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        if ((config->gas_mask & ~sched->gas_cfg.b.gas_avail) != 0U) {
+            res = XENSIV_PAS_GAS_INVALID_PARAMETER;
+        } else if ((config->gas_mask & XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(sched->gas_cfg.b.gas_select)) == 0U) {
+            res = xensiv_pas_gas_multigas_select(sched, xensiv_pas_gas_multigas_next(sched));
+        } else {
+            /* Keep the selected gas, it is part of the mask */
+        }
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        res = xensiv_pas_gas_start_continuous_mode(dev, config->rate_s);
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_multigas_poll(xensiv_pas_gas_multigas_t *sched, xensiv_pas_gas_multigas_sample_t *sample) {
+    xensiv_pas_gas_plat_assert(sched != NULL);
+
+    uint16_t val;
+    int32_t res = xensiv_pas_gas_get_result(sched->dev, &val);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        uint8_t gas = sched->gas_cfg.b.gas_select;
+        xensiv_pas_gas_multigas_stream_t *stream = &sched->streams[gas];
+
+        if (stream->count == XENSIV_PAS_GAS_MULTIGAS_STREAM_LEN) {
+            stream->head = (uint8_t)((stream->head + 1U) % XENSIV_PAS_GAS_MULTIGAS_STREAM_LEN);
+            stream->count--;
+        }
+        stream->buf[(stream->head + stream->count) % XENSIV_PAS_GAS_MULTIGAS_STREAM_LEN] = val;
+        stream->count++;
+
+        if (NULL != sample) {
+            sample->gas = (xensiv_pas_gas_a2l_gas_selection_t)gas;
+            sample->val = val;
+            sample->seq = stream->seq;
+        }
+        stream->seq++;
+
+        if (sched->dwell < UINT8_MAX) {
+            sched->dwell++;
+        }
+
+        /* A failed switch is written again after the next result, which still belongs to the current gas */
+        uint8_t next = xensiv_pas_gas_multigas_next(sched);
+        if ((sched->dwell >= sched->config.samples_per_gas) && (next != gas)) {
+            sched->switch_res = xensiv_pas_gas_multigas_select(sched, next);
+        }
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_multigas_read_stream(xensiv_pas_gas_multigas_t *sched, xensiv_pas_gas_a2l_gas_selection_t gas, uint16_t *val) {
+    xensiv_pas_gas_plat_assert(sched != NULL);
+    xensiv_pas_gas_plat_assert((uint32_t)gas < XENSIV_PAS_GAS_MULTIGAS_MAX_GASES);
+    xensiv_pas_gas_plat_assert(val != NULL);
+
+    xensiv_pas_gas_multigas_stream_t *stream = &sched->streams[gas];
+
+    if (stream->count == 0U) {
+        return XENSIV_PAS_GAS_READ_NRDY;
+    }
+
+    *val = stream->buf[stream->head];
+    stream->head = (uint8_t)((stream->head + 1U) % XENSIV_PAS_GAS_MULTIGAS_STREAM_LEN);
+    stream->count--;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_multigas_get_switch_status(const xensiv_pas_gas_multigas_t *sched) {
+    xensiv_pas_gas_plat_assert(sched != NULL);
+
+    return sched->switch_res;
+}
+
+xensiv_pas_gas_a2l_gas_selection_t xensiv_pas_gas_multigas_get_gas(const xensiv_pas_gas_multigas_t *sched) {
+    xensiv_pas_gas_plat_assert(sched != NULL);
+
+    return (xensiv_pas_gas_a2l_gas_selection_t)sched->gas_cfg.b.gas_select;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_A2L */
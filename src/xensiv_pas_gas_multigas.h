@@ -0,0 +1,184 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_multigas.h
+ *
+ * Description: This file contains the time-multiplexed multi-gas measurement scheduler of the XENSIV™
+ *              PAS GAS A2L sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_MULTIGAS_H_
+#define XENSIV_PAS_GAS_MULTIGAS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas_a2l.h"
+
+/**
+ * \addtogroup group_board_libs_multigas XENSIV™ PAS GAS A2L sensor multi-gas scheduler
+ * \{
+ * Scheduler which monitors several refrigerants with one A2L sensor by rotating the gas selection of GAS_CFG
+ * between the measurements of the continuous mode.
+ *
+ * GAS_CFG is read once when the scheduler is started and kept in cache, so each gas switch is a single
+ * register write. The switch is written right after a result has been read, before the next measurement
+ * starts; each result is tagged with the gas selected while it was measured and appended to the stream of
+ * that gas. If a switch fails, the result is still delivered, the gas is kept and the switch is written again
+ * after the next result, which is measured with the kept gas; the error of the switch is reported by
+ * \ref xensiv_pas_gas_multigas_get_switch_status.
+ *
+ * The scheduler requires the sensor to be connected over I2C, since GAS_CFG is beyond the UART register range.
+ *
+ * Results must be read before the next measurement starts, e.g. on the DRDY interrupt:
+ * \code
+ *  xensiv_pas_gas_multigas_config_t config;
+ *  xensiv_pas_gas_multigas_get_default_config(&config);
+ *  xensiv_pas_gas_multigas_start(&sched, &dev, &config);
+ *
+ *  // DRDY interrupt
+ *  if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_multigas_poll(&sched, &sample)) {
+ *      ...
+ *  }
+ *
+ *  // Consumer of the R32 samples
+ *  while (XENSIV_PAS_GAS_OK == xensiv_pas_gas_multigas_read_stream(&sched, XENSIV_PAS_GAS_A2L_GAS_R32, &val)) {
+ *      ...
+ *  }
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Number of gas selections of GAS_CFG */
+#define XENSIV_PAS_GAS_MULTIGAS_MAX_GASES           (4U)
+
+/** Number of samples kept per gas stream; the oldest sample is dropped when a stream is full */
+#define XENSIV_PAS_GAS_MULTIGAS_STREAM_LEN          (8U)
+
+/** Bit of a gas in \ref xensiv_pas_gas_multigas_config_t::gas_mask */
+#define XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(gas)        (1U << (uint8_t)(gas))
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the multi-gas scheduler */
+typedef struct
+{
+    uint8_t gas_mask;                       /*!< Gases to measure, see \ref XENSIV_PAS_GAS_MULTIGAS_GAS_BIT; all must be available on the sensor */
+    uint8_t samples_per_gas;                /*!< Number of consecutive measurements of each gas before switching */
+    uint16_t rate_s;                        /*!< Measurement rate in seconds */
+} xensiv_pas_gas_multigas_config_t;
+
+/** Result tagged with the measured gas */
+typedef struct
+{
+    xensiv_pas_gas_a2l_gas_selection_t gas; /*!< Gas selected during the measurement */
+    uint16_t val;                           /*!< Gas concentration */
+    uint32_t seq;                           /*!< Sequence number of the sample within the stream of the gas */
+} xensiv_pas_gas_multigas_sample_t;
+
+/** Samples of one gas */
+typedef struct
+{
+    uint16_t buf[XENSIV_PAS_GAS_MULTIGAS_STREAM_LEN];   /*!< Ring of samples */
+    uint8_t head;                           /*!< Index of the oldest sample */
+    uint8_t count;                          /*!< Number of samples in the ring */
+    uint32_t seq;                           /*!< Number of samples appended */
+} xensiv_pas_gas_multigas_stream_t;
+
+/** State of the multi-gas scheduler. The members are private to the scheduler. */
+typedef struct
+{
+    const xensiv_pas_gas_t *dev;            /*!< Sensor device */
+    xensiv_pas_gas_multigas_config_t config;    /*!< Configuration */
+    xensiv_pas_gas_a2l_gas_config_t gas_cfg;    /*!< Cached GAS_CFG */
+    uint8_t dwell;                          /*!< Number of results of the selected gas since the last switch */
+    int32_t switch_res;                     /*!< Result of the last gas switch */
+    xensiv_pas_gas_multigas_stream_t streams[XENSIV_PAS_GAS_MULTIGAS_MAX_GASES];    /*!< Streams, indexed by gas */
+} xensiv_pas_gas_multigas_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default configuration.
+ * R454B and R32 alternating at each measurement, measurement rate 10 s.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_multigas_get_default_config(xensiv_pas_gas_multigas_config_t *config);
+
+/**
+ * @brief Selects the first gas of the mask and starts the continuous mode
+ *
+ * @param[out] sched Scheduler state allocated by the user
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS A2L sensor device structure
+ * @param[in] config Scheduler configuration
+ * @return XENSIV_PAS_GAS_OK if the continuous mode was started; XENSIV_PAS_GAS_INVALID_PARAMETER if the configuration
+ * is out of range, a gas of the mask is not available on the sensor or the sensor is connected over UART, which does
+ * not reach GAS_CFG; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_multigas_start(xensiv_pas_gas_multigas_t *sched, const xensiv_pas_gas_t *dev, const xensiv_pas_gas_multigas_config_t *config);
+
+/**
+ * @brief Reads a new result, appends it to the stream of its gas and switches the gas if its turn is over
+ *
+ * @param[in] sched Scheduler state
+ * @param[out] sample Pointer to populate with the tagged result, may be NULL
+ * @return XENSIV_PAS_GAS_OK if a result was read, even if the gas switch which follows it failed;
+ * XENSIV_PAS_GAS_READ_NRDY if no new result is available; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_multigas_poll(xensiv_pas_gas_multigas_t *sched, xensiv_pas_gas_multigas_sample_t *sample);
+
+/**
+ * @brief Gets the result of the last gas switch
+ *
+ * @param[in] sched Scheduler state
+ * @return XENSIV_PAS_GAS_OK if no switch has failed since the last successful one; the error of the failed switch
+ * otherwise, the switch is then written again after the next result
+ */
+int32_t xensiv_pas_gas_multigas_get_switch_status(const xensiv_pas_gas_multigas_t *sched);
+
+/**
+ * @brief Pops the oldest sample of the stream of a gas
+ *
+ * @param[in] sched Scheduler state
+ * @param[in] gas Gas of the stream
+ * @param[out] val Pointer to populate with the gas concentration
+ * @return XENSIV_PAS_GAS_OK if a sample was popped; XENSIV_PAS_GAS_READ_NRDY if the stream is empty
+ */
+int32_t xensiv_pas_gas_multigas_read_stream(xensiv_pas_gas_multigas_t *sched, xensiv_pas_gas_a2l_gas_selection_t gas, uint16_t *val);
+
+/**
+ * @brief Gets the gas selected for the measurement in progress
+ *
+ * @param[in] sched Scheduler state
+ * @return Selected gas
+ */
+xensiv_pas_gas_a2l_gas_selection_t xensiv_pas_gas_multigas_get_gas(const xensiv_pas_gas_multigas_t *sched);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_multigas */
+
+#endif /* XENSIV_PAS_GAS_MULTIGAS_H_ */
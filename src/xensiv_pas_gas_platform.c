@@ -66,3 +66,15 @@ __weak uint16_t xensiv_pas_gas_plat_htons(uint16_t x) {
 __weak void xensiv_pas_gas_plat_assert(int expr) {
     (void)expr;
 }
+
+__weak uint64_t xensiv_pas_gas_plat_get_time_us(void) {
+    return 0;
+}
+
+__weak int32_t xensiv_pas_gas_plat_pwm_capture(void *ctx, xensiv_pas_gas_pwm_edge_t *edges, size_t max_edges, size_t *count) {
+    (void)ctx;
+    (void)edges;
+    (void)max_edges;
+    *count = 0U;
+    return 0;
+}
@@ -38,6 +38,13 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+/** Edge captured on the PWM output pin of the sensor */
+typedef struct
+{
+    uint64_t time_us;                   /*!< Capture timestamp in microseconds */
+    bool level;                         /*!< Pin level after the edge; true for a rising edge */
+} xensiv_pas_gas_pwm_edge_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -61,7 +68,8 @@ int32_t xensiv_pas_gas_plat_i2c_transfer(void *ctx, uint16_t dev_addr, const uin
  * @param[in] ctx UART object
  * @param[out] data Receive buffer
  * @param[in] len Number of bytes to receive
- * @return XENSIV_PAS_GAS_OK if the UART read was successful; an error indicating what went wrong otherwise
+ * @return XENSIV_PAS_GAS_OK if the UART read was successful; XENSIV_PAS_GAS_PENDING if a non-blocking platform has
+ * not received the response yet, see \ref group_board_libs_async; an error indicating what went wrong otherwise
  */
 int32_t xensiv_pas_gas_plat_uart_read(void *ctx, uint8_t *data, size_t len);
 
@@ -71,7 +79,8 @@ int32_t xensiv_pas_gas_plat_uart_read(void *ctx, uint8_t *data, size_t len);
  * @param[in] ctx UART object
  * @param[in] data Transmit buffer
  * @param[in] len Number of bytes to transmit
- * @return XENSIV_PAS_GAS_OK if the UART write was successful; an error indicating what went wrong otherwise
+ * @return XENSIV_PAS_GAS_OK if the UART write was successful; XENSIV_PAS_GAS_PENDING if a non-blocking platform
+ * cannot send the command yet, see \ref group_board_libs_async; an error indicating what went wrong otherwise
  */
 int32_t xensiv_pas_gas_plat_uart_write(void *ctx, uint8_t *data, size_t len);
 
@@ -101,6 +110,30 @@ uint16_t xensiv_pas_gas_plat_htons(uint16_t x);
  */
 void xensiv_pas_gas_plat_assert(int expr);
 
+/**
+ * @brief Target platform-specific function that returns a monotonic timestamp in microseconds.
+ * Required by the driver statistics and the bus trace to measure latencies, by the bus recording for the
+ * record times, by the sample broadcast for the sample times and by the coroutine executor for its timers.
+ * The default implementation returns 0, which stalls the timers of the executor and zeroes these times.
+ *
+ * @return Current time in microseconds
+ */
+uint64_t xensiv_pas_gas_plat_get_time_us(void);
+
+/**
+ * @brief Target platform-specific function that returns the edges captured on the PWM output pin.
+ * Must not block; returns the edges captured since the previous call in time order. Only used by the
+ * CO2 PWM decoder, see \ref xensiv_pas_gas_co2_pwm_read.
+ *
+ * @param[in] ctx Capture object
+ * @param[out] edges Buffer to populate with the captured edges
+ * @param[in] max_edges Number of edges the buffer can hold
+ * @param[out] count Pointer to populate with the number of edges returned
+ * @return XENSIV_PAS_GAS_OK if the capture was successful; an error indicating what went wrong otherwise, the edges
+ * returned in count are decoded nonetheless
+ */
+int32_t xensiv_pas_gas_plat_pwm_capture(void *ctx, xensiv_pas_gas_pwm_edge_t *edges, size_t max_edges, size_t *count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,118 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_pressure.c
+ *
+ * Description: This file contains the pressure compensation feed of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_pressure.h"
+
+#define XENSIV_PAS_GAS_PRESSURE_FEED_DEFAULT_DEADBAND_HPA   (2U)
+#define XENSIV_PAS_GAS_PRESSURE_FEED_DEFAULT_MAX_AGE_US     (3600000000ULL)
+#define XENSIV_PAS_GAS_PRESSURE_FEED_DEFAULT_FILTER_SHIFT   (2U)
+
+/* Fraction bits of the filtered pressure */
+#define XENSIV_PAS_GAS_PRESSURE_FEED_FRAC_BITS              (8U)
+
+static uint16_t xensiv_pas_gas_pressure_feed_round(int32_t filtered) {
+    return (uint16_t)((filtered + (1L << (XENSIV_PAS_GAS_PRESSURE_FEED_FRAC_BITS - 1U))) >> XENSIV_PAS_GAS_PRESSURE_FEED_FRAC_BITS);
+}
+
+void xensiv_pas_gas_pressure_feed_get_default_config(xensiv_pas_gas_pressure_feed_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->deadband_hpa = XENSIV_PAS_GAS_PRESSURE_FEED_DEFAULT_DEADBAND_HPA;
+    config->max_age_us = XENSIV_PAS_GAS_PRESSURE_FEED_DEFAULT_MAX_AGE_US;
+    config->filter_shift = XENSIV_PAS_GAS_PRESSURE_FEED_DEFAULT_FILTER_SHIFT;
+}
+
+int32_t xensiv_pas_gas_pressure_feed_init(xensiv_pas_gas_pressure_feed_t *feed, const xensiv_pas_gas_t *const *devs, size_t dev_count,
+                                          const xensiv_pas_gas_pressure_feed_config_t *config) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+    xensiv_pas_gas_plat_assert(devs != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    if ((dev_count == 0U) || (dev_count > XENSIV_PAS_GAS_PRESSURE_FEED_MAX_DEVS) ||
+        (config->filter_shift > XENSIV_PAS_GAS_PRESSURE_FEED_MAX_SHIFT)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    feed->devs = devs;
+    feed->dev_count = dev_count;
+    feed->config = *config;
+    feed->has_sample = false;
+    feed->filtered = 0;
+    feed->has_written = false;
+    feed->written_hpa = 0U;
+    feed->written_us = 0U;
+    feed->stale_mask = 0U;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_pressure_feed_update(xensiv_pas_gas_pressure_feed_t *feed, uint64_t time_us, uint16_t pressure_hpa) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+
+    if ((pressure_hpa < XENSIV_PAS_GAS_PRESSURE_FEED_MIN_HPA) || (pressure_hpa > XENSIV_PAS_GAS_PRESSURE_FEED_MAX_HPA)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    int32_t sample = (int32_t)pressure_hpa << XENSIV_PAS_GAS_PRESSURE_FEED_FRAC_BITS;
+    if (feed->has_sample) {
+        /* The division truncates toward zero, the average settles within 2^filter_shift fraction steps */
+        feed->filtered += (sample - feed->filtered) / (1L << feed->config.filter_shift);
+    } else {
+        feed->filtered = sample;
+        feed->has_sample = true;
+    }
+
+    uint16_t val = xensiv_pas_gas_pressure_feed_round(feed->filtered);
+    uint16_t delta = (val > feed->written_hpa) ? (uint16_t)(val - feed->written_hpa) : (uint16_t)(feed->written_hpa - val);
+
+    if (!feed->has_written || ((delta != 0U) && (delta >= feed->config.deadband_hpa)) ||
+        ((feed->config.max_age_us != 0U) && ((time_us - feed->written_us) >= feed->config.max_age_us))) {
+        feed->written_hpa = val;
+        feed->written_us = time_us;
+        feed->has_written = true;
+        feed->stale_mask = (feed->dev_count == XENSIV_PAS_GAS_PRESSURE_FEED_MAX_DEVS) ? UINT32_MAX : ((1UL << feed->dev_count) - 1U);
+    }
+
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    for (size_t i = 0U; (i < feed->dev_count) && (feed->stale_mask != 0U); ++i)
+    {
+        uint32_t bit = 1UL << i;
+        if ((feed->stale_mask & bit) != 0U) {
+            int32_t dev_res = xensiv_pas_gas_set_pressure_compensation(feed->devs[i], feed->written_hpa);
+            if (XENSIV_PAS_GAS_OK == dev_res) {
+                feed->stale_mask &= ~bit;
+            } else if (XENSIV_PAS_GAS_OK == res) {
+                res = dev_res;
+            }
+        }
+    }
+
+    return res;
+}
+
+uint16_t xensiv_pas_gas_pressure_feed_get_pressure(const xensiv_pas_gas_pressure_feed_t *feed) {
+    xensiv_pas_gas_plat_assert(feed != NULL);
+
+    return feed->has_sample ? xensiv_pas_gas_pressure_feed_round(feed->filtered) : 0U;
+}
@@ -0,0 +1,145 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_pressure.h
+ *
+ * Description: This file contains the pressure compensation feed of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_PRESSURE_H_
+#define XENSIV_PAS_GAS_PRESSURE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_pressure XENSIV™ PAS GAS sensor pressure compensation feed
+ * \{
+ * Feed which forwards the readings of an external barometer to the PRESS_REF register of one or more sensors,
+ * e.g. all sensors in the same enclosure.
+ *
+ * The readings are smoothed by an exponential moving average with a weight of 1 / 2^filter_shift. PRESS_REF is
+ * only written when the filtered pressure moves by deadband_hpa or more from the value last written, or when
+ * the value last written is older than max_age_us, which also restores PRESS_REF after a sensor reset. Each
+ * write is a single 2-byte burst per sensor; a sensor whose write failed is written again at the next reading.
+ *
+ * \code
+ *  static const xensiv_pas_gas_t *const devs[] = { &dev0, &dev1 };
+ *  xensiv_pas_gas_pressure_feed_config_t config;
+ *  xensiv_pas_gas_pressure_feed_get_default_config(&config);
+ *  xensiv_pas_gas_pressure_feed_init(&feed, devs, 2U, &config);
+ *
+ *  // On each barometer reading
+ *  xensiv_pas_gas_pressure_feed_update(&feed, now_us(), pressure_hpa);
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Maximum number of sensors fed by one pressure feed */
+#define XENSIV_PAS_GAS_PRESSURE_FEED_MAX_DEVS       (32U)
+
+/** Lowest pressure accepted by the feed, in hPa */
+#define XENSIV_PAS_GAS_PRESSURE_FEED_MIN_HPA        (750U)
+
+/** Highest pressure accepted by the feed, in hPa */
+#define XENSIV_PAS_GAS_PRESSURE_FEED_MAX_HPA        (1150U)
+
+/** Highest filter_shift accepted by the feed */
+#define XENSIV_PAS_GAS_PRESSURE_FEED_MAX_SHIFT      (8U)
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the pressure compensation feed */
+typedef struct
+{
+    uint16_t deadband_hpa;                  /*!< Change of the filtered pressure from which PRESS_REF is written; 0 to write on any change */
+    uint64_t max_age_us;                    /*!< Age of the value last written from which PRESS_REF is written again; 0 to disable */
+    uint8_t filter_shift;                   /*!< Weight of a new reading in the moving average is 1 / 2^filter_shift; 0 to disable filtering */
+} xensiv_pas_gas_pressure_feed_config_t;
+
+/** State of the pressure compensation feed. The members are private to the feed. */
+typedef struct
+{
+    const xensiv_pas_gas_t *const *devs;    /*!< Fed sensor devices */
+    size_t dev_count;                       /*!< Number of fed sensor devices */
+    xensiv_pas_gas_pressure_feed_config_t config;   /*!< Configuration */
+    bool has_sample;                        /*!< A reading has been filtered */
+    int32_t filtered;                       /*!< Filtered pressure, in 1/256 hPa */
+    bool has_written;                       /*!< A value has been selected for writing */
+    uint16_t written_hpa;                   /*!< Value last selected for writing */
+    uint64_t written_us;                    /*!< Time the value was selected */
+    uint32_t stale_mask;                    /*!< Sensors whose PRESS_REF does not hold written_hpa yet, one bit per device */
+} xensiv_pas_gas_pressure_feed_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default configuration.
+ * deadband_hpa 2 hPa, max_age_us 1 h, filter_shift 2.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_pressure_feed_get_default_config(xensiv_pas_gas_pressure_feed_config_t *config);
+
+/**
+ * @brief Initializes the feed. PRESS_REF is written to all sensors at the first reading.
+ *
+ * @param[out] feed Feed state allocated by the user
+ * @param[in] devs Array of pointers to the fed sensor devices, must remain valid while the feed is used
+ * @param[in] dev_count Number of devices, at most \ref XENSIV_PAS_GAS_PRESSURE_FEED_MAX_DEVS
+ * @param[in] config Feed configuration
+ * @return XENSIV_PAS_GAS_OK if the feed was initialized; XENSIV_PAS_GAS_INVALID_PARAMETER if dev_count or the
+ * configuration is out of range
+ */
+int32_t xensiv_pas_gas_pressure_feed_init(xensiv_pas_gas_pressure_feed_t *feed, const xensiv_pas_gas_t *const *devs, size_t dev_count,
+                                          const xensiv_pas_gas_pressure_feed_config_t *config);
+
+/**
+ * @brief Passes a barometer reading to the feed, which writes PRESS_REF if needed
+ *
+ * @param[in] feed Feed state
+ * @param[in] time_us Time of the reading, in microseconds of any monotonic clock
+ * @param[in] pressure_hpa Atmospheric pressure in hPa
+ * @return XENSIV_PAS_GAS_OK if the reading was processed; XENSIV_PAS_GAS_INVALID_PARAMETER if the reading is outside
+ * \ref XENSIV_PAS_GAS_PRESSURE_FEED_MIN_HPA to \ref XENSIV_PAS_GAS_PRESSURE_FEED_MAX_HPA, it is then discarded;
+ * the first error of the writes otherwise
+ */
+int32_t xensiv_pas_gas_pressure_feed_update(xensiv_pas_gas_pressure_feed_t *feed, uint64_t time_us, uint16_t pressure_hpa);
+
+/**
+ * @brief Gets the filtered pressure
+ *
+ * @param[in] feed Feed state
+ * @return Filtered pressure in hPa; 0 before the first reading
+ */
+uint16_t xensiv_pas_gas_pressure_feed_get_pressure(const xensiv_pas_gas_pressure_feed_t *feed);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_pressure */
+
+#endif /* XENSIV_PAS_GAS_PRESSURE_H_ */
@@ -23,10 +23,11 @@
  **************************************************************************************************/
 #include "xensiv_pas_gas_r290.h"
 
-#define XENSIV_PAS_GAS_R290_FCS_MEAS_RATE_S           (3)
+#if XENSIV_PAS_GAS_ENABLE_R290
 
 /** Usage of the default functionalities from base class */
 extern int32_t xensiv_pas_gas_base_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
+extern int32_t xensiv_pas_gas_base_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm);
 extern int32_t xensiv_pas_gas_base_perform_forced_compensation(const xensiv_pas_gas_t *dev, uint16_t gas_ref);
 
 int32_t xensiv_pas_gas_r290_get_device_id(const xensiv_pas_gas_t *dev, void *dev_id) {
@@ -36,6 +37,27 @@ int32_t xensiv_pas_gas_r290_get_device_id(const xensiv_pas_gas_t *dev, void *dev
     return xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_R290_REG_DEV_ID, (uint8_t *)dev_id, 1U);
 }
 
+int32_t xensiv_pas_gas_r290_get_unique_id(xensiv_pas_gas_t *dev, xensiv_pas_gas_unique_id_t *id) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(id != NULL);
+
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    if (dev->unique_id.len != XENSIV_PAS_GAS_R290_UNIQUE_ID_LEN) {
+        xensiv_pas_gas_unique_id_t uid = { .len = XENSIV_PAS_GAS_R290_UNIQUE_ID_LEN };
+        res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_R290_REG_DEV_ID, uid.id, XENSIV_PAS_GAS_R290_UNIQUE_ID_LEN);
+        if (XENSIV_PAS_GAS_OK == res) {
+            dev->unique_id = uid;
+        }
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        *id = dev->unique_id;
+    }
+
+    return res;
+}
+
 int32_t xensiv_pas_gas_r290_aboc_prefill(const xensiv_pas_gas_t *dev, uint8_t prefill) {
     xensiv_pas_gas_plat_assert(dev != NULL);
 
@@ -94,13 +116,31 @@ int32_t xensiv_pas_gas_r290_clr_self_test(const xensiv_pas_gas_t *dev, xensiv_pa
     return xensiv_pas_gas_set_reg(dev, (uint8_t)XENSIV_PAS_GAS_R290_REG_SELF_TEST_CLR, &self_test_clr.u, 1U);
 }
 
+void xensiv_pas_gas_r290_setup(xensiv_pas_gas_t *dev) {
+    dev->variant = XENSIV_PAS_GAS_VARIANT_R290;
+    dev->fcs_meas_rate_s = XENSIV_PAS_GAS_R290_FCS_MEAS_RATE_S;
+    dev->meas_rate_min = XENSIV_PAS_GAS_R290_MEAS_RATE_MIN;
+#if XENSIV_PAS_GAS_DISPATCH_FCS
+    dev->force_comp = xensiv_pas_gas_base_perform_forced_compensation;
+#endif
+}
+
 int32_t xensiv_pas_gas_r290_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx) {
     xensiv_pas_gas_plat_assert(dev != NULL);
     xensiv_pas_gas_plat_assert(ctx != NULL);
 
-    dev->fcs_meas_rate_s = XENSIV_PAS_GAS_R290_FCS_MEAS_RATE_S;
-    dev->meas_rate_min = XENSIV_PAS_GAS_R290_MEAS_RATE_MIN;
-    dev->force_comp = xensiv_pas_gas_base_perform_forced_compensation;
+    xensiv_pas_gas_r290_setup(dev);
 
     return xensiv_pas_gas_base_init(dev, itf, ctx);
 }
+
+int32_t xensiv_pas_gas_r290_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(ctx != NULL);
+
+    xensiv_pas_gas_r290_setup(dev);
+
+    return xensiv_pas_gas_base_attach(dev, itf, ctx, warm);
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_R290 */
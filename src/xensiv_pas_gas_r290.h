@@ -38,6 +38,10 @@
 
 /************************************** Macros *******************************************/
 #define XENSIV_PAS_GAS_R290_MEAS_RATE_MIN            (3U)
+#define XENSIV_PAS_GAS_R290_FCS_MEAS_RATE_S          (3U)
+
+/** Length of the unique device ID, held in the single DEV_ID register */
+#define XENSIV_PAS_GAS_R290_UNIQUE_ID_LEN            (1U)
 
 /********************************* Type definitions **************************************/
 
@@ -143,6 +147,21 @@ extern "C" {
  */
 int32_t xensiv_pas_gas_r290_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx);
 
+/**
+ * @brief Attaches to a XENSIV™ PAS GAS R290 device which may already be configured by a previous session.
+ * If the scratch pad holds \ref XENSIV_PAS_GAS_ATTACH_SIGNATURE, the sensor is ready without error flags and the measurement rate is valid,
+ * the sensor is attached without a soft reset and keeps running with its measurement configuration, rate and ABOC state.
+ * Otherwise the sensor is initialized as done by \ref xensiv_pas_gas_r290_init.
+ *
+ * @param[in out] dev Pointer to a XENSIV™ PAS GAS R290 sensor device structure allocated by the user,
+ * but the attach function will initialize its contents
+ * @param[in] itf Communication interface (I2C/UART)
+ * @param[in] ctx Pointer to the platform-specific specific protocol communication handler
+ * @param[out] warm Optional pointer to populate with true if the sensor was attached without a soft reset; NULL if not needed
+ * @return XENSIV_PAS_GAS_OK if the attach or the initialization was successful; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_r290_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface_t itf, void *ctx, bool *warm);
+
 /**
  * @brief Reads the device ID of the XENSIV™ PAS GAS R290 sensor.
  *
@@ -152,6 +171,17 @@ int32_t xensiv_pas_gas_r290_init(xensiv_pas_gas_t *dev, xensiv_pas_gas_interface
  */
 int32_t xensiv_pas_gas_r290_get_device_id(const xensiv_pas_gas_t *dev, void *dev_id);
 
+/**
+ * @brief Reads the unique device ID into the same structure as \ref xensiv_pas_gas_a2l_get_unique_id.
+ * The ID is cached in the device structure after the first successful read, later calls do not access the bus.
+ *
+ * @param[in] dev Pointer to a XENSIV™ PAS GAS R290 sensor device structure
+ * @param[out] id Pointer to populate with the unique device ID
+ * @return XENSIV_PAS_GAS_OK if the read was successful; XENSIV_PAS_GAS_INVALID_PARAMETER if the sensor is connected over
+ * UART, which does not reach DEV_ID; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_r290_get_unique_id(xensiv_pas_gas_t *dev, xensiv_pas_gas_unique_id_t *id);
+
 /**
  * @brief Configures the ABOC prefill value.
  *
@@ -0,0 +1,169 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_rate.c
+ *
+ * Description: This file contains the adaptive measurement rate controller of the XENSIV™ PAS GAS
+ *              sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_rate.h"
+
+/* Bounds the detection latency of a sudden leak to about a minute, the cost of a fixed 60 s rate */
+#define XENSIV_PAS_GAS_RATE_DEFAULT_RATE_SLOW_S      (60U)
+#define XENSIV_PAS_GAS_RATE_DEFAULT_DELTA_ENTER      (50U)
+#define XENSIV_PAS_GAS_RATE_DEFAULT_DELTA_EXIT       (20U)
+#define XENSIV_PAS_GAS_RATE_DEFAULT_ALARM_MARGIN     (200U)
+#define XENSIV_PAS_GAS_RATE_DEFAULT_STABLE_SAMPLES   (3U)
+#define XENSIV_PAS_GAS_RATE_DEFAULT_BACKOFF          (2U)
+
+/* MEAS_RATE_H, MEAS_RATE_L and MEAS_CFG written in a single burst */
+#define XENSIV_PAS_GAS_RATE_BURST_LEN                (3U)
+
+/* Writes a new measurement rate and restarts the continuous mode */
+static int32_t xensiv_pas_gas_rate_ctrl_program(xensiv_pas_gas_rate_ctrl_t *ctrl, uint16_t rate_s) {
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    /* The measurement rate must not change while a measurement mode is active */
+    if (XENSIV_PAS_GAS_OP_MODE_IDLE != ctrl->meas_cfg.b.op_mode) {
+        ctrl->meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_IDLE;
+        res = xensiv_pas_gas_set_measurement_config(ctrl->dev, ctrl->meas_cfg);
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        xensiv_pas_gas_measurement_config_t meas_cfg = ctrl->meas_cfg;
+        meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_CONTINUOUS;
+
+        uint8_t buf[XENSIV_PAS_GAS_RATE_BURST_LEN] = { (uint8_t)(rate_s >> 8U), (uint8_t)(rate_s & 0xFFU), meas_cfg.u };
+        res = xensiv_pas_gas_set_reg(ctrl->dev, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H, buf, XENSIV_PAS_GAS_RATE_BURST_LEN);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            ctrl->meas_cfg = meas_cfg;
+            ctrl->rate_s = rate_s;
+        }
+    }
+
+    /* The next sample is taken right after the restart, it only serves as reference for the following one */
+    ctrl->has_last = false;
+    ctrl->stable_count = 0U;
+
+    return res;
+}
+
+static bool xensiv_pas_gas_rate_ctrl_near_alarm(const xensiv_pas_gas_rate_ctrl_t *ctrl, uint16_t val) {
+    if ((ctrl->config.alarm_margin == 0U) || (ctrl->alarm_threshold == 0U)) {
+        return false;
+    }
+
+    /* Only the band around the threshold counts as near, a stable concentration far beyond it backs off as well */
+    return (((uint32_t)val + ctrl->config.alarm_margin) >= ctrl->alarm_threshold) &&
+           ((uint32_t)val <= ((uint32_t)ctrl->alarm_threshold + ctrl->config.alarm_margin));
+}
+
+void xensiv_pas_gas_rate_ctrl_get_default_config(xensiv_pas_gas_rate_ctrl_config_t *config) {
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    config->rate_fast_s = XENSIV_PAS_GAS_MEAS_RATE_MIN;
+    config->rate_slow_s = XENSIV_PAS_GAS_RATE_DEFAULT_RATE_SLOW_S;
+    config->delta_enter = XENSIV_PAS_GAS_RATE_DEFAULT_DELTA_ENTER;
+    config->delta_exit = XENSIV_PAS_GAS_RATE_DEFAULT_DELTA_EXIT;
+    config->alarm_margin = XENSIV_PAS_GAS_RATE_DEFAULT_ALARM_MARGIN;
+    config->stable_samples = XENSIV_PAS_GAS_RATE_DEFAULT_STABLE_SAMPLES;
+    config->backoff_multiplier = XENSIV_PAS_GAS_RATE_DEFAULT_BACKOFF;
+}
+
+int32_t xensiv_pas_gas_rate_ctrl_init(xensiv_pas_gas_rate_ctrl_t *ctrl, const xensiv_pas_gas_t *dev, const xensiv_pas_gas_rate_ctrl_config_t *config) {
+    xensiv_pas_gas_plat_assert(ctrl != NULL);
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(config != NULL);
+
+    ctrl->dev = dev;
+    ctrl->config = *config;
+    if (ctrl->config.rate_fast_s < dev->meas_rate_min) {
+        ctrl->config.rate_fast_s = dev->meas_rate_min;
+    }
+
+    if ((ctrl->config.rate_slow_s > XENSIV_PAS_GAS_MEAS_RATE_MAX) || (ctrl->config.rate_slow_s < ctrl->config.rate_fast_s) ||
+        (ctrl->config.delta_exit >= ctrl->config.delta_enter) || (ctrl->config.stable_samples == 0U) ||
+        (ctrl->config.backoff_multiplier < 2U)) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    /* INT_CFG, ALARM_TH_H and ALARM_TH_L */
+    uint8_t buf[3];
+    int32_t res = xensiv_pas_gas_get_reg(dev, (uint8_t)XENSIV_PAS_GAS_REG_INT_CFG, buf, 3U);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        xensiv_pas_gas_interrupt_config_t int_cfg = { .u = buf[0] };
+        ctrl->alarm_low_to_high = (XENSIV_PAS_GAS_ALARM_TYPE_LOW_TO_HIGH == int_cfg.b.alarm_typ);
+        ctrl->alarm_threshold = (uint16_t)(((uint16_t)buf[1] << 8U) | buf[2]);
+        res = xensiv_pas_gas_get_measurement_config(dev, &ctrl->meas_cfg);
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        if (XENSIV_PAS_GAS_BOC_CFG_FORCED == ctrl->meas_cfg.b.boc_cfg) {
+            ctrl->meas_cfg.b.boc_cfg = XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC;
+        }
+        res = xensiv_pas_gas_rate_ctrl_program(ctrl, ctrl->config.rate_fast_s);
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_rate_ctrl_update(xensiv_pas_gas_rate_ctrl_t *ctrl, uint16_t val) {
+    xensiv_pas_gas_plat_assert(ctrl != NULL);
+
+    const xensiv_pas_gas_rate_ctrl_config_t *config = &ctrl->config;
+    uint16_t rate_s = ctrl->rate_s;
+
+    if (xensiv_pas_gas_rate_ctrl_near_alarm(ctrl, val)) {
+        rate_s = config->rate_fast_s;
+        ctrl->stable_count = 0U;
+    } else if (ctrl->has_last) {
+        uint32_t delta = (val > ctrl->last_val) ? (uint32_t)(val - ctrl->last_val) : (uint32_t)(ctrl->last_val - val);
+        uint32_t next_rate_s = (uint32_t)ctrl->rate_s * config->backoff_multiplier;
+        if (next_rate_s > config->rate_slow_s) {
+            next_rate_s = config->rate_slow_s;
+        }
+
+        if (delta >= config->delta_enter) {
+            rate_s = config->rate_fast_s;
+            ctrl->stable_count = 0U;
+        } else if ((delta * next_rate_s) <= ((uint32_t)config->delta_exit * ctrl->rate_s)) {
+            /* The change scaled to the next slower rate stays within delta_exit */
+            ctrl->stable_count++;
+            if (ctrl->stable_count >= config->stable_samples) {
+                rate_s = (uint16_t)next_rate_s;
+                ctrl->stable_count = 0U;
+            }
+        } else {
+            ctrl->stable_count = 0U;
+        }
+    }
+
+    ctrl->last_val = val;
+    ctrl->has_last = true;
+
+    return (rate_s != ctrl->rate_s) ? xensiv_pas_gas_rate_ctrl_program(ctrl, rate_s) : XENSIV_PAS_GAS_OK;
+}
+
+uint16_t xensiv_pas_gas_rate_ctrl_get_rate(const xensiv_pas_gas_rate_ctrl_t *ctrl) {
+    xensiv_pas_gas_plat_assert(ctrl != NULL);
+
+    return ctrl->rate_s;
+}
@@ -0,0 +1,144 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_rate.h
+ *
+ * Description: This file contains the adaptive measurement rate controller of the XENSIV™ PAS GAS
+ *              sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_RATE_H_
+#define XENSIV_PAS_GAS_RATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_rate XENSIV™ PAS GAS sensor adaptive measurement rate
+ * \{
+ * Controller which runs the sensor in continuous mode and adapts MEAS_RATE to the gas concentration
+ * dynamics: the fast rate is programmed as soon as the concentration changes quickly or is within
+ * alarm_margin of the alarm threshold, and the rate is backed off step by step toward the slow rate while
+ * the concentration is stable, also far beyond the alarm threshold.
+ *
+ * The back-off never exceeds the slow rate, which bounds the detection latency of a sudden change to one
+ * slow period plus a measurement sequence. Set the slow rate from the latency the application accepts.
+ *
+ * The rate only backs off if the change between samples, scaled to the next slower rate, stays within
+ * delta_exit for stable_samples consecutive samples; it only returns to the fast rate if the change
+ * reaches delta_enter. A steady drift therefore settles at the rate where its change per sample fits
+ * between both thresholds instead of toggling between the fast and the slow rate.
+ *
+ * Each new result is passed to the controller after reading it, e.g. on the DRDY interrupt:
+ * \code
+ *  static xensiv_pas_gas_rate_ctrl_t ctrl;
+ *  xensiv_pas_gas_rate_ctrl_config_t config;
+ *  xensiv_pas_gas_rate_ctrl_get_default_config(&config);
+ *  xensiv_pas_gas_rate_ctrl_init(&ctrl, &dev, &config);
+ *
+ *  if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_get_result(&dev, &val)) {
+ *      xensiv_pas_gas_rate_ctrl_update(&ctrl, val);
+ *  }
+ * \endcode
+ */
+
+/********************************* Type definitions **************************************/
+
+/** Configuration of the adaptive measurement rate controller */
+typedef struct
+{
+    uint16_t rate_fast_s;                   /*!< Measurement rate while the concentration changes, raised to the meas_rate_min of the sensor if below */
+    uint16_t rate_slow_s;                   /*!< Measurement rate the controller backs off to while the concentration is stable, bounding the detection latency; at most \ref XENSIV_PAS_GAS_MEAS_RATE_MAX */
+    uint16_t delta_enter;                   /*!< Change between two samples from which the fast rate is programmed */
+    uint16_t delta_exit;                    /*!< Change between two samples, scaled to the next slower rate, up to which the concentration is stable; below delta_enter */
+    uint16_t alarm_margin;                  /*!< Distance to the alarm threshold, on either side, within which the fast rate is kept; 0 to ignore the alarm threshold */
+    uint8_t stable_samples;                 /*!< Number of consecutive stable samples before each back-off step */
+    uint8_t backoff_multiplier;             /*!< Factor applied to the measurement rate at each back-off step, at least 2 */
+} xensiv_pas_gas_rate_ctrl_config_t;
+
+/** State of the adaptive measurement rate controller. The members are private to the controller. */
+typedef struct
+{
+    const xensiv_pas_gas_t *dev;            /*!< Controlled sensor device */
+    xensiv_pas_gas_rate_ctrl_config_t config;   /*!< Configuration with the rates clamped to the sensor limits */
+    xensiv_pas_gas_measurement_config_t meas_cfg;   /*!< Measurement configuration last written */
+    uint16_t rate_s;                        /*!< Measurement rate last written */
+    uint16_t alarm_threshold;               /*!< Alarm threshold read from the sensor */
+    bool alarm_low_to_high;                 /*!< Alarm on a rising concentration */
+    bool has_last;                          /*!< A previous sample is available */
+    uint16_t last_val;                      /*!< Previous sample */
+    uint8_t stable_count;                   /*!< Number of consecutive stable samples */
+} xensiv_pas_gas_rate_ctrl_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the default controller configuration.
+ * Fast rate \ref XENSIV_PAS_GAS_MEAS_RATE_MIN, slow rate 60 s, delta_enter 50, delta_exit 20, alarm_margin 200,
+ * doubling the rate after 3 stable samples. A stable concentration then costs about one result read per minute
+ * and a sudden leak is seen within about a minute.
+ *
+ * @param[out] config Pointer to populate with the default configuration
+ */
+void xensiv_pas_gas_rate_ctrl_get_default_config(xensiv_pas_gas_rate_ctrl_config_t *config);
+
+/**
+ * @brief Initializes the controller and starts the continuous mode at the fast rate.
+ * The alarm threshold and alarm type are read from the sensor, set them before. The BOC and, for the CO2
+ * variant, the PWM configuration are kept; a pending forced compensation is replaced by the automatic BOC.
+ *
+ * @param[out] ctrl Controller state allocated by the user
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] config Controller configuration
+ * @return XENSIV_PAS_GAS_OK if the continuous mode was started; XENSIV_PAS_GAS_INVALID_PARAMETER if the configuration
+ * is inconsistent; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_rate_ctrl_init(xensiv_pas_gas_rate_ctrl_t *ctrl, const xensiv_pas_gas_t *dev, const xensiv_pas_gas_rate_ctrl_config_t *config);
+
+/**
+ * @brief Passes a new result to the controller, which writes a new measurement rate if needed.
+ * A rate change sets the sensor to idle and restarts the continuous mode, so the next measurement starts
+ * immediately. Call it right after reading the result, while no measurement sequence is running.
+ *
+ * @param[in] ctrl Controller state
+ * @param[in] val Gas concentration read with \ref xensiv_pas_gas_get_result
+ * @return XENSIV_PAS_GAS_OK if the sample was processed; an error indicating what went wrong otherwise
+ */
+int32_t xensiv_pas_gas_rate_ctrl_update(xensiv_pas_gas_rate_ctrl_t *ctrl, uint16_t val);
+
+/**
+ * @brief Gets the measurement rate currently programmed by the controller
+ *
+ * @param[in] ctrl Controller state
+ * @return Measurement rate in seconds
+ */
+uint16_t xensiv_pas_gas_rate_ctrl_get_rate(const xensiv_pas_gas_rate_ctrl_t *ctrl);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_rate */
+
+#endif /* XENSIV_PAS_GAS_RATE_H_ */
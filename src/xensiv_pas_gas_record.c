@@ -0,0 +1,117 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_record.c
+ *
+ * Description: This file contains the bus recording of the XENSIV™ PAS GAS sensor driver, which
+ *              streams the register transfers with their data and timing to a compact binary file.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "xensiv_pas_gas_record.h"
+
+/* Flags, track, delta, duration, register address, length and result at their maximum encoded lengths */
+#define XENSIV_PAS_GAS_RECORD_MAX_HEAD_LEN       (1U + 3U + 10U + 5U + 1U + 1U + 5U)
+
+static const uint8_t xensiv_pas_gas_record_magic[4] = { (uint8_t)'P', (uint8_t)'A', (uint8_t)'S', (uint8_t)'R' };
+
+int32_t xensiv_pas_gas_record_start(xensiv_pas_gas_record_t *rec, xensiv_pas_gas_record_write_fptr_t write, void *ctx) {
+    xensiv_pas_gas_plat_assert(rec != NULL);
+    xensiv_pas_gas_plat_assert(write != NULL);
+
+    uint8_t header[XENSIV_PAS_GAS_RECORD_HEADER_LEN];
+    (void)memset(header, 0, sizeof(header));
+    (void)memcpy(header, xensiv_pas_gas_record_magic, sizeof(xensiv_pas_gas_record_magic));
+    header[sizeof(xensiv_pas_gas_record_magic)] = XENSIV_PAS_GAS_RECORD_VERSION;
+
+    rec->write = write;
+    rec->ctx = ctx;
+    rec->last_us = xensiv_pas_gas_plat_get_time_us();
+    rec->count = 0U;
+    rec->res = write(ctx, header, sizeof(header));
+
+    return rec->res;
+}
+
+uint32_t xensiv_pas_gas_record_get_count(const xensiv_pas_gas_record_t *rec) {
+    xensiv_pas_gas_plat_assert(rec != NULL);
+
+    return rec->count;
+}
+
+int32_t xensiv_pas_gas_record_get_result(const xensiv_pas_gas_record_t *rec) {
+    xensiv_pas_gas_plat_assert(rec != NULL);
+
+    return rec->res;
+}
+
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+
+static size_t xensiv_pas_gas_record_put_uleb(uint8_t *buf, uint64_t val) {
+    size_t n = 0U;
+
+    do
+    {
+        uint8_t byte = (uint8_t)(val & 0x7FU);
+        val >>= 7U;
+        buf[n++] = (0U != val) ? (uint8_t)(byte | 0x80U) : byte;
+    } while (0U != val);
+
+    return n;
+}
+
+void xensiv_pas_gas_record_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_record_t *rec, uint16_t track) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    dev->record = rec;
+    dev->record_track = track;
+}
+
+void xensiv_pas_gas_record_access(const xensiv_pas_gas_t *dev, bool write, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t start_us, uint64_t end_us) {
+    xensiv_pas_gas_record_t *rec = dev->record;
+
+    if ((rec == NULL) || (XENSIV_PAS_GAS_OK != rec->res)) {
+        return;
+    }
+
+    uint8_t head[XENSIV_PAS_GAS_RECORD_MAX_HEAD_LEN];
+    size_t n = 0U;
+
+    head[n++] = write ? XENSIV_PAS_GAS_RECORD_FLAG_WRITE : 0U;
+    n += xensiv_pas_gas_record_put_uleb(&head[n], dev->record_track);
+    n += xensiv_pas_gas_record_put_uleb(&head[n], (start_us > rec->last_us) ? (start_us - rec->last_us) : 0U);
+    n += xensiv_pas_gas_record_put_uleb(&head[n], (end_us > start_us) ? (end_us - start_us) : 0U);
+    head[n++] = reg_addr;
+    head[n++] = len;
+    n += xensiv_pas_gas_record_put_uleb(&head[n], (res < 0) ? ((~(uint32_t)res << 1U) | 1U) : ((uint32_t)res << 1U));
+
+    if (start_us > rec->last_us) {
+        rec->last_us = start_us;
+    }
+
+    rec->res = rec->write(rec->ctx, head, n);
+    if ((XENSIV_PAS_GAS_OK == rec->res) && (len > 0U)) {
+        rec->res = rec->write(rec->ctx, data, len);
+    }
+    if (XENSIV_PAS_GAS_OK == rec->res) {
+        rec->count++;
+    }
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_TRACE */
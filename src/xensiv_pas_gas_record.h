@@ -0,0 +1,189 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_record.h
+ *
+ * Description: This file contains the bus recording of the XENSIV™ PAS GAS sensor driver, which
+ *              streams the register transfers with their data and timing to a compact binary file.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_RECORD_H_
+#define XENSIV_PAS_GAS_RECORD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_record XENSIV™ PAS GAS sensor bus recording
+ * \{
+ * Recording of the register transfers done through the device read and write functions, with their
+ * data, result and timing, to be replayed later by the platform of xensiv_pas_gas_replay.c.
+ *
+ * Unlike the bus trace, which keeps the last events in a ring, the recording streams each transfer to a
+ * user function as soon as it completed, e.g. to a file. It is only recorded if the library is built with
+ * XENSIV_PAS_GAS_ENABLE_TRACE set to 1; timestamps are taken with \ref xensiv_pas_gas_plat_get_time_us.
+ * \code
+ *  static int32_t write_to_file(void *ctx, const uint8_t *data, size_t len) {
+ *      return (fwrite(data, 1U, len, (FILE *)ctx) == len) ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_ERR_COMM;
+ *  }
+ *
+ *  xensiv_pas_gas_record_start(&rec, write_to_file, fp);
+ *  xensiv_pas_gas_record_attach(&dev0, &rec, 0U);
+ *  xensiv_pas_gas_record_attach(&dev1, &rec, 1U);
+ * \endcode
+ *
+ * Like the trace ring, a recording is not protected against concurrent access: the devices attached to
+ * it must only be accessed from one thread at a time, e.g. be on the same bus of \ref group_board_libs_exec.
+ *
+ * The recording starts with a header of \ref XENSIV_PAS_GAS_RECORD_HEADER_LEN bytes: the 4 characters
+ * "PASR", the format version \ref XENSIV_PAS_GAS_RECORD_VERSION and 11 reserved bytes. Each transfer
+ * follows as a record of, in order:
+ * - flags, 1 byte: bit 0 set for a register write
+ * - track of the device, unsigned LEB128
+ * - start time in microseconds since the start of the previous record, or of the recording for the first
+ *   record, unsigned LEB128
+ * - duration in microseconds, unsigned LEB128
+ * - start register address, 1 byte
+ * - number of registers, 1 byte
+ * - result, zigzag-encoded signed LEB128
+ * - register data, one byte per register; the data read for a read, the data written for a write
+ *
+ * A single-register read thus takes 9 bytes.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Length of the recording header */
+#define XENSIV_PAS_GAS_RECORD_HEADER_LEN         (16U)
+
+/** Format version of the recording */
+#define XENSIV_PAS_GAS_RECORD_VERSION            (1U)
+
+/** Flag of a record marking a register write */
+#define XENSIV_PAS_GAS_RECORD_FLAG_WRITE         (0x01U)
+
+/********************************* Type definitions **************************************/
+
+/**
+ * Function pointer used by the recording to output the recorded bytes
+ * @param[in] ctx User context
+ * @param[in] data Bytes to append to the recording
+ * @param[in] len Number of bytes
+ * @return XENSIV_PAS_GAS_OK if the bytes were written; an error otherwise, which stops the recording
+ */
+typedef int32_t (*xensiv_pas_gas_record_write_fptr_t)(void *ctx, const uint8_t *data, size_t len);
+
+/** Recording. Initialized using \ref xensiv_pas_gas_record_start. The members are private to the recording. */
+typedef struct xensiv_pas_gas_record_s
+{
+    xensiv_pas_gas_record_write_fptr_t write;   /*!< Output function */
+    void *ctx;                                  /*!< User context of write */
+    uint64_t last_us;                           /*!< Start time of the previous record */
+    uint32_t count;                             /*!< Number of records written */
+    int32_t res;                                /*!< First error returned by write */
+} xensiv_pas_gas_record_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts a recording and writes its header
+ *
+ * @param[out] rec Recording allocated by the user
+ * @param[in] write Function outputting the recorded bytes
+ * @param[in] ctx User context passed to write
+ * @return XENSIV_PAS_GAS_OK if the header was written; the error returned by write otherwise
+ */
+int32_t xensiv_pas_gas_record_start(xensiv_pas_gas_record_t *rec, xensiv_pas_gas_record_write_fptr_t write, void *ctx);
+
+/**
+ * @brief Gets the number of records written
+ *
+ * @param[in] rec Recording
+ * @return Number of records written
+ */
+uint32_t xensiv_pas_gas_record_get_count(const xensiv_pas_gas_record_t *rec);
+
+/**
+ * @brief Gets the state of the recording
+ *
+ * @param[in] rec Recording
+ * @return XENSIV_PAS_GAS_OK if all records were written; otherwise the first error returned by the output function,
+ * after which the recording stopped
+ */
+int32_t xensiv_pas_gas_record_get_result(const xensiv_pas_gas_record_t *rec);
+
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+
+/**
+ * @brief Attaches a recording to a sensor device.
+ * @note The sensor initialization functions detach the recording, attach it after the initialization
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] rec Recording; NULL to detach
+ * @param[in] track Track of the device in the recording
+ */
+void xensiv_pas_gas_record_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_record_t *rec, uint16_t track);
+
+/**
+ * @brief Records a register transfer into the recording of a device. Used by the driver core.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] write True for a register write
+ * @param[in] reg_addr Start register address
+ * @param[in] data Register data read or written
+ * @param[in] len Number of registers
+ * @param[in] res Result of the transfer
+ * @param[in] start_us Start timestamp
+ * @param[in] end_us End timestamp
+ */
+void xensiv_pas_gas_record_access(const xensiv_pas_gas_t *dev, bool write, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t start_us, uint64_t end_us);
+
+#else /* XENSIV_PAS_GAS_ENABLE_TRACE */
+
+static inline void xensiv_pas_gas_record_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_record_t *rec, uint16_t track) {
+    (void)dev;
+    (void)rec;
+    (void)track;
+}
+
+static inline void xensiv_pas_gas_record_access(const xensiv_pas_gas_t *dev, bool write, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t start_us, uint64_t end_us) {
+    (void)dev;
+    (void)write;
+    (void)reg_addr;
+    (void)data;
+    (void)len;
+    (void)res;
+    (void)start_us;
+    (void)end_us;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_record */
+
+#endif /* XENSIV_PAS_GAS_RECORD_H_ */
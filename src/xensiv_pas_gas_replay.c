@@ -0,0 +1,423 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_replay.c
+ *
+ * Description: Platform of the XENSIV™ PAS GAS sensor driver which replays a bus recording
+ *              instead of accessing sensors.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _DEFAULT_SOURCE
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#include "xensiv_pas_gas_replay.h"
+#include "xensiv_pas_gas_regs.h"
+
+#define XENSIV_PAS_GAS_REPLAY_US_PER_S           (1000000ULL)
+#define XENSIV_PAS_GAS_REPLAY_US_PER_MS          (1000ULL)
+#define XENSIV_PAS_GAS_REPLAY_NS_PER_US          (1000ULL)
+
+#define XENSIV_PAS_GAS_REPLAY_UART_ACK           (0x06U)
+#define XENSIV_PAS_GAS_REPLAY_UART_READ_CMD_LEN  (5U)
+#define XENSIV_PAS_GAS_REPLAY_UART_WRITE_CMD_LEN (8U)
+#define XENSIV_PAS_GAS_REPLAY_UART_READ_RESP_LEN (3U)
+#define XENSIV_PAS_GAS_REPLAY_UART_WRITE_RESP_LEN (2U)
+
+/* Longest unsigned LEB128 encoding of a 64-bit value */
+#define XENSIV_PAS_GAS_REPLAY_ULEB_MAX_LEN       (10U)
+
+/* Replay whose clock the platform time functions use, as they take no context */
+static __thread xensiv_pas_gas_replay_t *xensiv_pas_gas_replay_active = NULL;
+
+static const char xensiv_pas_gas_replay_hex[] = "0123456789ABCDEF";
+
+static uint64_t xensiv_pas_gas_replay_monotonic_us(void) {
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * XENSIV_PAS_GAS_REPLAY_US_PER_S) + ((uint64_t)ts.tv_nsec / XENSIV_PAS_GAS_REPLAY_NS_PER_US);
+}
+
+static uint64_t xensiv_pas_gas_replay_now_us(const xensiv_pas_gas_replay_t *replay) {
+    return replay->realtime ? (xensiv_pas_gas_replay_monotonic_us() - replay->clock_us) : replay->clock_us;
+}
+
+/* Passes the given time on the clock of the replay */
+static void xensiv_pas_gas_replay_wait_us(xensiv_pas_gas_replay_t *replay, uint64_t us) {
+    if (!replay->realtime) {
+        replay->clock_us += us;
+        return;
+    }
+
+    struct timespec ts = {
+        .tv_sec = (time_t)(us / XENSIV_PAS_GAS_REPLAY_US_PER_S),
+        .tv_nsec = (long)((us % XENSIV_PAS_GAS_REPLAY_US_PER_S) * XENSIV_PAS_GAS_REPLAY_NS_PER_US)
+    };
+
+    while ((0 != nanosleep(&ts, &ts)) && (EINTR == errno))
+    {
+    }
+}
+
+static bool xensiv_pas_gas_replay_get_uleb(const xensiv_pas_gas_replay_t *replay, size_t *pos, uint64_t *val) {
+    *val = 0U;
+
+    for (uint8_t i = 0U; (i < XENSIV_PAS_GAS_REPLAY_ULEB_MAX_LEN) && (*pos < replay->len); ++i)
+    {
+        uint8_t byte = replay->data[(*pos)++];
+        *val |= (uint64_t)(byte & 0x7FU) << (7U * i);
+        if (0U == (byte & 0x80U)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Decodes the record at pos, which starts after the record started at pos_us; false at the end of the recording */
+static bool xensiv_pas_gas_replay_decode(const xensiv_pas_gas_replay_t *replay, size_t pos, uint64_t pos_us, xensiv_pas_gas_replay_rec_t *rec) {
+    uint64_t track;
+    uint64_t delta_us;
+    uint64_t dur_us;
+    uint64_t res;
+
+    if (pos >= replay->len) {
+        return false;
+    }
+
+    rec->write = (0U != (replay->data[pos++] & XENSIV_PAS_GAS_RECORD_FLAG_WRITE));
+
+    if (!xensiv_pas_gas_replay_get_uleb(replay, &pos, &track) || !xensiv_pas_gas_replay_get_uleb(replay, &pos, &delta_us) ||
+        !xensiv_pas_gas_replay_get_uleb(replay, &pos, &dur_us) || ((pos + 2U) > replay->len)) {
+        return false;
+    }
+
+    rec->reg_addr = replay->data[pos++];
+    rec->len = replay->data[pos++];
+
+    if (!xensiv_pas_gas_replay_get_uleb(replay, &pos, &res) || ((pos + rec->len) > replay->len)) {
+        return false;
+    }
+
+    rec->track = (uint16_t)track;
+    rec->start_us = pos_us + delta_us;
+    rec->dur_us = (dur_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)dur_us;
+    rec->res = (0U != (res & 1U)) ? (int32_t)~(uint32_t)(res >> 1U) : (int32_t)(uint32_t)(res >> 1U);
+    rec->data = &replay->data[pos];
+    rec->next_pos = pos + rec->len;
+
+    return true;
+}
+
+/* Decodes the next record of the track from pos on and moves pos past it */
+static bool xensiv_pas_gas_replay_next(const xensiv_pas_gas_replay_t *replay, size_t *pos, uint64_t *pos_us, xensiv_pas_gas_replay_rec_t *rec) {
+    while (xensiv_pas_gas_replay_decode(replay, *pos, *pos_us, rec))
+    {
+        *pos = rec->next_pos;
+        *pos_us = rec->start_us;
+        if (rec->track == replay->track) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void xensiv_pas_gas_replay_store(xensiv_pas_gas_replay_t *replay, uint8_t reg_addr, const uint8_t *data, uint8_t len) {
+    for (uint8_t i = 0U; i < len; ++i)
+    {
+        replay->regs[(uint8_t)(reg_addr + i)] = data[i];
+    }
+}
+
+/* Consumes the next record of the track, keeping the register values it carries */
+static void xensiv_pas_gas_replay_consume(xensiv_pas_gas_replay_t *replay, xensiv_pas_gas_replay_rec_t *rec) {
+    (void)xensiv_pas_gas_replay_next(replay, &replay->pos, &replay->pos_us, rec);
+
+    if (XENSIV_PAS_GAS_OK == rec->res) {
+        xensiv_pas_gas_replay_store(replay, rec->reg_addr, rec->data, rec->len);
+    }
+}
+
+/* Absolute difference of two times */
+static uint64_t xensiv_pas_gas_replay_distance(uint64_t a, uint64_t b) {
+    return (a > b) ? (a - b) : (b - a);
+}
+
+/* Answers a register transfer; a single-register UART access may match the first register of a longer record */
+static int32_t xensiv_pas_gas_replay_transfer(xensiv_pas_gas_replay_t *replay, bool write, uint8_t reg_addr, uint8_t *data, uint8_t len, bool uart) {
+    xensiv_pas_gas_replay_rec_t rec;
+    size_t pos = replay->pos;
+    uint64_t pos_us = replay->pos_us;
+    uint64_t now_us = xensiv_pas_gas_replay_now_us(replay);
+    uint64_t expected_us = replay->sync_rec_us + (now_us - replay->sync_clock_us);
+    uint8_t best = UINT8_MAX;
+    uint64_t best_us = 0U;
+
+    replay->part_off = 0U;
+
+    /* Among the matching records, take the one closest to the time elapsed since the previous match */
+    for (uint8_t i = 0U; (i <= XENSIV_PAS_GAS_REPLAY_LOOKAHEAD) && xensiv_pas_gas_replay_next(replay, &pos, &pos_us, &rec); ++i)
+    {
+        if ((rec.write != write) || (rec.reg_addr != reg_addr) || (uart ? (0U == rec.len) : (rec.len != len))) {
+            continue;
+        }
+
+        if ((UINT8_MAX == best) ||
+            (replay->synced && (xensiv_pas_gas_replay_distance(rec.start_us, expected_us) < xensiv_pas_gas_replay_distance(best_us, expected_us)))) {
+            best = i;
+            best_us = rec.start_us;
+        }
+    }
+
+    if (UINT8_MAX != best) {
+        for (uint8_t i = 0U; i <= best; ++i)
+        {
+            xensiv_pas_gas_replay_consume(replay, &rec);
+        }
+        replay->stats.skipped += best;
+        replay->stats.matched++;
+        replay->synced = true;
+        replay->sync_rec_us = rec.start_us;
+        replay->sync_clock_us = now_us;
+
+        xensiv_pas_gas_replay_wait_us(replay, rec.dur_us);
+
+        if (XENSIV_PAS_GAS_OK != rec.res) {
+            return rec.res;
+        }
+
+        if (write) {
+            xensiv_pas_gas_replay_store(replay, reg_addr, data, len);
+        } else {
+            (void)memcpy(data, rec.data, len);
+        }
+
+        if (uart && (rec.len > 1U)) {
+            replay->part = rec;
+            replay->part_off = 1U;
+        }
+
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    /* Diverged, the recording stays at its position */
+    replay->stats.diverged++;
+    if (write) {
+        xensiv_pas_gas_replay_store(replay, reg_addr, data, len);
+    } else {
+        for (uint8_t i = 0U; i < len; ++i)
+        {
+            data[i] = replay->regs[(uint8_t)(reg_addr + i)];
+        }
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+/* Answers a single-register UART access, continuing a record consumed in parts if it is the next register */
+static int32_t xensiv_pas_gas_replay_uart_access(xensiv_pas_gas_replay_t *replay, bool write, uint8_t reg_addr, uint8_t *val) {
+    xensiv_pas_gas_replay_rec_t *part = &replay->part;
+
+    if ((replay->part_off > 0U) && (part->write == write) && ((uint8_t)(part->reg_addr + replay->part_off) == reg_addr)) {
+        if (write) {
+            replay->regs[reg_addr] = *val;
+        } else {
+            *val = part->data[replay->part_off];
+        }
+
+        replay->part_off++;
+        if (replay->part_off >= part->len) {
+            replay->part_off = 0U;
+        }
+
+        return XENSIV_PAS_GAS_OK;
+    }
+
+    return xensiv_pas_gas_replay_transfer(replay, write, reg_addr, val, 1U, true);
+}
+
+static uint8_t xensiv_pas_gas_replay_from_hex(uint8_t hi, uint8_t lo) {
+    const char *h = strchr(xensiv_pas_gas_replay_hex, hi);
+    const char *l = strchr(xensiv_pas_gas_replay_hex, lo);
+
+    return (uint8_t)((((h != NULL) ? (h - xensiv_pas_gas_replay_hex) : 0) << 4) | ((l != NULL) ? (l - xensiv_pas_gas_replay_hex) : 0));
+}
+
+int32_t xensiv_pas_gas_replay_init(xensiv_pas_gas_replay_t *replay, const uint8_t *data, size_t len, uint16_t track) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+    xensiv_pas_gas_plat_assert((data != NULL) || (len == 0U));
+
+    if ((len < XENSIV_PAS_GAS_RECORD_HEADER_LEN) || (0 != memcmp(data, "PASR", 4U)) || (XENSIV_PAS_GAS_RECORD_VERSION != data[4])) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    (void)memset(replay, 0, sizeof(*replay));
+    replay->data = data;
+    replay->len = len;
+    replay->pos = XENSIV_PAS_GAS_RECORD_HEADER_LEN;
+    replay->track = track;
+    xensiv_pas_gas_replay_active = replay;
+
+    /* The recorded sensor was running; diverged reads of a register not accessed yet return its first recorded value */
+    replay->regs[XENSIV_PAS_GAS_REG_SENS_STS] = XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK;
+    uint8_t seen[XENSIV_PAS_GAS_REPLAY_REG_MAP_SIZE / 8U] = { 0U };
+    xensiv_pas_gas_replay_rec_t rec;
+    size_t pos = replay->pos;
+    uint64_t pos_us = 0U;
+
+    while (xensiv_pas_gas_replay_next(replay, &pos, &pos_us, &rec))
+    {
+        for (uint8_t i = 0U; (XENSIV_PAS_GAS_OK == rec.res) && (i < rec.len); ++i)
+        {
+            uint8_t reg = (uint8_t)(rec.reg_addr + i);
+            if (0U == (seen[reg / 8U] & (1U << (reg % 8U)))) {
+                seen[reg / 8U] |= (uint8_t)(1U << (reg % 8U));
+                replay->regs[reg] = rec.data[i];
+            }
+        }
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_replay_set_realtime(xensiv_pas_gas_replay_t *replay, bool realtime) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+
+    replay->realtime = realtime;
+    replay->clock_us = realtime ? xensiv_pas_gas_replay_monotonic_us() : 0U;
+}
+
+uint64_t xensiv_pas_gas_replay_get_time_us(const xensiv_pas_gas_replay_t *replay) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+
+    return xensiv_pas_gas_replay_now_us(replay);
+}
+
+uint64_t xensiv_pas_gas_replay_get_next_us(const xensiv_pas_gas_replay_t *replay) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+
+    xensiv_pas_gas_replay_rec_t rec;
+    size_t pos = replay->pos;
+    uint64_t pos_us = replay->pos_us;
+
+    return xensiv_pas_gas_replay_next(replay, &pos, &pos_us, &rec) ? rec.start_us : UINT64_MAX;
+}
+
+bool xensiv_pas_gas_replay_is_done(const xensiv_pas_gas_replay_t *replay) {
+    return (UINT64_MAX == xensiv_pas_gas_replay_get_next_us(replay));
+}
+
+void xensiv_pas_gas_replay_get_stats(const xensiv_pas_gas_replay_t *replay, xensiv_pas_gas_replay_stats_t *stats) {
+    xensiv_pas_gas_plat_assert(replay != NULL);
+    xensiv_pas_gas_plat_assert(stats != NULL);
+
+    *stats = replay->stats;
+}
+
+int32_t xensiv_pas_gas_plat_i2c_transfer(void *ctx, uint16_t dev_addr, const uint8_t *tx_buffer, size_t tx_len, uint8_t *rx_buffer, size_t rx_len) {
+    xensiv_pas_gas_replay_t *replay = (xensiv_pas_gas_replay_t *)ctx;
+    xensiv_pas_gas_replay_active = replay;
+    (void)dev_addr;
+
+    if (0U == tx_len) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    if (NULL != rx_buffer) {
+        return xensiv_pas_gas_replay_transfer(replay, false, tx_buffer[0], rx_buffer, (uint8_t)rx_len, false);
+    }
+
+    return xensiv_pas_gas_replay_transfer(replay, true, tx_buffer[0], (uint8_t *)&tx_buffer[1], (uint8_t)(tx_len - 1U), false);
+}
+
+int32_t xensiv_pas_gas_plat_uart_write(void *ctx, uint8_t *data, size_t len) {
+    xensiv_pas_gas_replay_t *replay = (xensiv_pas_gas_replay_t *)ctx;
+    xensiv_pas_gas_replay_active = replay;
+
+    if ((len >= XENSIV_PAS_GAS_REPLAY_UART_WRITE_CMD_LEN) && ((uint8_t)'w' == data[0])) {
+        replay->uart_write = true;
+        replay->uart_val = xensiv_pas_gas_replay_from_hex(data[5], data[6]);
+    } else if ((len >= XENSIV_PAS_GAS_REPLAY_UART_READ_CMD_LEN) && ((uint8_t)'r' == data[0])) {
+        replay->uart_write = false;
+    } else {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+    replay->uart_reg = xensiv_pas_gas_replay_from_hex(data[2], data[3]);
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_plat_uart_read(void *ctx, uint8_t *data, size_t len) {
+    xensiv_pas_gas_replay_t *replay = (xensiv_pas_gas_replay_t *)ctx;
+    xensiv_pas_gas_replay_active = replay;
+    uint8_t val = replay->uart_val;
+    int32_t res = xensiv_pas_gas_replay_uart_access(replay, replay->uart_write, replay->uart_reg, &val);
+
+    if (XENSIV_PAS_GAS_OK != res) {
+        return res;
+    }
+
+    if (replay->uart_write) {
+        xensiv_pas_gas_plat_assert(len >= XENSIV_PAS_GAS_REPLAY_UART_WRITE_RESP_LEN);
+        data[0] = XENSIV_PAS_GAS_REPLAY_UART_ACK;
+        data[1] = (uint8_t)'\n';
+    } else {
+        xensiv_pas_gas_plat_assert(len >= XENSIV_PAS_GAS_REPLAY_UART_READ_RESP_LEN);
+        data[0] = (uint8_t)xensiv_pas_gas_replay_hex[val >> 4U];
+        data[1] = (uint8_t)xensiv_pas_gas_replay_hex[val & 0x0FU];
+        data[2] = (uint8_t)'\n';
+    }
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_plat_delay(uint32_t ms) {
+    if (NULL != xensiv_pas_gas_replay_active) {
+        xensiv_pas_gas_replay_wait_us(xensiv_pas_gas_replay_active, (uint64_t)ms * XENSIV_PAS_GAS_REPLAY_US_PER_MS);
+    }
+}
+
+uint16_t xensiv_pas_gas_plat_htons(uint16_t x) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return x;
+#else
+    return (uint16_t)(((x & 0x00ffU) << 8) | ((x & 0xff00U) >> 8));
+#endif
+}
+
+void xensiv_pas_gas_plat_assert(int expr) {
+    assert(expr);
+    (void)expr;
+}
+
+uint64_t xensiv_pas_gas_plat_get_time_us(void) {
+    return (NULL != xensiv_pas_gas_replay_active) ? xensiv_pas_gas_replay_now_us(xensiv_pas_gas_replay_active) : 0U;
+}
+
+int32_t xensiv_pas_gas_plat_pwm_capture(void *ctx, xensiv_pas_gas_pwm_edge_t *edges, size_t max_edges, size_t *count) {
+    (void)ctx;
+    (void)edges;
+    (void)max_edges;
+    *count = 0U;
+    return XENSIV_PAS_GAS_OK;
+}
@@ -0,0 +1,198 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_replay.h
+ *
+ * Description: Platform of the XENSIV™ PAS GAS sensor driver which replays a bus recording
+ *              instead of accessing sensors.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_REPLAY_H_
+#define XENSIV_PAS_GAS_REPLAY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_record.h"
+
+/**
+ * \addtogroup group_board_libs_replay XENSIV™ PAS GAS sensor bus replay
+ * \{
+ * Implementation of \ref group_board_libs_platform which answers the register transfers of the driver
+ * with the responses of a recording made with \ref group_board_libs_record.
+ *
+ * The ctx passed to the driver init functions must point to a \ref xensiv_pas_gas_replay_t,
+ * which replays the records of one track of the recording, for both the I2C and the UART interface; a
+ * recording of an I2C bus can thus be replayed over UART and vice versa. The recording is read from memory,
+ * e.g. a file loaded or mapped by the application, and is kept until the replay is done.
+ *
+ * Each register transfer of the driver consumes the next record of the track if it accesses the same
+ * registers in the same direction: a read returns the recorded data, and both return the recorded result.
+ * A transfer which does not match the next record, e.g. after a change of the driver, is matched against
+ * the following \ref XENSIV_PAS_GAS_REPLAY_LOOKAHEAD records, the records before the match being skipped.
+ * Of several matching records, the one whose recorded time is closest to the time elapsed since the
+ * previous match is taken, so that a transfer the driver no longer issues is skipped rather than answered
+ * with the response of the next one.
+ * Without a match the transfer diverged: a read returns the last register values of the recording and of
+ * the diverged writes, or the first recorded values of the registers not accessed yet, and the recording
+ * stays at its position. The initialization of the replayed device, which precedes the recording, thus
+ * diverges but succeeds. The replay is deterministic: the same
+ * recording and the same driver calls give the same results.
+ *
+ * Each replay has its own clock, in one of two modes selected with \ref xensiv_pas_gas_replay_set_realtime:
+ * - virtual (default): each transfer advances the clock by its recorded duration and \ref
+ *   xensiv_pas_gas_plat_delay advances it by the delay, without waiting. The replay runs as fast as possible.
+ * - real time: each transfer waits for its recorded duration and \ref xensiv_pas_gas_plat_delay sleeps.
+ *
+ * \ref xensiv_pas_gas_plat_delay and \ref xensiv_pas_gas_plat_get_time_us take no context: they use the
+ * clock of the replay last initialized or accessed by the driver on the calling thread. Several replays
+ * thus run in one process, each on its own thread or one after another on the same thread; a replay is not
+ * protected against concurrent access and must only be used by one thread at a time.
+ *
+ * The clock counts from the start of the replay, like the record times from the start of the recording,
+ * so that the application can issue its accesses at the recorded times:
+ * \code
+ *  xensiv_pas_gas_replay_init(&replay, data, len, 0U);
+ *  xensiv_pas_gas_co2_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &replay);
+ *  while (!xensiv_pas_gas_replay_is_done(&replay)) {
+ *      uint64_t next_us = xensiv_pas_gas_replay_get_next_us(&replay);
+ *      ...                                             // Wait until next_us and call the driver
+ *  }
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Number of records searched for a transfer which does not match the next record */
+#define XENSIV_PAS_GAS_REPLAY_LOOKAHEAD          (8U)
+
+/** Number of registers kept for the diverged reads */
+#define XENSIV_PAS_GAS_REPLAY_REG_MAP_SIZE       (256U)
+
+/********************************* Type definitions **************************************/
+
+/** Counters of a replay */
+typedef struct
+{
+    uint32_t matched;                   /*!< Transfers answered by their record */
+    uint32_t skipped;                   /*!< Records skipped to match a later transfer */
+    uint32_t diverged;                  /*!< Transfers without a matching record */
+} xensiv_pas_gas_replay_stats_t;
+
+/** Decoded record. The members are private to the replay. */
+typedef struct
+{
+    size_t next_pos;                    /*!< Position of the following record */
+    uint64_t start_us;                  /*!< Start time since the start of the recording */
+    uint32_t dur_us;                    /*!< Duration */
+    int32_t res;                        /*!< Result */
+    uint16_t track;                     /*!< Track */
+    bool write;                         /*!< The record is a register write */
+    uint8_t reg_addr;                   /*!< Start register address */
+    uint8_t len;                        /*!< Number of registers */
+    const uint8_t *data;                /*!< Register data */
+} xensiv_pas_gas_replay_rec_t;
+
+/** Replay of one track of a recording. The members are private to the replay. */
+typedef struct
+{
+    const uint8_t *data;                /*!< Recording */
+    size_t len;                         /*!< Length of the recording */
+    size_t pos;                         /*!< Position of the next record */
+    uint64_t pos_us;                    /*!< Start time of the record before pos */
+    uint16_t track;                     /*!< Replayed track */
+    xensiv_pas_gas_replay_rec_t part;   /*!< Record consumed in parts by single-register UART accesses */
+    uint8_t part_off;                   /*!< Number of registers of part consumed; 0 if none is in progress */
+    bool uart_write;                    /*!< The pending UART command is a register write */
+    uint8_t uart_reg;                   /*!< Register of the pending UART command */
+    uint8_t uart_val;                   /*!< Value of the pending UART write */
+    bool synced;                        /*!< A transfer matched a record */
+    uint64_t sync_rec_us;               /*!< Recorded start time of the last matched record */
+    uint64_t sync_clock_us;             /*!< Time of the transfer which matched it */
+    bool realtime;                      /*!< The clock waits for the recorded durations and delays */
+    uint64_t clock_us;                  /*!< Virtual clock, or start of the real-time replay */
+    uint8_t regs[XENSIV_PAS_GAS_REPLAY_REG_MAP_SIZE];  /*!< Last register values */
+    xensiv_pas_gas_replay_stats_t stats;    /*!< Counters */
+} xensiv_pas_gas_replay_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the replay of one track of a recording
+ *
+ * @param[out] replay Replay allocated by the user
+ * @param[in] data Recording, kept until the replay is done
+ * @param[in] len Length of the recording
+ * @param[in] track Track to replay, as passed to \ref xensiv_pas_gas_record_attach
+ * @return XENSIV_PAS_GAS_OK if the replay was initialized; XENSIV_PAS_GAS_INVALID_PARAMETER if data is not a recording
+ * of a supported format version
+ */
+int32_t xensiv_pas_gas_replay_init(xensiv_pas_gas_replay_t *replay, const uint8_t *data, size_t len, uint16_t track);
+
+/**
+ * @brief Selects the clock of a replay and restarts it at 0
+ *
+ * @param[in] replay Replay
+ * @param[in] realtime True to wait for the recorded durations and delays; false for the virtual clock
+ */
+void xensiv_pas_gas_replay_set_realtime(xensiv_pas_gas_replay_t *replay, bool realtime);
+
+/**
+ * @brief Gets the time on the clock of a replay
+ *
+ * @param[in] replay Replay
+ * @return Time in microseconds since the start of the replay
+ */
+uint64_t xensiv_pas_gas_replay_get_time_us(const xensiv_pas_gas_replay_t *replay);
+
+/**
+ * @brief Gets the recorded start time of the next record of the track
+ *
+ * @param[in] replay Replay
+ * @return Time in microseconds since the start of the recording; UINT64_MAX if all records were replayed
+ */
+uint64_t xensiv_pas_gas_replay_get_next_us(const xensiv_pas_gas_replay_t *replay);
+
+/**
+ * @brief Checks whether all records of the track were replayed
+ *
+ * @param[in] replay Replay
+ * @return True if no record is left; a truncated last record counts as the end of the recording
+ */
+bool xensiv_pas_gas_replay_is_done(const xensiv_pas_gas_replay_t *replay);
+
+/**
+ * @brief Gets the counters of a replay
+ *
+ * @param[in] replay Replay
+ * @param[out] stats Pointer to populate with the counters
+ */
+void xensiv_pas_gas_replay_get_stats(const xensiv_pas_gas_replay_t *replay, xensiv_pas_gas_replay_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_replay */
+
+#endif /* XENSIV_PAS_GAS_REPLAY_H_ */
@@ -0,0 +1,274 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_shm.c
+ *
+ * Description: This file contains the shared-memory sample broadcast of the XENSIV™ PAS GAS
+ *              sensor driver, from one acquisition process to many reader processes.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "xensiv_pas_gas_shm.h"
+
+/* Record slot; seq is the record number plus one once the record is complete, 0 while it is written */
+typedef struct
+{
+    uint64_t seq;
+    xensiv_pas_gas_shm_sample_t sample;
+} xensiv_pas_gas_shm_slot_t;
+
+/* Layout of the shared memory; magic is written last, once the ring is initialized */
+struct xensiv_pas_gas_shm_ring_s
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t slot_size;
+    uint32_t capacity;
+    uint32_t reserved;
+    uint64_t head;                      /* Number of records published */
+    uint8_t pad[40];                    /* Keeps head apart from the first slots written */
+    xensiv_pas_gas_shm_slot_t slots[];
+};
+
+static size_t xensiv_pas_gas_shm_size(uint32_t capacity) {
+    return sizeof(struct xensiv_pas_gas_shm_ring_s) + ((size_t)capacity * sizeof(xensiv_pas_gas_shm_slot_t));
+}
+
+/* Moves the cursor to the oldest record the writer is not overwriting */
+static int32_t xensiv_pas_gas_shm_resync(xensiv_pas_gas_shm_reader_t *reader, uint64_t head) {
+    uint64_t oldest = head + 1U - reader->ring->capacity;
+
+    reader->lost += oldest - reader->cursor;
+    reader->cursor = oldest;
+
+    return XENSIV_PAS_GAS_OVERRUN;
+}
+
+int32_t xensiv_pas_gas_shm_create(xensiv_pas_gas_shm_t *shm, const char *name, uint32_t capacity, bool replace) {
+    xensiv_pas_gas_plat_assert(shm != NULL);
+    xensiv_pas_gas_plat_assert(name != NULL);
+
+    shm->ring = NULL;
+
+    if ((strlen(name) >= sizeof(shm->name)) || (0U == capacity) || (0U != (capacity & (capacity - 1U)))) {
+        return XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    (void)strcpy(shm->name, name);
+    shm->size = xensiv_pas_gas_shm_size(capacity);
+    shm->head = 0U;
+
+    if (replace) {
+        (void)shm_unlink(name);
+    }
+
+    /* Never maps the ring of another writer */
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        return (EEXIST == errno) ? XENSIV_PAS_GAS_INVALID_PARAMETER : XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    void *addr = MAP_FAILED;
+    if (0 == ftruncate(fd, (off_t)shm->size)) {
+        addr = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+
+    if (MAP_FAILED == addr) {
+        (void)shm_unlink(name);
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+
+    /* The new object is zero-filled, i.e. all slots are empty */
+    shm->ring = (struct xensiv_pas_gas_shm_ring_s *)addr;
+    shm->ring->version = XENSIV_PAS_GAS_SHM_VERSION;
+    shm->ring->slot_size = (uint16_t)sizeof(xensiv_pas_gas_shm_slot_t);
+    shm->ring->capacity = capacity;
+    __atomic_store_n(&shm->ring->magic, XENSIV_PAS_GAS_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+void xensiv_pas_gas_shm_destroy(xensiv_pas_gas_shm_t *shm) {
+    xensiv_pas_gas_plat_assert(shm != NULL);
+
+    if (NULL != shm->ring) {
+        (void)munmap(shm->ring, shm->size);
+        (void)shm_unlink(shm->name);
+        shm->ring = NULL;
+    }
+}
+
+void xensiv_pas_gas_shm_publish(xensiv_pas_gas_shm_t *shm, const xensiv_pas_gas_shm_sample_t *sample) {
+    xensiv_pas_gas_plat_assert(shm != NULL);
+    xensiv_pas_gas_plat_assert(shm->ring != NULL);
+    xensiv_pas_gas_plat_assert(sample != NULL);
+
+    xensiv_pas_gas_shm_slot_t *slot = &shm->ring->slots[shm->head & (shm->ring->capacity - 1U)];
+
+    /* A reader which copies the slot meanwhile finds seq changed afterwards */
+    __atomic_store_n(&slot->seq, 0U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->sample = *sample;
+    __atomic_store_n(&slot->seq, shm->head + 1U, __ATOMIC_RELEASE);
+
+    shm->head++;
+    __atomic_store_n(&shm->ring->head, shm->head, __ATOMIC_RELEASE);
+}
+
+int32_t xensiv_pas_gas_shm_acquire(xensiv_pas_gas_shm_t *shm, const xensiv_pas_gas_t *dev, uint16_t sensor) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    xensiv_pas_gas_shm_sample_t sample = { .sensor = sensor, .val = 0U };
+    int32_t res = xensiv_pas_gas_get_result(dev, &sample.val);
+
+    if (XENSIV_PAS_GAS_READ_NRDY != res) {
+        sample.time_us = xensiv_pas_gas_plat_get_time_us();
+        sample.res = res;
+        xensiv_pas_gas_shm_publish(shm, &sample);
+    }
+
+    return res;
+}
+
+int32_t xensiv_pas_gas_shm_open(xensiv_pas_gas_shm_reader_t *reader, const char *name) {
+    xensiv_pas_gas_plat_assert(reader != NULL);
+    xensiv_pas_gas_plat_assert(name != NULL);
+
+    reader->ring = NULL;
+    reader->lost = 0U;
+
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return XENSIV_PAS_GAS_ERR_NOT_READY;
+    }
+
+    struct stat st;
+    void *addr = MAP_FAILED;
+    if ((0 == fstat(fd, &st)) && ((size_t)st.st_size >= sizeof(struct xensiv_pas_gas_shm_ring_s))) {
+        reader->size = (size_t)st.st_size;
+        addr = mmap(NULL, reader->size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+
+    if (MAP_FAILED == addr) {
+        return XENSIV_PAS_GAS_ERR_NOT_READY;
+    }
+
+    const struct xensiv_pas_gas_shm_ring_s *ring = (const struct xensiv_pas_gas_shm_ring_s *)addr;
+    int32_t res = XENSIV_PAS_GAS_OK;
+
+    if (XENSIV_PAS_GAS_SHM_MAGIC != __atomic_load_n(&ring->magic, __ATOMIC_ACQUIRE)) {
+        res = XENSIV_PAS_GAS_ERR_NOT_READY;
+    } else if ((XENSIV_PAS_GAS_SHM_VERSION != ring->version) || (sizeof(xensiv_pas_gas_shm_slot_t) != ring->slot_size) ||
+               (reader->size < xensiv_pas_gas_shm_size(ring->capacity))) {
+        res = XENSIV_PAS_GAS_INVALID_PARAMETER;
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        reader->ring = ring;
+        reader->cursor = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    } else {
+        (void)munmap(addr, reader->size);
+    }
+
+    return res;
+}
+
+void xensiv_pas_gas_shm_close(xensiv_pas_gas_shm_reader_t *reader) {
+    xensiv_pas_gas_plat_assert(reader != NULL);
+
+    if (NULL != reader->ring) {
+        (void)munmap((void *)reader->ring, reader->size);
+        reader->ring = NULL;
+    }
+}
+
+int32_t xensiv_pas_gas_shm_peek(xensiv_pas_gas_shm_reader_t *reader, const xensiv_pas_gas_shm_sample_t **sample) {
+    xensiv_pas_gas_plat_assert(reader != NULL);
+    xensiv_pas_gas_plat_assert(reader->ring != NULL);
+    xensiv_pas_gas_plat_assert(sample != NULL);
+
+    const struct xensiv_pas_gas_shm_ring_s *ring = reader->ring;
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (head == reader->cursor) {
+        return XENSIV_PAS_GAS_READ_NRDY;
+    }
+
+    /* The slot of the record head - capacity may be in the middle of being overwritten */
+    if ((head - reader->cursor) >= ring->capacity) {
+        return xensiv_pas_gas_shm_resync(reader, head);
+    }
+
+    const xensiv_pas_gas_shm_slot_t *slot = &ring->slots[reader->cursor & (ring->capacity - 1U)];
+    if ((reader->cursor + 1U) != __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE)) {
+        /* Overwritten since head was read */
+        return xensiv_pas_gas_shm_resync(reader, __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE));
+    }
+
+    *sample = &slot->sample;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+int32_t xensiv_pas_gas_shm_release(xensiv_pas_gas_shm_reader_t *reader) {
+    xensiv_pas_gas_plat_assert(reader != NULL);
+    xensiv_pas_gas_plat_assert(reader->ring != NULL);
+
+    const xensiv_pas_gas_shm_slot_t *slot = &reader->ring->slots[reader->cursor & (reader->ring->capacity - 1U)];
+
+    /* The accesses to the record are completed before seq is checked again */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    bool intact = ((reader->cursor + 1U) == __atomic_load_n(&slot->seq, __ATOMIC_RELAXED));
+
+    reader->cursor++;
+    if (!intact) {
+        reader->lost++;
+    }
+
+    return intact ? XENSIV_PAS_GAS_OK : XENSIV_PAS_GAS_OVERRUN;
+}
+
+int32_t xensiv_pas_gas_shm_read(xensiv_pas_gas_shm_reader_t *reader, xensiv_pas_gas_shm_sample_t *sample) {
+    xensiv_pas_gas_plat_assert(sample != NULL);
+
+    const xensiv_pas_gas_shm_sample_t *rec;
+    int32_t res = xensiv_pas_gas_shm_peek(reader, &rec);
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        *sample = *rec;
+        res = xensiv_pas_gas_shm_release(reader);
+    }
+
+    return res;
+}
+
+uint64_t xensiv_pas_gas_shm_get_lost(const xensiv_pas_gas_shm_reader_t *reader) {
+    xensiv_pas_gas_plat_assert(reader != NULL);
+
+    return reader->lost;
+}
@@ -0,0 +1,214 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_shm.h
+ *
+ * Description: This file contains the shared-memory sample broadcast of the XENSIV™ PAS GAS
+ *              sensor driver, from one acquisition process to many reader processes.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_SHM_H_
+#define XENSIV_PAS_GAS_SHM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_shm XENSIV™ PAS GAS sensor shared-memory sample broadcast
+ * \{
+ * Ring of sample records in POSIX shared memory, written by the single process which owns the sensor
+ * buses and read by any number of other processes, which thus never access the bus.
+ *
+ * The writer overwrites the oldest record once the ring is full and never waits for the readers. Each
+ * reader keeps its own cursor in its own memory and maps the ring read-only. A record is read in place:
+ * \ref xensiv_pas_gas_shm_peek returns a pointer into the shared memory and \ref xensiv_pas_gas_shm_release
+ * checks that the writer did not overwrite the record meanwhile. A reader which falls more than the
+ * capacity behind resumes at the oldest record and counts the skipped records as lost:
+ * \code
+ *  // Acquisition process
+ *  xensiv_pas_gas_shm_create(&shm, "/pas_gas", 1024U, false);
+ *  xensiv_pas_gas_shm_acquire(&shm, &dev, sensor_index);   // e.g. on the DRDY interrupt
+ *
+ *  // Reader processes
+ *  xensiv_pas_gas_shm_open(&reader, "/pas_gas");
+ *  while (XENSIV_PAS_GAS_OK == (res = xensiv_pas_gas_shm_peek(&reader, &sample))) {
+ *      ...                                             // Use *sample
+ *      if (XENSIV_PAS_GAS_OK != xensiv_pas_gas_shm_release(&reader)) {
+ *          ...                                         // *sample was overwritten while in use, discard it
+ *      }
+ *  }
+ * \endcode
+ *
+ * Each record is protected by a sequence number written before and after the record, so the writer
+ * publishes a record with two atomic stores and without any lock a stalled reader could hold. The readers
+ * are not notified; they poll at the measurement rate or are woken through another channel.
+ */
+
+/************************************** Macros *******************************************/
+
+/** Identifier at the start of the shared-memory ring */
+#define XENSIV_PAS_GAS_SHM_MAGIC                 (0x50415347UL)
+
+/** Layout version of the shared-memory ring */
+#define XENSIV_PAS_GAS_SHM_VERSION               (1U)
+
+/********************************* Type definitions **************************************/
+
+/** Sample record broadcast to the readers */
+typedef struct
+{
+    uint64_t time_us;                       /*!< Time of the acquisition, see \ref xensiv_pas_gas_plat_get_time_us */
+    uint16_t sensor;                        /*!< Index of the sensor, assigned by the acquisition process */
+    uint16_t val;                           /*!< Gas concentration; only valid if res is XENSIV_PAS_GAS_OK */
+    int32_t res;                            /*!< Result of the acquisition */
+} xensiv_pas_gas_shm_sample_t;
+
+struct xensiv_pas_gas_shm_ring_s;       /* Forward declaration, layout of the shared memory */
+
+/** Writer of the sample broadcast. The members are private to the broadcast. */
+typedef struct
+{
+    struct xensiv_pas_gas_shm_ring_s *ring; /*!< Mapped ring */
+    size_t size;                            /*!< Size of the mapping */
+    uint64_t head;                          /*!< Number of records published */
+    char name[64];                          /*!< Name of the shared-memory object */
+} xensiv_pas_gas_shm_t;
+
+/** Reader of the sample broadcast. The members are private to the broadcast. */
+typedef struct
+{
+    const struct xensiv_pas_gas_shm_ring_s *ring;   /*!< Mapped ring */
+    size_t size;                            /*!< Size of the mapping */
+    uint64_t cursor;                        /*!< Number of the next record to read */
+    uint64_t lost;                          /*!< Number of records overwritten before they were read */
+} xensiv_pas_gas_shm_reader_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates the shared-memory ring and maps it for writing.
+ * An existing object of the same name is only removed if replace is set, e.g. the ring left by a writer
+ * which did not destroy it; readers which still map that object must open the ring again.
+ *
+ * @param[out] shm Writer allocated by the user
+ * @param[in] name Name of the shared-memory object, starting with '/', at most 63 characters
+ * @param[in] capacity Number of records of the ring, a power of two
+ * @param[in] replace Remove an existing object of the same name instead of failing
+ * @return XENSIV_PAS_GAS_OK if the ring was created; XENSIV_PAS_GAS_INVALID_PARAMETER if the name is too long,
+ * capacity is not a power of two or, without replace, the object already exists; XENSIV_PAS_GAS_ERR_COMM if the
+ * shared memory could not be created
+ */
+int32_t xensiv_pas_gas_shm_create(xensiv_pas_gas_shm_t *shm, const char *name, uint32_t capacity, bool replace);
+
+/**
+ * @brief Unmaps and removes the shared-memory ring.
+ * Readers keep their mapping until they close it, but receive no further records.
+ *
+ * @param[in] shm Writer
+ */
+void xensiv_pas_gas_shm_destroy(xensiv_pas_gas_shm_t *shm);
+
+/**
+ * @brief Publishes a sample record, overwriting the oldest one if the ring is full
+ *
+ * @param[in] shm Writer
+ * @param[in] sample Sample record
+ */
+void xensiv_pas_gas_shm_publish(xensiv_pas_gas_shm_t *shm, const xensiv_pas_gas_shm_sample_t *sample);
+
+/**
+ * @brief Reads the result of a sensor with \ref xensiv_pas_gas_get_result and publishes it.
+ * Nothing is published if no new result is ready; errors are published with their result code.
+ *
+ * @param[in] shm Writer
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] sensor Index of the sensor stored in the record
+ * @return Result of \ref xensiv_pas_gas_get_result
+ */
+int32_t xensiv_pas_gas_shm_acquire(xensiv_pas_gas_shm_t *shm, const xensiv_pas_gas_t *dev, uint16_t sensor);
+
+/**
+ * @brief Maps an existing shared-memory ring for reading.
+ * The reader starts at the next record published.
+ *
+ * @param[out] reader Reader allocated by the user
+ * @param[in] name Name of the shared-memory object
+ * @return XENSIV_PAS_GAS_OK if the ring was mapped; XENSIV_PAS_GAS_ERR_NOT_READY if the object does not exist or
+ * is not initialized yet; XENSIV_PAS_GAS_INVALID_PARAMETER if it has another layout version
+ */
+int32_t xensiv_pas_gas_shm_open(xensiv_pas_gas_shm_reader_t *reader, const char *name);
+
+/**
+ * @brief Unmaps the shared-memory ring
+ *
+ * @param[in] reader Reader
+ */
+void xensiv_pas_gas_shm_close(xensiv_pas_gas_shm_reader_t *reader);
+
+/**
+ * @brief Gets the next record in place, without copying it.
+ * The record stays at the reader's cursor until \ref xensiv_pas_gas_shm_release.
+ *
+ * @param[in] reader Reader
+ * @param[out] sample Pointer to populate with the address of the record in the shared memory
+ * @return XENSIV_PAS_GAS_OK if a record is available; XENSIV_PAS_GAS_READ_NRDY if no new record was published;
+ * XENSIV_PAS_GAS_OVERRUN if records were overwritten before they were read, the cursor is then moved to the
+ * oldest record and the next call returns it
+ */
+int32_t xensiv_pas_gas_shm_peek(xensiv_pas_gas_shm_reader_t *reader, const xensiv_pas_gas_shm_sample_t **sample);
+
+/**
+ * @brief Releases the record returned by \ref xensiv_pas_gas_shm_peek and moves the cursor past it
+ *
+ * @param[in] reader Reader
+ * @return XENSIV_PAS_GAS_OK if the record was intact until the release; XENSIV_PAS_GAS_OVERRUN if the writer
+ * overwrote it meanwhile, its contents must then be discarded
+ */
+int32_t xensiv_pas_gas_shm_release(xensiv_pas_gas_shm_reader_t *reader);
+
+/**
+ * @brief Copies the next record, combining \ref xensiv_pas_gas_shm_peek and \ref xensiv_pas_gas_shm_release
+ *
+ * @param[in] reader Reader
+ * @param[out] sample Pointer to populate with the record
+ * @return XENSIV_PAS_GAS_OK if a record was copied; XENSIV_PAS_GAS_READ_NRDY if no new record was published;
+ * XENSIV_PAS_GAS_OVERRUN if records were lost, the next call returns the oldest record
+ */
+int32_t xensiv_pas_gas_shm_read(xensiv_pas_gas_shm_reader_t *reader, xensiv_pas_gas_shm_sample_t *sample);
+
+/**
+ * @brief Gets the number of records the reader lost
+ *
+ * @param[in] reader Reader
+ * @return Number of records overwritten before they were read, since \ref xensiv_pas_gas_shm_open
+ */
+uint64_t xensiv_pas_gas_shm_get_lost(const xensiv_pas_gas_shm_reader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_shm */
+
+#endif /* XENSIV_PAS_GAS_SHM_H_ */
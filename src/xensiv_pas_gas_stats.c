@@ -0,0 +1,119 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_stats.c
+ *
+ * Description: This file contains the per-device communication counters and latency
+ *              histograms of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "xensiv_pas_gas_stats.h"
+
+#if XENSIV_PAS_GAS_ENABLE_STATS
+
+static uint8_t xensiv_pas_gas_stats_bucket(uint64_t latency_us) {
+    uint8_t bucket = 0U;
+
+    while ((latency_us != 0U) && (bucket < (XENSIV_PAS_GAS_STATS_LATENCY_BUCKETS - 1U)))
+    {
+        latency_us >>= 1U;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+void xensiv_pas_gas_stats_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_t *stats) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    dev->stats = stats;
+    xensiv_pas_gas_stats_reset(dev);
+}
+
+void xensiv_pas_gas_stats_snapshot(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_t *snapshot) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+    xensiv_pas_gas_plat_assert(snapshot != NULL);
+
+    if (dev->stats != NULL) {
+        *snapshot = *dev->stats;
+    } else {
+        (void)memset(snapshot, 0, sizeof(*snapshot));
+    }
+}
+
+void xensiv_pas_gas_stats_reset(const xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    if (dev->stats != NULL) {
+        (void)memset(dev->stats, 0, sizeof(*dev->stats));
+    }
+}
+
+void xensiv_pas_gas_stats_record_access(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t latency_us) {
+    xensiv_pas_gas_stats_t *stats = dev->stats;
+
+    if (stats == NULL) {
+        return;
+    }
+
+    xensiv_pas_gas_op_stats_t *op_stats = &stats->op[op];
+
+    op_stats->count++;
+    op_stats->latency_sum_us += latency_us;
+    op_stats->latency_hist[xensiv_pas_gas_stats_bucket(latency_us)]++;
+    if (latency_us > op_stats->latency_max_us) {
+        op_stats->latency_max_us = (latency_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)latency_us;
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        op_stats->bytes += len;
+
+        /* Count the communication errors the sensor reports through SENS_STS */
+        if ((XENSIV_PAS_GAS_STATS_OP_READ == op) &&
+            (reg_addr <= XENSIV_PAS_GAS_REG_SENS_STS) && ((reg_addr + len) > XENSIV_PAS_GAS_REG_SENS_STS) &&
+            ((data[XENSIV_PAS_GAS_REG_SENS_STS - reg_addr] & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U)) {
+            stats->iccerr++;
+        }
+    } else if ((res > 0) && (res < (int32_t)XENSIV_PAS_GAS_STATS_RESULT_CODES)) {
+        op_stats->errors[res]++;
+    } else {
+        /* Platform specific error codes are not counted separately */
+        op_stats->errors[XENSIV_PAS_GAS_ERR_COMM]++;
+    }
+}
+
+void xensiv_pas_gas_stats_record_delay(const xensiv_pas_gas_t *dev, uint32_t ms) {
+    if (dev->stats != NULL) {
+        dev->stats->delays++;
+        dev->stats->delay_ms += ms;
+    }
+}
+
+void xensiv_pas_gas_stats_record_nak(const xensiv_pas_gas_t *dev) {
+    if (dev->stats != NULL) {
+        dev->stats->naks++;
+    }
+}
+
+void xensiv_pas_gas_stats_record_retry(const xensiv_pas_gas_t *dev) {
+    if (dev->stats != NULL) {
+        dev->stats->retries++;
+    }
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_STATS */
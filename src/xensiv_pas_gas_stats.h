@@ -0,0 +1,207 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_stats.h
+ *
+ * Description: This file contains the per-device communication counters and latency
+ *              histograms of the XENSIV™ PAS GAS sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_STATS_H_
+#define XENSIV_PAS_GAS_STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_stats XENSIV™ PAS GAS sensor statistics
+ * \{
+ * Per-device counters of the register accesses done through \ref xensiv_pas_gas_set_reg and
+ * \ref xensiv_pas_gas_get_reg, with log-bucketed latency histograms.
+ *
+ * The statistics are only collected if the library is built with XENSIV_PAS_GAS_ENABLE_STATS set to 1.
+ * Otherwise the functions below are empty and the device structure carries no statistics.
+ * Latencies are measured with \ref xensiv_pas_gas_plat_get_time_us.
+ *
+ * The statistics storage is allocated by the user and attached after the sensor initialization:
+ * \code
+ *  static xensiv_pas_gas_stats_t stats;
+ *  xensiv_pas_gas_co2_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &i2c);
+ *  xensiv_pas_gas_stats_attach(&dev, &stats);
+ * \endcode
+ */
+
+/************************************** Macros *******************************************/
+
+/** Number of buckets of the latency histograms.
+ * Bucket 0 counts latencies below 1 us; bucket i counts latencies in [2^(i-1), 2^i) us; the last bucket counts all longer latencies. */
+#define XENSIV_PAS_GAS_STATS_LATENCY_BUCKETS     (20U)
+
+/** Number of result codes counted separately, from \ref XENSIV_PAS_GAS_OK up to the highest, \ref XENSIV_PAS_GAS_TIMEOUT */
+#define XENSIV_PAS_GAS_STATS_RESULT_CODES        ((uint32_t)XENSIV_PAS_GAS_TIMEOUT + 1U)
+
+/********************************* Type definitions **************************************/
+
+/** Enum defining the register access operations tracked by the statistics */
+typedef enum
+{
+    XENSIV_PAS_GAS_STATS_OP_READ = 0U,                  /**< Register read through \ref xensiv_pas_gas_get_reg */
+    XENSIV_PAS_GAS_STATS_OP_WRITE = 1U,                 /**< Register write through \ref xensiv_pas_gas_set_reg */
+    XENSIV_PAS_GAS_STATS_OP_NUM = 2U                    /**< Number of tracked operations */
+} xensiv_pas_gas_stats_op_t;
+
+/** Counters of a register access operation */
+typedef struct
+{
+    uint32_t count;                                                 /*!< Number of accesses */
+    uint64_t bytes;                                                 /*!< Number of register bytes transferred */
+    uint32_t errors[XENSIV_PAS_GAS_STATS_RESULT_CODES];             /*!< Number of failed accesses indexed by result code; index 0 is unused */
+    uint64_t latency_sum_us;                                        /*!< Sum of the access latencies */
+    uint32_t latency_max_us;                                        /*!< Longest access latency */
+    uint32_t latency_hist[XENSIV_PAS_GAS_STATS_LATENCY_BUCKETS];    /*!< Log2-bucketed access latencies */
+} xensiv_pas_gas_op_stats_t;
+
+/** Statistics of a XENSIV™ PAS GAS sensor device */
+typedef struct xensiv_pas_gas_stats_s
+{
+    xensiv_pas_gas_op_stats_t op[XENSIV_PAS_GAS_STATS_OP_NUM];     /*!< Counters per operation, indexed by \ref xensiv_pas_gas_stats_op_t */
+    uint32_t naks;                                                  /*!< Number of UART writes answered with NAK */
+    uint32_t iccerr;                                                /*!< Number of SENS_STS reads with the ICCERR bit set */
+    uint32_t retries;                                               /*!< Number of repeated register accesses */
+    uint32_t delays;                                                /*!< Number of driver delays */
+    uint64_t delay_ms;                                              /*!< Cumulative driver delay time */
+} xensiv_pas_gas_stats_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if XENSIV_PAS_GAS_ENABLE_STATS
+
+/**
+ * @brief Attaches the statistics storage to a sensor device and resets it.
+ * @note The sensor initialization functions detach the statistics, attach them after the initialization
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] stats Statistics storage allocated by the user; NULL to detach
+ */
+void xensiv_pas_gas_stats_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_t *stats);
+
+/**
+ * @brief Copies the current statistics of a sensor device
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[out] snapshot Pointer to populate with the statistics; zeroed if no statistics are attached
+ */
+void xensiv_pas_gas_stats_snapshot(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_t *snapshot);
+
+/**
+ * @brief Resets the statistics of a sensor device
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ */
+void xensiv_pas_gas_stats_reset(const xensiv_pas_gas_t *dev);
+
+/**
+ * @brief Records a register access. Used by the driver core.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] op Register access operation
+ * @param[in] reg_addr Start register address
+ * @param[in] data Register data transferred
+ * @param[in] len Number of register bytes
+ * @param[in] res Result of the access
+ * @param[in] latency_us Duration of the access
+ */
+void xensiv_pas_gas_stats_record_access(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t latency_us);
+
+/**
+ * @brief Records a driver delay. Used by the driver core.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] ms Delay time in milliseconds
+ */
+void xensiv_pas_gas_stats_record_delay(const xensiv_pas_gas_t *dev, uint32_t ms);
+
+/**
+ * @brief Records a UART write answered with NAK. Used by the driver core.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ */
+void xensiv_pas_gas_stats_record_nak(const xensiv_pas_gas_t *dev);
+
+/**
+ * @brief Records a repeated register access. Used by the driver core.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ */
+void xensiv_pas_gas_stats_record_retry(const xensiv_pas_gas_t *dev);
+
+#else /* XENSIV_PAS_GAS_ENABLE_STATS */
+
+static inline void xensiv_pas_gas_stats_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_t *stats) {
+    (void)dev;
+    (void)stats;
+}
+
+static inline void xensiv_pas_gas_stats_snapshot(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_t *snapshot) {
+    (void)dev;
+    (void)memset(snapshot, 0, sizeof(*snapshot));
+}
+
+static inline void xensiv_pas_gas_stats_reset(const xensiv_pas_gas_t *dev) {
+    (void)dev;
+}
+
+static inline void xensiv_pas_gas_stats_record_access(const xensiv_pas_gas_t *dev, xensiv_pas_gas_stats_op_t op, uint8_t reg_addr, const uint8_t *data, uint8_t len, int32_t res, uint64_t latency_us) {
+    (void)dev;
+    (void)op;
+    (void)reg_addr;
+    (void)data;
+    (void)len;
+    (void)res;
+    (void)latency_us;
+}
+
+static inline void xensiv_pas_gas_stats_record_delay(const xensiv_pas_gas_t *dev, uint32_t ms) {
+    (void)dev;
+    (void)ms;
+}
+
+static inline void xensiv_pas_gas_stats_record_nak(const xensiv_pas_gas_t *dev) {
+    (void)dev;
+}
+
+static inline void xensiv_pas_gas_stats_record_retry(const xensiv_pas_gas_t *dev) {
+    (void)dev;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_stats */
+
+#endif /* XENSIV_PAS_GAS_STATS_H_ */
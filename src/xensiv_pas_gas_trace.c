@@ -0,0 +1,128 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_trace.c
+ *
+ * Description: This file contains the bus transaction trace of the XENSIV™ PAS GAS
+ *              sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "xensiv_pas_gas_trace.h"
+
+#define XENSIV_PAS_GAS_TRACE_JSON_BUF_SIZE       (192U)
+
+static int32_t xensiv_pas_gas_trace_write_str(xensiv_pas_gas_trace_write_fptr_t write, void *ctx, const char *str) {
+    return write(ctx, str, strlen(str));
+}
+
+void xensiv_pas_gas_trace_init(xensiv_pas_gas_trace_t *trace, xensiv_pas_gas_trace_event_t *events, size_t capacity) {
+    xensiv_pas_gas_plat_assert(trace != NULL);
+    xensiv_pas_gas_plat_assert((events != NULL) && (capacity > 0U));
+
+    trace->events = events;
+    trace->capacity = capacity;
+    xensiv_pas_gas_trace_clear(trace);
+}
+
+void xensiv_pas_gas_trace_clear(xensiv_pas_gas_trace_t *trace) {
+    xensiv_pas_gas_plat_assert(trace != NULL);
+
+    trace->head = 0U;
+    trace->count = 0U;
+    trace->overwritten = 0U;
+}
+
+int32_t xensiv_pas_gas_trace_dump_json(const xensiv_pas_gas_trace_t *trace, xensiv_pas_gas_trace_write_fptr_t write, void *ctx) {
+    xensiv_pas_gas_plat_assert(trace != NULL);
+    xensiv_pas_gas_plat_assert(write != NULL);
+
+    char buf[XENSIV_PAS_GAS_TRACE_JSON_BUF_SIZE];
+    int32_t res = xensiv_pas_gas_trace_write_str(write, ctx, "{\"traceEvents\":[");
+
+    size_t first = (trace->head + trace->capacity - trace->count) % trace->capacity;
+    for (size_t i = 0U; (XENSIV_PAS_GAS_OK == res) && (i < trace->count); ++i)
+    {
+        const xensiv_pas_gas_trace_event_t *ev = &trace->events[(first + i) % trace->capacity];
+        const char *sep = (i == 0U) ? "\n" : ",\n";
+        int len;
+
+        if (XENSIV_PAS_GAS_TRACE_EVENT_DELAY == ev->type) {
+            len = snprintf(buf, sizeof(buf),
+                           "%s{\"name\":\"delay\",\"cat\":\"delay\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%lu,\"pid\":0,\"tid\":%u}",
+                           sep, (unsigned long long)ev->start_us, (unsigned long)ev->dur_us, (unsigned)ev->track);
+        } else {
+            len = snprintf(buf, sizeof(buf),
+                           "%s{\"name\":\"%s 0x%02X\",\"cat\":\"bus\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%lu,\"pid\":0,\"tid\":%u,"
+                           "\"args\":{\"reg\":%u,\"len\":%u,\"res\":%ld}}",
+                           sep, (XENSIV_PAS_GAS_TRACE_EVENT_READ == ev->type) ? "read" : "write", (unsigned)ev->reg_addr,
+                           (unsigned long long)ev->start_us, (unsigned long)ev->dur_us, (unsigned)ev->track,
+                           (unsigned)ev->reg_addr, (unsigned)ev->len, (long)ev->res);
+        }
+
+        xensiv_pas_gas_plat_assert((len > 0) && ((size_t)len < sizeof(buf)));
+        res = write(ctx, buf, (size_t)len);
+    }
+
+    if (XENSIV_PAS_GAS_OK == res) {
+        int len = snprintf(buf, sizeof(buf), "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"overwritten\":%lu}}\n",
+                           (unsigned long)trace->overwritten);
+        res = write(ctx, buf, (size_t)len);
+    }
+
+    return res;
+}
+
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+
+void xensiv_pas_gas_trace_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_trace_t *trace, uint16_t track) {
+    xensiv_pas_gas_plat_assert(dev != NULL);
+
+    dev->trace = trace;
+    dev->trace_track = track;
+}
+
+void xensiv_pas_gas_trace_record(const xensiv_pas_gas_t *dev, xensiv_pas_gas_trace_event_type_t type, uint8_t reg_addr, uint8_t len, int32_t res, uint64_t start_us, uint64_t end_us) {
+    xensiv_pas_gas_trace_t *trace = dev->trace;
+
+    if (trace == NULL) {
+        return;
+    }
+
+    xensiv_pas_gas_trace_event_t *ev = &trace->events[trace->head];
+    uint64_t dur_us = (end_us > start_us) ? (end_us - start_us) : 0U;
+
+    ev->start_us = start_us;
+    ev->dur_us = (dur_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)dur_us;
+    ev->res = res;
+    ev->track = dev->trace_track;
+    ev->type = (uint8_t)type;
+    ev->reg_addr = reg_addr;
+    ev->len = len;
+
+    trace->head = (trace->head + 1U) % trace->capacity;
+    if (trace->count < trace->capacity) {
+        trace->count++;
+    } else {
+        trace->overwritten++;
+    }
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_TRACE */
@@ -0,0 +1,184 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_trace.h
+ *
+ * Description: This file contains the bus transaction trace of the XENSIV™ PAS GAS
+ *              sensor driver.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_TRACE_H_
+#define XENSIV_PAS_GAS_TRACE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "xensiv_pas_gas.h"
+
+/**
+ * \addtogroup group_board_libs_trace XENSIV™ PAS GAS sensor bus trace
+ * \{
+ * Fixed-size ring of the register transfers done through the device read and write functions
+ * and of the driver delays, exported as Chrome trace-event JSON (chrome://tracing, Perfetto).
+ *
+ * The trace is only recorded if the library is built with XENSIV_PAS_GAS_ENABLE_TRACE set to 1.
+ * Timestamps are taken with \ref xensiv_pas_gas_plat_get_time_us.
+ *
+ * A ring can be attached to a single device or shared by all devices of a bus, each device
+ * being shown as its own track:
+ * \code
+ *  static xensiv_pas_gas_trace_event_t events[512];
+ *  static xensiv_pas_gas_trace_t trace;
+ *  xensiv_pas_gas_trace_init(&trace, events, 512U);
+ *  xensiv_pas_gas_trace_attach(&dev0, &trace, 0U);
+ *  xensiv_pas_gas_trace_attach(&dev1, &trace, 1U);
+ *  ...
+ *  xensiv_pas_gas_trace_dump_json(&trace, write_to_file, fp);
+ * \endcode
+ *
+ * A ring is not protected against concurrent access: the devices attached to it must only be accessed
+ * from one thread at a time, and it must not be dumped or cleared while they are. With \ref
+ * group_board_libs_exec, which runs the jobs of a bus one at a time but the buses in parallel, a ring
+ * is thus shared only by the devices of one bus and dumped once the executor is idle.
+ */
+
+/********************************* Type definitions **************************************/
+
+/** Enum defining the traced event types */
+typedef enum
+{
+    XENSIV_PAS_GAS_TRACE_EVENT_READ = 0U,               /**< Register read transfer */
+    XENSIV_PAS_GAS_TRACE_EVENT_WRITE = 1U,              /**< Register write transfer */
+    XENSIV_PAS_GAS_TRACE_EVENT_DELAY = 2U               /**< Driver delay */
+} xensiv_pas_gas_trace_event_type_t;
+
+/** Traced event */
+typedef struct
+{
+    uint64_t start_us;                  /*!< Start timestamp */
+    uint32_t dur_us;                    /*!< Duration */
+    int32_t res;                        /*!< Result of the transfer */
+    uint16_t track;                     /*!< Track of the device which issued the event */
+    uint8_t type;                       /*!< @ref xensiv_pas_gas_trace_event_type_t */
+    uint8_t reg_addr;                   /*!< Start register address of a transfer */
+    uint8_t len;                        /*!< Number of bytes of a transfer */
+} xensiv_pas_gas_trace_event_t;
+
+/** Trace ring. Initialized using \ref xensiv_pas_gas_trace_init */
+typedef struct xensiv_pas_gas_trace_s
+{
+    xensiv_pas_gas_trace_event_t *events;   /*!< Event storage allocated by the user */
+    size_t capacity;                        /*!< Number of events of the storage */
+    size_t head;                            /*!< Index of the next event to write */
+    size_t count;                           /*!< Number of valid events */
+    uint32_t overwritten;                   /*!< Number of events overwritten because the ring was full */
+} xensiv_pas_gas_trace_t;
+
+/**
+ * Function pointer used by \ref xensiv_pas_gas_trace_dump_json to output the JSON text
+ * @param[in] ctx User context
+ * @param[in] data Text chunk, not null-terminated
+ * @param[in] len Length of the text chunk
+ * @return XENSIV_PAS_GAS_OK if the chunk was written; an error otherwise, which aborts the dump
+ */
+typedef int32_t (*xensiv_pas_gas_trace_write_fptr_t)(void *ctx, const char *data, size_t len);
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes an empty trace ring
+ *
+ * @param[out] trace Trace ring allocated by the user
+ * @param[in] events Event storage allocated by the user
+ * @param[in] capacity Number of events of the storage
+ */
+void xensiv_pas_gas_trace_init(xensiv_pas_gas_trace_t *trace, xensiv_pas_gas_trace_event_t *events, size_t capacity);
+
+/**
+ * @brief Removes all events from a trace ring
+ *
+ * @param[in] trace Trace ring
+ */
+void xensiv_pas_gas_trace_clear(xensiv_pas_gas_trace_t *trace);
+
+/**
+ * @brief Writes the events of a trace ring, oldest first, as Chrome trace-event JSON
+ *
+ * @param[in] trace Trace ring
+ * @param[in] write Function outputting the JSON text
+ * @param[in] ctx User context passed to write
+ * @return XENSIV_PAS_GAS_OK if the dump was successful; the error returned by write otherwise
+ */
+int32_t xensiv_pas_gas_trace_dump_json(const xensiv_pas_gas_trace_t *trace, xensiv_pas_gas_trace_write_fptr_t write, void *ctx);
+
+#if XENSIV_PAS_GAS_ENABLE_TRACE
+
+/**
+ * @brief Attaches a trace ring to a sensor device.
+ * @note The sensor initialization functions detach the trace, attach it after the initialization
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] trace Trace ring; NULL to detach
+ * @param[in] track Track on which the events of the device are shown
+ */
+void xensiv_pas_gas_trace_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_trace_t *trace, uint16_t track);
+
+/**
+ * @brief Records an event into the trace ring of a device. Used by the driver core.
+ *
+ * @param[in] dev Pointer to the XENSIV™ PAS GAS sensor device
+ * @param[in] type Event type
+ * @param[in] reg_addr Start register address of a transfer
+ * @param[in] len Number of bytes of a transfer
+ * @param[in] res Result of the transfer
+ * @param[in] start_us Start timestamp
+ * @param[in] end_us End timestamp
+ */
+void xensiv_pas_gas_trace_record(const xensiv_pas_gas_t *dev, xensiv_pas_gas_trace_event_type_t type, uint8_t reg_addr, uint8_t len, int32_t res, uint64_t start_us, uint64_t end_us);
+
+#else /* XENSIV_PAS_GAS_ENABLE_TRACE */
+
+static inline void xensiv_pas_gas_trace_attach(xensiv_pas_gas_t *dev, xensiv_pas_gas_trace_t *trace, uint16_t track) {
+    (void)dev;
+    (void)trace;
+    (void)track;
+}
+
+static inline void xensiv_pas_gas_trace_record(const xensiv_pas_gas_t *dev, xensiv_pas_gas_trace_event_type_t type, uint8_t reg_addr, uint8_t len, int32_t res, uint64_t start_us, uint64_t end_us) {
+    (void)dev;
+    (void)type;
+    (void)reg_addr;
+    (void)len;
+    (void)res;
+    (void)start_us;
+    (void)end_us;
+}
+
+#endif /* XENSIV_PAS_GAS_ENABLE_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** \} group_board_libs_trace */
+
+#endif /* XENSIV_PAS_GAS_TRACE_H_ */
@@ -0,0 +1,657 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_variants.hpp
+ *
+ * Description: This file contains the C++17 classes of the XENSIV™ PAS CO2, R290 and A2L sensors
+ *              with compile-time register maps.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_VARIANTS_HPP_
+#define XENSIV_PAS_GAS_VARIANTS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "xensiv_pas_gas.h"
+#include "xensiv_pas_gas_co2.h"
+#include "xensiv_pas_gas_r290.h"
+#include "xensiv_pas_gas_a2l.h"
+#include "xensiv_pas_gas_async.h"
+
+/**
+ * \addtogroup group_board_libs_variants XENSIV™ PAS GAS sensor C++17 variant classes
+ * \{
+ * Header-only C++17 classes \ref xensiv_pas_gas::pas_co2, \ref xensiv_pas_gas::pas_r290 and
+ * \ref xensiv_pas_gas::pas_a2l templated on a transport policy.
+ *
+ * The register addresses, field masks, measurement rate limits and forced compensation rates of each
+ * variant are constexpr members of its register map, and the register accesses take the register address,
+ * the burst length and the values of the fields as template arguments. A measurement rate out of the range
+ * of the variant, a value wider than its field, a burst too long for the transport or a register the
+ * transport cannot reach thus fails to compile, and no xensiv_pas_gas_plat_assert remains on the access
+ * path. The transports \ref xensiv_pas_gas::transport::i2c, \ref xensiv_pas_gas::transport::uart and
+ * \ref xensiv_pas_gas::transport::emulator are inlined into the classes:
+ * \code
+ *  xensiv_pas_gas::pas_a2l<xensiv_pas_gas::transport::i2c> sensor(ctx);
+ *  if (XENSIV_PAS_GAS_OK == sensor.init()) {
+ *      sensor.set_field<xensiv_pas_gas::a2l_regs::gas_sel, XENSIV_PAS_GAS_A2L_GAS_R32>();
+ *      sensor.start_continuous_mode<10U>();
+ *      ...
+ *      int32_t res = sensor.get_result(val);
+ *  }
+ * \endcode
+ *
+ * The classes access the sensor directly through the transport and keep no xensiv_pas_gas_t; the retry
+ * policy, the statistics and the trace of the driver do not apply to them. Each access is followed by
+ * \ref XENSIV_PAS_GAS_COMM_DELAY_MS, like in the driver. The forced compensation polls MEAS_CFG every \ref
+ * XENSIV_PAS_GAS_ASYNC_FCS_POLL_MS and gives up after \ref XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES measurement
+ * periods, like \ref xensiv_pas_gas_async_forced_compensation.
+ */
+
+struct xensiv_pas_gas_emul_s;                           /* Forward declaration */
+
+namespace xensiv_pas_gas
+{
+/**
+ * Register field
+ * @tparam Reg Register address
+ * @tparam Pos Position of the least significant bit
+ * @tparam Msk Mask of the field in the register, as in the register headers
+ */
+template<uint8_t Reg, uint8_t Pos, uint8_t Msk>
+struct field
+{
+    static_assert((Msk != 0U) && (((Msk >> Pos) << Pos) == Msk), "Mask does not match the position");
+
+    static constexpr uint8_t reg = Reg;                         /*!< Register address */
+    static constexpr uint8_t pos = Pos;                         /*!< Position of the least significant bit */
+    static constexpr uint8_t mask = Msk;                        /*!< Mask of the field in the register */
+    static constexpr uint8_t max = (uint8_t)(Msk >> Pos);       /*!< Largest value of the field */
+};
+
+/** Register map common to the XENSIV™ PAS GAS family */
+struct base_regs
+{
+    static constexpr uint8_t prod_id = XENSIV_PAS_GAS_REG_PROD_ID;              /*!< PROD_ID address */
+    static constexpr uint8_t sens_sts = XENSIV_PAS_GAS_REG_SENS_STS;            /*!< SENS_STS address */
+    static constexpr uint8_t meas_rate_h = XENSIV_PAS_GAS_REG_MEAS_RATE_H;      /*!< MEAS_RATE_H address */
+    static constexpr uint8_t meas_rate_l = XENSIV_PAS_GAS_REG_MEAS_RATE_L;      /*!< MEAS_RATE_L address */
+    static constexpr uint8_t meas_cfg = XENSIV_PAS_GAS_REG_MEAS_CFG;            /*!< MEAS_CFG address */
+    static constexpr uint8_t gasconc_h = XENSIV_PAS_GAS_REG_GASCONC_H;          /*!< GASCONC_H address */
+    static constexpr uint8_t gasconc_l = XENSIV_PAS_GAS_REG_GASCONC_L;          /*!< GASCONC_L address */
+    static constexpr uint8_t meas_sts = XENSIV_PAS_GAS_REG_MEAS_STS;            /*!< MEAS_STS address */
+    static constexpr uint8_t int_cfg = XENSIV_PAS_GAS_REG_INT_CFG;              /*!< INT_CFG address */
+    static constexpr uint8_t alarm_th_h = XENSIV_PAS_GAS_REG_ALARM_TH_H;        /*!< ALARM_TH_H address */
+    static constexpr uint8_t alarm_th_l = XENSIV_PAS_GAS_REG_ALARM_TH_L;        /*!< ALARM_TH_L address */
+    static constexpr uint8_t press_ref_h = XENSIV_PAS_GAS_REG_PRESS_REF_H;      /*!< PRESS_REF_H address */
+    static constexpr uint8_t press_ref_l = XENSIV_PAS_GAS_REG_PRESS_REF_L;      /*!< PRESS_REF_L address */
+    static constexpr uint8_t calib_ref_h = XENSIV_PAS_GAS_REG_CALIB_REF_H;      /*!< CALIB_REF_H address */
+    static constexpr uint8_t calib_ref_l = XENSIV_PAS_GAS_REG_CALIB_REF_L;      /*!< CALIB_REF_L address */
+    static constexpr uint8_t scratch_pad = XENSIV_PAS_GAS_REG_SCRATCH_PAD;      /*!< SCRATCH_PAD address */
+    static constexpr uint8_t sens_rst = XENSIV_PAS_GAS_REG_SENS_RST;            /*!< SENS_RST address */
+
+    /** SENS_STS.SEN_RDY */
+    using sen_rdy = field<sens_sts, XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_POS, XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK>;
+    /** MEAS_CFG.OP_MODE */
+    using op_mode = field<meas_cfg, XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_POS, XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK>;
+    /** MEAS_CFG.BOC_CFG */
+    using boc_cfg = field<meas_cfg, XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS, XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_MSK>;
+    /** MEAS_STS.DRDY */
+    using drdy = field<meas_sts, XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_POS, XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK>;
+    /** INT_CFG.ALARM_TYP */
+    using alarm_typ = field<int_cfg, XENSIV_PAS_GAS_REG_INT_CFG_ALARM_TYP_POS, XENSIV_PAS_GAS_REG_INT_CFG_ALARM_TYP_MSK>;
+    /** INT_CFG.INT_FUNC */
+    using int_func = field<int_cfg, XENSIV_PAS_GAS_REG_INT_CFG_INT_FUNC_POS, XENSIV_PAS_GAS_REG_INT_CFG_INT_FUNC_MSK>;
+    /** INT_CFG.INT_TYP */
+    using int_typ = field<int_cfg, XENSIV_PAS_GAS_REG_INT_CFG_INT_TYP_POS, XENSIV_PAS_GAS_REG_INT_CFG_INT_TYP_MSK>;
+
+    static constexpr uint16_t meas_rate_max = XENSIV_PAS_GAS_MEAS_RATE_MAX;    /*!< Maximum measurement rate in seconds */
+};
+
+/** Register map of the XENSIV™ PAS CO2 sensor */
+struct co2_regs : base_regs
+{
+    static constexpr xensiv_pas_gas_variant_t variant = XENSIV_PAS_GAS_VARIANT_CO2;     /*!< Sensor variant */
+    static constexpr uint16_t meas_rate_min = XENSIV_PAS_GAS_CO2_MEAS_RATE_MIN;         /*!< Minimum measurement rate in seconds */
+    static constexpr uint16_t fcs_meas_rate_s = XENSIV_PAS_GAS_CO2_FCS_MEAS_RATE_S;     /*!< Measurement rate in seconds of the forced compensation */
+
+    /** MEAS_CFG.PWM_MODE */
+    using pwm_mode = field<meas_cfg, XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_MODE_POS, XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_MODE_MSK>;
+    /** MEAS_CFG.PWM_OUTEN */
+    using pwm_outen = field<meas_cfg, XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_OUTEN_POS, XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_OUTEN_MSK>;
+};
+
+/** Register map of the XENSIV™ PAS R290 sensor */
+struct r290_regs : base_regs
+{
+    static constexpr xensiv_pas_gas_variant_t variant = XENSIV_PAS_GAS_VARIANT_R290;    /*!< Sensor variant */
+    static constexpr uint16_t meas_rate_min = XENSIV_PAS_GAS_R290_MEAS_RATE_MIN;        /*!< Minimum measurement rate in seconds */
+    static constexpr uint16_t fcs_meas_rate_s = XENSIV_PAS_GAS_R290_FCS_MEAS_RATE_S;    /*!< Measurement rate in seconds of the forced compensation */
+
+    static constexpr uint8_t dev_id = XENSIV_PAS_GAS_R290_REG_DEV_ID;                   /*!< DEV_ID address */
+    static constexpr uint8_t aboc_prefill = XENSIV_PAS_GAS_R290_REG_ABOC_PREFILL;       /*!< ABOC_PREFILL address */
+    static constexpr uint8_t alarm_cfg = XENSIV_PAS_GAS_R290_REG_ALARM_CFG;             /*!< ALARM_CFG address */
+    static constexpr uint8_t self_test = XENSIV_PAS_GAS_R290_REG_SELF_TEST;             /*!< SELF_TEST address */
+    static constexpr uint8_t denoise_cfg = XENSIV_PAS_GAS_R290_REG_DENOISE_CFG;         /*!< DENOISE_CFG address */
+    static constexpr uint8_t aboc_cycle = XENSIV_PAS_GAS_R290_REG_ABOC_CYCLE;           /*!< ABOC_CYCLE address */
+    static constexpr uint8_t self_test_clr = XENSIV_PAS_GAS_R290_REG_SELF_TEST_CLR;     /*!< SELF_TEST_CLR address */
+
+    /** ALARM_CFG.ALARM_POL */
+    using alarm_pol = field<alarm_cfg, XENSIV_PAS_GAS_R290_REG_ALARM_CFG_ALARM_POL_POS, XENSIV_PAS_GAS_R290_REG_ALARM_CFG_ALARM_POL_MSK>;
+    /** DENOISE_CFG smoothing factor */
+    using denoise_smoothing = field<denoise_cfg, XENSIV_PAS_GAS_R290_REG_DENOISE_CFG_SMOOTHING_FACT_POS, XENSIV_PAS_GAS_R290_REG_DENOISE_CFG_SMOOTHING_FACT_MSK>;
+    /** ABOC_CYCLE smoothing factor */
+    using aboc_smoothing = field<aboc_cycle, XENSIV_PAS_GAS_R290_REG_ABOC_CYCLE_SMOOTHING_FACT_POS, XENSIV_PAS_GAS_R290_REG_ABOC_CYCLE_SMOOTHING_FACT_MSK>;
+};
+
+/** Register map of the XENSIV™ PAS A2L sensor */
+struct a2l_regs : base_regs
+{
+    static constexpr xensiv_pas_gas_variant_t variant = XENSIV_PAS_GAS_VARIANT_A2L;     /*!< Sensor variant */
+    static constexpr uint16_t meas_rate_min = XENSIV_PAS_GAS_A2L_MEAS_RATE_MIN;         /*!< Minimum measurement rate in seconds */
+    static constexpr uint16_t fcs_meas_rate_s = XENSIV_PAS_GAS_A2L_FCS_MEAS_RATE_S;     /*!< Measurement rate in seconds of the forced compensation */
+
+    static constexpr uint8_t cfg_save = XENSIV_PAS_GAS_A2L_REG_CFG_SAVE;                /*!< CFG_SAVE address */
+    static constexpr uint8_t dev_id_idx = XENSIV_PAS_GAS_A2L_REG_DEV_ID_IDX;            /*!< DEV_ID_IDX address */
+    static constexpr uint8_t dev_id = XENSIV_PAS_GAS_A2L_REG_DEV_ID;                    /*!< DEV_ID address */
+    static constexpr uint8_t aboc_prefill = XENSIV_PAS_GAS_A2L_REG_ABOC_PREFILL;        /*!< ABOC_PREFILL address */
+    static constexpr uint8_t gas_cfg = XENSIV_PAS_GAS_A2L_REG_GAS_CFG;                  /*!< GAS_CFG address */
+    static constexpr uint8_t alarm_cfg = XENSIV_PAS_GAS_A2L_REG_ALARM_CFG;              /*!< ALARM_CFG address */
+    static constexpr uint8_t self_test = XENSIV_PAS_GAS_A2L_REG_SELF_TEST;              /*!< SELF_TEST address */
+    static constexpr uint8_t denoise_cfg = XENSIV_PAS_GAS_A2L_REG_DENOISE_CFG;          /*!< DENOISE_CFG address */
+    static constexpr uint8_t aboc_cycle = XENSIV_PAS_GAS_A2L_REG_ABOC_CYCLE;            /*!< ABOC_CYCLE address */
+    static constexpr uint8_t self_test_clr = XENSIV_PAS_GAS_A2L_REG_SELF_TEST_CLR;      /*!< SELF_TEST_CLR address */
+    static constexpr uint8_t alarm_hys_h = XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_H;          /*!< ALARM_HYS_H address */
+    static constexpr uint8_t alarm_hys_l = XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_L;          /*!< ALARM_HYS_L address */
+    static constexpr uint8_t abs_hum_ref_h = XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H;      /*!< ABS_HUM_REF_H address */
+    static constexpr uint8_t abs_hum_ref_l = XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_L;      /*!< ABS_HUM_REF_L address */
+    static constexpr uint8_t hc_ctrl = XENSIV_PAS_GAS_A2L_REG_HC_CTRL;                  /*!< HC_CTRL address */
+
+    /** GAS_CFG.GAS_SEL */
+    using gas_sel = field<gas_cfg, XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_SEL_POS, XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_SEL_MASK>;
+    /** GAS_CFG.GAS_AVAIL */
+    using gas_avail = field<gas_cfg, XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_AVAIL_POS, XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_AVAIL_MASK>;
+    /** ALARM_CFG.ALARM_POL */
+    using alarm_pol = field<alarm_cfg, XENSIV_PAS_GAS_A2L_REG_ALARM_CFG_ALARM_POL_POS, XENSIV_PAS_GAS_A2L_REG_ALARM_CFG_ALARM_POL_MSK>;
+    /** DENOISE_CFG smoothing factor */
+    using denoise_smoothing = field<denoise_cfg, XENSIV_PAS_GAS_A2L_REG_DENOISE_CFG_SMOOTHING_FACT_POS, XENSIV_PAS_GAS_A2L_REG_DENOISE_CFG_SMOOTHING_FACT_MSK>;
+    /** ABOC_CYCLE smoothing factor */
+    using aboc_smoothing = field<aboc_cycle, XENSIV_PAS_GAS_A2L_REG_ABOC_CYCLE_SMOOTHING_FACT_POS, XENSIV_PAS_GAS_A2L_REG_ABOC_CYCLE_SMOOTHING_FACT_MSK>;
+
+    static constexpr uint16_t alarm_hys_max = ((uint16_t)XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_H_MASK << 8U) | XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_L_MASK;        /*!< Largest alarm hysteresis */
+    static constexpr uint16_t abs_hum_ref_max = XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX;     /*!< Largest absolute humidity reference in g/m³, below the 10-bit field limit */
+};
+
+/** Transport policies of the variant classes */
+namespace transport
+{
+/** I2C transport through \ref xensiv_pas_gas_plat_i2c_transfer */
+struct i2c
+{
+    using context = void;                                       /*!< Type of the platform context */
+    static constexpr uint8_t max_reg = 0xFFU;                   /*!< Highest register address reachable */
+    static constexpr uint8_t max_len = 15U;                     /*!< Longest burst */
+
+    /** Reads len registers from reg_addr on */
+    static int32_t read(void *ctx, uint8_t reg_addr, uint8_t *data, uint8_t len) noexcept {
+        return xensiv_pas_gas_plat_i2c_transfer(ctx, XENSIV_PAS_GAS_I2C_ADDR, &reg_addr, 1U, data, len);
+    }
+
+    /** Writes len registers from reg_addr on */
+    static int32_t write(void *ctx, uint8_t reg_addr, const uint8_t *data, uint8_t len) noexcept {
+        uint8_t buf[max_len + 1U];
+        buf[0] = reg_addr;
+        for (uint8_t i = 0U; i < len; ++i)
+        {
+            buf[i + 1U] = data[i];
+        }
+
+        return xensiv_pas_gas_plat_i2c_transfer(ctx, XENSIV_PAS_GAS_I2C_ADDR, buf, (size_t)len + 1U, nullptr, 0U);
+    }
+};
+
+/** UART transport through \ref xensiv_pas_gas_plat_uart_write and \ref xensiv_pas_gas_plat_uart_read */
+struct uart
+{
+    using context = void;                                       /*!< Type of the platform context */
+    static constexpr uint8_t max_reg = XENSIV_PAS_GAS_REG_SENS_RST; /*!< Highest register address reachable */
+    static constexpr uint8_t max_len = 0xFFU;                   /*!< Longest burst */
+
+    /** Reads len registers from reg_addr on, one command per register */
+    static int32_t read(void *ctx, uint8_t reg_addr, uint8_t *data, uint8_t len) noexcept {
+        int32_t res = XENSIV_PAS_GAS_OK;
+
+        for (uint8_t i = 0U; (XENSIV_PAS_GAS_OK == res) && (i < len); ++i)
+        {
+            uint8_t buf[5] = { (uint8_t)'r', (uint8_t)',', to_ascii((uint8_t)(reg_addr + i) >> 4U), to_ascii((uint8_t)(reg_addr + i) & 0x0FU), (uint8_t)'\n' };
+            res = xensiv_pas_gas_plat_uart_write(ctx, buf, 5U);
+
+            if (XENSIV_PAS_GAS_OK == res) {
+                res = xensiv_pas_gas_plat_uart_read(ctx, buf, 3U);
+            }
+
+            if (XENSIV_PAS_GAS_OK == res) {
+                data[i] = (uint8_t)((from_ascii(buf[0]) << 4U) | from_ascii(buf[1]));
+            }
+        }
+
+        return res;
+    }
+
+    /** Writes len registers from reg_addr on, one command per register */
+    static int32_t write(void *ctx, uint8_t reg_addr, const uint8_t *data, uint8_t len) noexcept {
+        int32_t res = XENSIV_PAS_GAS_OK;
+
+        for (uint8_t i = 0U; (XENSIV_PAS_GAS_OK == res) && (i < len); ++i)
+        {
+            uint8_t reg = (uint8_t)(reg_addr + i);
+            uint8_t buf[8] = { (uint8_t)'w', (uint8_t)',', to_ascii(reg >> 4U), to_ascii(reg & 0x0FU), (uint8_t)',',
+                               to_ascii(data[i] >> 4U), to_ascii(data[i] & 0x0FU), (uint8_t)'\n' };
+            res = xensiv_pas_gas_plat_uart_write(ctx, buf, 8U);
+
+            if (XENSIV_PAS_GAS_OK == res) {
+                res = xensiv_pas_gas_plat_uart_read(ctx, buf, 2U);
+
+                /* The sensor does not answer a soft reset */
+                if ((XENSIV_PAS_GAS_REG_SENS_RST == reg) && ((uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET == data[i])) {
+                    res = XENSIV_PAS_GAS_OK;
+                } else if ((XENSIV_PAS_GAS_OK != res) || (0x06U != buf[0])) {
+                    res = XENSIV_PAS_GAS_ERR_COMM;
+                } else {
+                    /* Acknowledged */
+                }
+            }
+        }
+
+        return res;
+    }
+
+private:
+    static constexpr uint8_t to_ascii(uint8_t digit) noexcept {
+        return (uint8_t)((digit < 10U) ? (digit + (uint8_t)'0') : ((digit - 10U) + (uint8_t)'A'));
+    }
+
+    static constexpr uint8_t from_ascii(uint8_t ascii) noexcept {
+        return (uint8_t)((ascii < (uint8_t)'A') ? (ascii - (uint8_t)'0') : ((ascii - (uint8_t)'A') + 10U));
+    }
+};
+
+/**
+ * Emulator transport, I2C with a \ref xensiv_pas_gas_emul_t as context.
+ * The emulator library provides the platform functions, see \ref group_board_libs_emul.
+ */
+struct emulator : i2c
+{
+    using context = ::xensiv_pas_gas_emul_s;                    /*!< Type of the platform context */
+};
+} /* namespace transport */
+
+namespace detail
+{
+/** Register accesses and operations common to the variant classes */
+template<typename Transport, typename Regs>
+class pas_sensor
+{
+public:
+    using transport = Transport;                                /*!< Transport policy */
+    using regs = Regs;                                          /*!< Register map */
+    using context = typename Transport::context;                /*!< Type of the platform context */
+
+    /** @param[in] ctx Platform context passed to the transport */
+    explicit pas_sensor(context *ctx) noexcept : ctx_(ctx) {}
+
+    /** Platform context passed to the transport */
+    context *get_context() const noexcept {
+        return ctx_;
+    }
+
+    /** Reads Len registers from Reg on */
+    template<uint8_t Reg, uint8_t Len = 1U>
+    int32_t get_reg(uint8_t *data) const noexcept {
+        check_access<Reg, Len>();
+        int32_t res = Transport::read(ctx_, Reg, data, Len);
+        xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_COMM_DELAY_MS);
+
+        return res;
+    }
+
+    /** Writes Len registers from Reg on */
+    template<uint8_t Reg, uint8_t Len = 1U>
+    int32_t set_reg(const uint8_t *data) const noexcept {
+        check_access<Reg, Len>();
+        int32_t res = Transport::write(ctx_, Reg, data, Len);
+        xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_COMM_DELAY_MS);
+
+        return res;
+    }
+
+    /** Reads a register field */
+    template<typename Field>
+    int32_t get_field(uint8_t &val) const noexcept {
+        uint8_t reg;
+        int32_t res = get_reg<Field::reg>(&reg);
+        val = (uint8_t)((reg & Field::mask) >> Field::pos);
+
+        return res;
+    }
+
+    /** Sets a register field to Val, by read-modify-write of its register */
+    template<typename Field, uint8_t Val>
+    int32_t set_field() const noexcept {
+        static_assert(Val <= Field::max, "Value exceeds the field width");
+
+        uint8_t reg;
+        int32_t res = get_reg<Field::reg>(&reg);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            reg = (uint8_t)((reg & (uint8_t)~Field::mask) | (uint8_t)(Val << Field::pos));
+            res = set_reg<Field::reg>(&reg);
+        }
+
+        return res;
+    }
+
+    /** Sends a command to SENS_RST */
+    int32_t cmd(uint8_t cmd) const noexcept {
+        return set_reg<Regs::sens_rst>(&cmd);
+    }
+
+    /** Checks the communication, resets the sensor and checks that it is ready, see \ref xensiv_pas_gas_co2_init */
+    int32_t init() const noexcept {
+        uint8_t data = 0xA5U;
+        int32_t res = set_reg<Regs::scratch_pad>(&data);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = get_reg<Regs::scratch_pad>(&data);
+        }
+
+        if ((XENSIV_PAS_GAS_OK != res) || (0xA5U != data)) {
+            return XENSIV_PAS_GAS_ERR_COMM;
+        }
+
+        res = cmd((uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET);
+        xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_SOFT_RESET_DELAY_MS);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = get_reg<Regs::sens_sts>(&data);
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            if ((data & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U) {
+                res = XENSIV_PAS_GAS_ICCERR;
+            } else if ((data & XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK) != 0U) {
+                res = XENSIV_PAS_GAS_ORVS;
+            } else if ((data & XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK) != 0U) {
+                res = XENSIV_PAS_GAS_ORTMP;
+            } else if ((data & XENSIV_PAS_GAS_REG_SENS_STS_SEN_RDY_MSK) == 0U) {
+                res = XENSIV_PAS_GAS_ERR_NOT_READY;
+            } else {
+                /* Ready */
+            }
+        }
+
+        return res;
+    }
+
+    /** Reads a gas concentration result, see \ref xensiv_pas_gas_get_result */
+    int32_t get_result(uint16_t &val) const noexcept {
+        uint8_t meas_sts;
+        int32_t res = get_reg<Regs::meas_sts>(&meas_sts);
+
+        if ((XENSIV_PAS_GAS_OK == res) && ((meas_sts & Regs::drdy::mask) == 0U)) {
+            res = XENSIV_PAS_GAS_READ_NRDY;
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            uint8_t buf[2];
+            res = get_reg<Regs::gasconc_h, 2U>(buf);
+            val = (uint16_t)(((uint16_t)buf[0] << 8U) | buf[1]);
+        }
+
+        return res;
+    }
+
+    /** Writes the measurement rate, see \ref xensiv_pas_gas_set_measurement_rate */
+    template<uint16_t RateS>
+    int32_t set_measurement_rate() const noexcept {
+        static_assert((RateS >= Regs::meas_rate_min) && (RateS <= Regs::meas_rate_max), "Measurement rate out of range for the variant");
+
+        return write_u16<Regs::meas_rate_h>(RateS);
+    }
+
+    /** Writes the alarm threshold, see \ref xensiv_pas_gas_set_alarm_threshold */
+    int32_t set_alarm_threshold(uint16_t val) const noexcept {
+        return write_u16<Regs::alarm_th_h>(val);
+    }
+
+    /** Writes the pressure compensation, see \ref xensiv_pas_gas_set_pressure_compensation */
+    int32_t set_pressure_compensation(uint16_t val) const noexcept {
+        return write_u16<Regs::press_ref_h>(val);
+    }
+
+    /** Starts a single measurement, see \ref xensiv_pas_gas_start_single_mode */
+    int32_t start_single_mode() const noexcept {
+        uint8_t meas_cfg;
+        int32_t res = idle(meas_cfg);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = set_op_mode(meas_cfg, XENSIV_PAS_GAS_OP_MODE_SINGLE);
+        }
+
+        return res;
+    }
+
+    /** Starts the continuous mode with the automatic BOC, see \ref xensiv_pas_gas_start_continuous_mode */
+    template<uint16_t RateS>
+    int32_t start_continuous_mode() const noexcept {
+        uint8_t meas_cfg;
+        int32_t res = idle(meas_cfg);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = set_measurement_rate<RateS>();
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            meas_cfg = (uint8_t)((meas_cfg & (uint8_t)~Regs::boc_cfg::mask) | (uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << Regs::boc_cfg::pos));
+            res = set_op_mode(meas_cfg, XENSIV_PAS_GAS_OP_MODE_CONTINUOUS);
+        }
+
+        return res;
+    }
+
+    /**
+     * Performs a forced compensation at the FCS rate of the variant, see \ref xensiv_pas_gas_async_forced_compensation.
+     * Returns \ref XENSIV_PAS_GAS_TIMEOUT, with the sensor set to idle with the automatic BOC, if the sensor
+     * does not clear the forced BOC in time.
+     */
+    int32_t perform_forced_compensation(uint16_t gas_ref) const noexcept {
+        uint8_t meas_cfg;
+        int32_t res = idle(meas_cfg);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = set_measurement_rate<Regs::fcs_meas_rate_s>();
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = write_u16<Regs::calib_ref_h>(gas_ref);
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            meas_cfg = (uint8_t)((meas_cfg & (uint8_t)~Regs::boc_cfg::mask) | (uint8_t)(XENSIV_PAS_GAS_BOC_CFG_FORCED << Regs::boc_cfg::pos));
+            res = set_op_mode(meas_cfg, XENSIV_PAS_GAS_OP_MODE_CONTINUOUS);
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            /* wait until the FCS is finished */
+            uint8_t fcs_cfg = meas_cfg;
+            uint32_t polls = 0U;
+            do
+            {
+                xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_ASYNC_FCS_POLL_MS);
+                res = get_reg<Regs::meas_cfg>(&meas_cfg);
+            } while (((XENSIV_PAS_GAS_OK != res) || is_forced(meas_cfg)) && (++polls < fcs_max_polls));
+
+            if ((XENSIV_PAS_GAS_OK != res) || is_forced(meas_cfg)) {
+                /* Abandon the FCS, as the non-blocking operation does */
+                meas_cfg = (uint8_t)((fcs_cfg & (uint8_t)~Regs::boc_cfg::mask) | (uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << Regs::boc_cfg::pos));
+                (void)set_op_mode(meas_cfg, XENSIV_PAS_GAS_OP_MODE_IDLE);
+                res = XENSIV_PAS_GAS_TIMEOUT;
+            } else {
+                res = set_op_mode(meas_cfg, XENSIV_PAS_GAS_OP_MODE_IDLE);
+            }
+        }
+
+        return res;
+    }
+
+private:
+    /* Number of MEAS_CFG reads of the forced compensation before it is abandoned */
+    static constexpr uint32_t fcs_max_polls = ((uint32_t)XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES * Regs::fcs_meas_rate_s * 1000U) /
+                                              (XENSIV_PAS_GAS_ASYNC_FCS_POLL_MS + XENSIV_PAS_GAS_COMM_DELAY_MS);
+
+    static constexpr bool is_forced(uint8_t meas_cfg) noexcept {
+        return ((meas_cfg & Regs::boc_cfg::mask) >> Regs::boc_cfg::pos) == XENSIV_PAS_GAS_BOC_CFG_FORCED;
+    }
+
+    template<uint8_t Reg, uint8_t Len>
+    static constexpr void check_access() noexcept {
+        static_assert(Len > 0U, "Empty register access");
+        static_assert(Len <= Transport::max_len, "Burst too long for the transport");
+        static_assert(Reg <= Transport::max_reg, "Register not reachable through the transport");
+    }
+
+    template<uint8_t Reg>
+    int32_t write_u16(uint16_t val) const noexcept {
+        uint8_t buf[2] = { (uint8_t)(val >> 8U), (uint8_t)(val & 0xFFU) };
+
+        return set_reg<Reg, 2U>(buf);
+    }
+
+    /* Reads MEAS_CFG and sets the sensor to idle if a measurement mode is active */
+    int32_t idle(uint8_t &meas_cfg) const noexcept {
+        int32_t res = get_reg<Regs::meas_cfg>(&meas_cfg);
+
+        if ((XENSIV_PAS_GAS_OK == res) && ((meas_cfg & Regs::op_mode::mask) != 0U)) {
+            res = set_op_mode(meas_cfg, XENSIV_PAS_GAS_OP_MODE_IDLE);
+        }
+
+        return res;
+    }
+
+    int32_t set_op_mode(uint8_t &meas_cfg, xensiv_pas_gas_op_mode_t op_mode) const noexcept {
+        meas_cfg = (uint8_t)((meas_cfg & (uint8_t)~Regs::op_mode::mask) | (uint8_t)(op_mode << Regs::op_mode::pos));
+
+        return set_reg<Regs::meas_cfg>(&meas_cfg);
+    }
+
+    context *ctx_;
+};
+} /* namespace detail */
+
+/** XENSIV™ PAS CO2 sensor */
+template<typename Transport>
+class pas_co2 : public detail::pas_sensor<Transport, co2_regs>
+{
+    using base = detail::pas_sensor<Transport, co2_regs>;
+
+public:
+    using base::base;
+
+    /** Performs a forced compensation and saves the offset, see \ref xensiv_pas_gas_perform_forced_compensation */
+    int32_t perform_forced_compensation(uint16_t gas_ref) const noexcept {
+        int32_t res = base::perform_forced_compensation(gas_ref);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            res = base::cmd((uint8_t)XENSIV_PAS_GAS_CO2_CMD_SAVE_FCS_CALIB_OFFSET);
+        }
+
+        return res;
+    }
+};
+
+/** XENSIV™ PAS R290 sensor */
+template<typename Transport>
+class pas_r290 : public detail::pas_sensor<Transport, r290_regs>
+{
+    using base = detail::pas_sensor<Transport, r290_regs>;
+
+public:
+    using base::base;
+
+    /** Reads the self test flags, see \ref xensiv_pas_gas_r290_get_self_test */
+    int32_t get_self_test(uint8_t &self_test) const noexcept {
+        return base::template get_reg<r290_regs::self_test>(&self_test);
+    }
+};
+
+/** XENSIV™ PAS A2L sensor */
+template<typename Transport>
+class pas_a2l : public detail::pas_sensor<Transport, a2l_regs>
+{
+    using base = detail::pas_sensor<Transport, a2l_regs>;
+
+public:
+    using base::base;
+
+    /** Reads the self test flags, see \ref xensiv_pas_gas_a2l_get_self_test */
+    int32_t get_self_test(uint8_t &self_test) const noexcept {
+        return base::template get_reg<a2l_regs::self_test>(&self_test);
+    }
+
+    /** Writes the alarm hysteresis, see \ref xensiv_pas_gas_a2l_set_alarm_hysteresis */
+    template<uint16_t Hys>
+    int32_t set_alarm_hysteresis() const noexcept {
+        static_assert(Hys <= a2l_regs::alarm_hys_max, "Alarm hysteresis exceeds the field width");
+
+        uint8_t buf[2] = { (uint8_t)(Hys >> 8U), (uint8_t)(Hys & 0xFFU) };
+        return base::template set_reg<a2l_regs::alarm_hys_h, 2U>(buf);
+    }
+
+    /**
+     * Writes the absolute humidity reference in a single burst, see \ref xensiv_pas_gas_a2l_set_absolute_humidity_ref.
+     * The value is measured at runtime, above \ref xensiv_pas_gas::a2l_regs::abs_hum_ref_max it is rejected with
+     * XENSIV_PAS_GAS_INVALID_PARAMETER.
+     */
+    int32_t set_absolute_humidity_ref(uint16_t abs_hum_ref) const noexcept {
+        if (abs_hum_ref > a2l_regs::abs_hum_ref_max) {
+            return XENSIV_PAS_GAS_INVALID_PARAMETER;
+        }
+
+        uint8_t buf[2] = { (uint8_t)(abs_hum_ref >> 8U), (uint8_t)(abs_hum_ref & 0xFFU) };
+        return base::template set_reg<a2l_regs::abs_hum_ref_h, 2U>(buf);
+    }
+
+    /** Saves the configuration into the non-volatile memory, see \ref xensiv_pas_gas_a2l_save_config */
+    int32_t save_config() const noexcept {
+        uint8_t val = (uint8_t)XENSIV_PAS_GAS_A2L_REG_CFG_SAVE_VAL_MASK;
+        int32_t res = base::template set_reg<a2l_regs::cfg_save>(&val);
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            /* The sensor does not respond while writing its non-volatile memory */
+            xensiv_pas_gas_plat_delay(XENSIV_PAS_GAS_A2L_CFG_SAVE_DELAY_MS);
+        }
+
+        return res;
+    }
+};
+} /* namespace xensiv_pas_gas */
+
+/** \} group_board_libs_variants */
+
+#endif /* XENSIV_PAS_GAS_VARIANTS_HPP_ */
@@ -0,0 +1,136 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_async_test.c
+ *
+ * Description: Tests of the non-blocking operations, including the timeout of the forced compensation.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+
+#define XENSIV_PAS_GAS_ASYNC_TEST_GAS            (420U)
+
+/* MEAS_CFG of an idle sensor with the automatic BOC */
+#define XENSIV_PAS_GAS_ASYNC_TEST_CFG_IDLE       ((uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS))
+
+static void xensiv_pas_gas_async_test_read(xensiv_pas_gas_variant_t variant, xensiv_pas_gas_interface_t itf) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_async_t op;
+    uint16_t val = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, variant);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_ASYNC_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_async_init(&op, &dev, variant, itf, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(variant, dev.variant);
+
+    /* No result before a measurement */
+    xensiv_pas_gas_async_read_result(&op, &dev, &val);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_test_run_async(&op));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_continuous_mode(&dev, 10U));
+    xensiv_pas_gas_emul_advance_us(15000000U);
+    xensiv_pas_gas_async_read_result(&op, &dev, &val);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ASYNC_TEST_GAS, val);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_async_test_retry(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_async_t op;
+    xensiv_pas_gas_retry_policy_t policy;
+    uint8_t prod_id = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_CO2);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_async_init(&op, &dev, XENSIV_PAS_GAS_VARIANT_CO2, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    xensiv_pas_gas_get_default_retry_policy(&policy);
+    xensiv_pas_gas_set_retry_policy(&dev, &policy);
+
+    /* The retries wait for their back-off without blocking */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, policy.max_attempts - 1U);
+    xensiv_pas_gas_emul_reset_bus_stats();
+    xensiv_pas_gas_async_get_reg(&op, &dev, (uint8_t)XENSIV_PAS_GAS_REG_PROD_ID, &prod_id, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_PROD_ID), prod_id);
+    xensiv_pas_gas_emul_bus_stats_t stats;
+    xensiv_pas_gas_emul_get_bus_stats(&stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, stats.delays);
+
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, policy.max_attempts);
+    xensiv_pas_gas_async_get_reg(&op, &dev, (uint8_t)XENSIV_PAS_GAS_REG_PROD_ID, &prod_id, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_test_run_async(&op));
+
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, 0U);
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_async_test_forced_compensation(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_async_t op;
+
+    /* The CO2 variant saves the offset to the non-volatile memory */
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_CO2);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_ASYNC_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_async_init(&op, &dev, XENSIV_PAS_GAS_VARIANT_CO2, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    xensiv_pas_gas_async_forced_compensation(&op, &dev, 500U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    uint8_t meas_cfg = xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OP_MODE_IDLE, meas_cfg & XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK);
+    XENSIV_PAS_GAS_TEST_CHECK((meas_cfg & XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_MSK) !=
+                              (XENSIV_PAS_GAS_BOC_CFG_FORCED << XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS));
+    XENSIV_PAS_GAS_TEST_CHECK(emul.fcs_offset != 0);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(emul.fcs_offset, emul.nvm_fcs_offset);
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    /* A sensor which never completes is abandoned after the timeout, left idle with the automatic BOC */
+    xensiv_pas_gas_emul_timing_t timing;
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_get_default_timing(&timing);
+    timing.fcs_cycles = 200U;
+    xensiv_pas_gas_emul_set_timing(&emul, &timing);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_async_init(&op, &dev, XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    uint64_t timeout_us = (uint64_t)XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES * dev.fcs_meas_rate_s * 1000000U;
+    xensiv_pas_gas_async_forced_compensation(&op, &dev, 500U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_TIMEOUT, xensiv_pas_gas_test_run_async(&op));
+    uint64_t elapsed_us = xensiv_pas_gas_emul_now_us() - start_us;
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us >= timeout_us);
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us <= (timeout_us + ((uint64_t)dev.fcs_meas_rate_s * 1000000U)));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ASYNC_TEST_CFG_IDLE, xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG));
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    xensiv_pas_gas_async_test_read(XENSIV_PAS_GAS_VARIANT_CO2, XENSIV_PAS_GAS_INTERFACE_I2C);
+    xensiv_pas_gas_async_test_read(XENSIV_PAS_GAS_VARIANT_R290, XENSIV_PAS_GAS_INTERFACE_I2C);
+    xensiv_pas_gas_async_test_read(XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_I2C);
+    xensiv_pas_gas_async_test_read(XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_UART);
+    xensiv_pas_gas_async_test_retry();
+    xensiv_pas_gas_async_test_forced_compensation();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,192 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_co2_pwm_test.c
+ *
+ * Description: Tests of the CO2 PWM configuration, the single-pulse and pulse-train decoders and the
+ *              capture replay.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_co2_pwm.h"
+#include "src/xensiv_pas_gas_co2_pwm_replay.h"
+
+/* Concentration of the emulated sensor, a whole number of microseconds at the default period and full scale */
+#define XENSIV_PAS_GAS_CO2_PWM_TEST_GAS          (625U)
+
+/* Capture file, written to the working directory of the test */
+#define XENSIV_PAS_GAS_CO2_PWM_TEST_FILE         "xensiv_pas_gas_co2_pwm_test.txt"
+
+/* High time of a concentration at a period, as output by the sensor */
+static uint64_t xensiv_pas_gas_co2_pwm_test_high_us(const xensiv_pas_gas_co2_pwm_config_t *config, uint16_t ppm, uint64_t period_us) {
+    return ((uint64_t)ppm * period_us) / config->full_scale_ppm;
+}
+
+/* Reads the concentration of the emulated sensor after a measurement, with the PWM output enabled */
+static uint16_t xensiv_pas_gas_co2_pwm_test_sensor(xensiv_pas_gas_co2_pwm_mode_t mode) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    uint16_t val = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_CO2);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_CO2_PWM_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_set_pwm_config(&dev, mode, true));
+
+    uint8_t meas_cfg = xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG);
+    XENSIV_PAS_GAS_TEST_CHECK((meas_cfg & XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_OUTEN_MSK) != 0U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(mode, (meas_cfg & XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_MODE_MSK) >> XENSIV_PAS_GAS_CO2_REG_MEAS_CFG_PWM_MODE_POS);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_continuous_mode(&dev, 10U));
+    xensiv_pas_gas_emul_advance_us(15000000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_result(&dev, &val));
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    return val;
+}
+
+static void xensiv_pas_gas_co2_pwm_test_single_pulse(void) {
+    xensiv_pas_gas_co2_pwm_config_t config;
+    xensiv_pas_gas_co2_pwm_t dec;
+    uint16_t ppm = 0U;
+
+    xensiv_pas_gas_co2_pwm_get_default_config(&config);
+    config.period_us = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_co2_pwm_init(&dec, &config));
+    xensiv_pas_gas_co2_pwm_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_init(&dec, &config));
+
+    uint16_t gas = xensiv_pas_gas_co2_pwm_test_sensor(XENSIV_PAS_GAS_CO2_PWM_MODE_SINGLE_PULSE);
+    uint64_t high_us = xensiv_pas_gas_co2_pwm_test_high_us(&config, gas, config.period_us);
+
+    /* A capture starting in the middle of a pulse only decodes the next one */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 1000U, false, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 5000U, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 5001U, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 5000U + high_us, false, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(gas, ppm);
+
+    /* A glitch shorter than min_pulse_us and a pulse longer than the period are discarded */
+    ppm = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 20000U, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 20001U, false, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 30000U, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, 30001U + config.period_us, false, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, ppm);
+}
+
+static void xensiv_pas_gas_co2_pwm_test_train(void) {
+    xensiv_pas_gas_co2_pwm_config_t config;
+    xensiv_pas_gas_co2_pwm_t dec;
+    uint16_t ppm = 0U;
+
+    xensiv_pas_gas_co2_pwm_get_default_config(&config);
+    config.mode = XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_init(&dec, &config));
+
+    uint16_t gas = xensiv_pas_gas_co2_pwm_test_sensor(XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE);
+
+    /* The period is measured, so a sensor clock 12.5 % slow gives the same concentration */
+    uint64_t period_us = ((uint64_t)config.period_us * 9U) / 8U;
+    uint64_t high_us = xensiv_pas_gas_co2_pwm_test_high_us(&config, gas, period_us);
+    uint64_t t_us = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us + high_us, false, &ppm));
+    t_us += period_us;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(gas, ppm);
+
+    /* A period beyond period_tolerance_pct, e.g. a missed edge, is discarded */
+    ppm = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us + high_us, false, &ppm));
+    t_us += 2U * period_us;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, ppm);
+
+    /* Decoding resumes with the next regular period */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us + high_us, false, &ppm));
+    t_us += period_us;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_decode_edge(&dec, t_us, true, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(gas, ppm);
+}
+
+/* Writes a capture of a pulse train changing from one concentration to another, with comments and empty lines */
+static void xensiv_pas_gas_co2_pwm_test_write_capture(const xensiv_pas_gas_co2_pwm_config_t *config, uint16_t from_ppm, uint16_t to_ppm,
+                                                      unsigned periods, const char *tail) {
+    FILE *file = fopen(XENSIV_PAS_GAS_CO2_PWM_TEST_FILE, "w");
+    XENSIV_PAS_GAS_TEST_CHECK(file != NULL);
+    if (file == NULL) {
+        return;
+    }
+
+    (void)fprintf(file, "# time_us level\n\n");
+    for (unsigned i = 0U; i < periods; ++i)
+    {
+        uint64_t t_us = 100U + ((uint64_t)i * config->period_us);
+        uint16_t ppm = (i < (periods / 2U)) ? from_ppm : to_ppm;
+        (void)fprintf(file, "%llu 1\n%llu 0\n", (unsigned long long)t_us,
+                      (unsigned long long)(t_us + xensiv_pas_gas_co2_pwm_test_high_us(config, ppm, config->period_us)));
+    }
+    (void)fputs(tail, file);
+    (void)fclose(file);
+}
+
+static void xensiv_pas_gas_co2_pwm_test_replay(void) {
+    xensiv_pas_gas_co2_pwm_config_t config;
+    xensiv_pas_gas_co2_pwm_t dec;
+    xensiv_pas_gas_co2_pwm_replay_t replay;
+    uint16_t ppm = 0U;
+
+    xensiv_pas_gas_co2_pwm_get_default_config(&config);
+    config.mode = XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_init(&dec, &config));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_co2_pwm_replay_open(&replay, "missing/" XENSIV_PAS_GAS_CO2_PWM_TEST_FILE));
+
+    /* More edges than a single capture call fetches; the latest concentration is returned */
+    uint16_t gas = xensiv_pas_gas_co2_pwm_test_sensor(XENSIV_PAS_GAS_CO2_PWM_MODE_TRAIN_PULSE);
+    xensiv_pas_gas_co2_pwm_test_write_capture(&config, 2500U, gas, 2U * XENSIV_PAS_GAS_CO2_PWM_CAPTURE_LEN, "\n");
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_replay_open(&replay, XENSIV_PAS_GAS_CO2_PWM_TEST_FILE));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_read(&dec, &replay, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(gas, ppm);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(2U + (4U * XENSIV_PAS_GAS_CO2_PWM_CAPTURE_LEN) + 1U, xensiv_pas_gas_co2_pwm_replay_get_line(&replay));
+
+    /* Nothing left to decode */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_co2_pwm_read(&dec, &replay, &ppm));
+    xensiv_pas_gas_co2_pwm_replay_close(&replay);
+
+    /* A malformed line stops the replay at that line, the pulses before it are decoded */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_init(&dec, &config));
+    ppm = 0U;
+    xensiv_pas_gas_co2_pwm_test_write_capture(&config, gas, gas, 4U, "1000000 2\n");
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_pwm_replay_open(&replay, XENSIV_PAS_GAS_CO2_PWM_TEST_FILE));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_co2_pwm_read(&dec, &replay, &ppm));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(gas, ppm);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(2U + (2U * 4U) + 1U, xensiv_pas_gas_co2_pwm_replay_get_line(&replay));
+    xensiv_pas_gas_co2_pwm_replay_close(&replay);
+
+    (void)remove(XENSIV_PAS_GAS_CO2_PWM_TEST_FILE);
+}
+
+int main(void) {
+    xensiv_pas_gas_co2_pwm_test_single_pulse();
+    xensiv_pas_gas_co2_pwm_test_train();
+    xensiv_pas_gas_co2_pwm_test_replay();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,136 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_config_test.c
+ *
+ * Description: Tests of the configuration profiles: register diff on apply, snapshot and restore.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_config.h"
+
+static void xensiv_pas_gas_config_test_apply(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_config_t profile;
+    xensiv_pas_gas_config_t current;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+
+    memset(&profile, 0, sizeof(profile));
+    profile.fields = XENSIV_PAS_GAS_CONFIG_MEAS_RATE | XENSIV_PAS_GAS_CONFIG_ALARM_TH | XENSIV_PAS_GAS_CONFIG_GAS_SEL |
+                     XENSIV_PAS_GAS_CONFIG_ALARM_HYS;
+    profile.meas_rate = 30U;
+    profile.alarm_threshold = 1500U;
+    profile.gas_sel = (uint8_t)XENSIV_PAS_GAS_A2L_GAS_R32;
+    profile.alarm_hysteresis = 100U;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_config_apply(&dev, &profile));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_config_read(&dev, profile.fields, &current));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(30U, current.meas_rate);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1500U, current.alarm_threshold);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R32, current.gas_sel);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(100U, current.alarm_hysteresis);
+
+    /* Applying the same profile again only reads */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_config_apply(&dev, &profile));
+    uint32_t reads = xensiv_pas_gas_test_transfers();
+
+    /* A single changed field costs a single write */
+    profile.alarm_threshold = 1600U;
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_config_apply(&dev, &profile));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(reads + 1U, xensiv_pas_gas_test_transfers());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1600U, xensiv_pas_gas_test_peek16(&emul, (uint8_t)XENSIV_PAS_GAS_REG_ALARM_TH_H));
+
+    /* Fields and modes the profile cannot hold are rejected */
+    profile.fields = XENSIV_PAS_GAS_CONFIG_MEAS_CFG;
+    profile.meas_cfg.u = 0U;
+    profile.meas_cfg.b.op_mode = XENSIV_PAS_GAS_OP_MODE_SINGLE;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_config_apply(&dev, &profile));
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_config_test_snapshot(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_emul_t other;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_t dev_other;
+    uint8_t snap[XENSIV_PAS_GAS_CONFIG_SNAPSHOT_MAX_SIZE];
+    size_t len = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_alarm_threshold(&dev, 1234U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_set_alarm_hysteresis(&dev, 55U));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_config_snapshot(&dev, snap, 4U, &len));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_config_snapshot(&dev, snap, sizeof(snap), &len));
+    XENSIV_PAS_GAS_TEST_CHECK((len > 5U) && (len <= sizeof(snap)));
+
+    /* Restored to a replacement sensor of the same variant */
+    xensiv_pas_gas_emul_init(&other, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev_other, XENSIV_PAS_GAS_INTERFACE_I2C, &other));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_config_restore(&dev_other, snap, len));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1234U, xensiv_pas_gas_test_peek16(&other, (uint8_t)XENSIV_PAS_GAS_REG_ALARM_TH_H));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(55U, xensiv_pas_gas_test_peek16(&other, (uint8_t)XENSIV_PAS_GAS_A2L_REG_ALARM_HYS_H));
+
+    /* A corrupted snapshot is rejected without accessing the sensor */
+    snap[len - 2U] ^= 0x01U;
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_config_restore(&dev_other, snap, len));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+    snap[len - 2U] ^= 0x01U;
+
+    /* So is a well-formed blob holding a block no snapshot holds, e.g. a SENS_RST command */
+    uint8_t crafted[8] = { snap[0], snap[1], snap[2], 1U, (uint8_t)XENSIV_PAS_GAS_REG_SENS_RST, 1U, (uint8_t)XENSIV_PAS_GAS_CMD_SOFT_RESET, 0U };
+    crafted[7] = xensiv_pas_gas_crc8(crafted, 7U);
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_config_restore(&dev_other, crafted, sizeof(crafted)));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+
+    xensiv_pas_gas_emul_deinit(&other);
+
+    /* A snapshot of another variant is rejected */
+    xensiv_pas_gas_emul_init(&other, XENSIV_PAS_GAS_VARIANT_CO2);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev_other, XENSIV_PAS_GAS_INTERFACE_I2C, &other));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_config_restore(&dev_other, snap, len));
+    xensiv_pas_gas_emul_deinit(&other);
+
+    /* The A2L registers are out of reach over UART */
+    xensiv_pas_gas_emul_init(&other, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev_other, XENSIV_PAS_GAS_INTERFACE_UART, &other));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_config_restore(&dev_other, snap, len));
+    xensiv_pas_gas_emul_deinit(&other);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    xensiv_pas_gas_config_test_apply();
+    xensiv_pas_gas_config_test_snapshot();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,212 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_coro_test.cpp
+ *
+ * Description: Runs the coroutine layer against the emulator: value propagation through nested tasks,
+ * the order of the timers and the sensor operations of several sensors on one executor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <vector>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_coro.hpp"
+
+#define XENSIV_PAS_GAS_CORO_TEST_SENSORS         (3U)
+#define XENSIV_PAS_GAS_CORO_TEST_GAS             (600U)
+#define XENSIV_PAS_GAS_CORO_TEST_RATE_S          (10U)
+
+/* MEAS_CFG of an idle sensor with the automatic BOC */
+#define XENSIV_PAS_GAS_CORO_TEST_CFG_IDLE        ((uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS))
+
+namespace
+{
+
+xensiv_pas_gas::task<int> xensiv_pas_gas_coro_test_wait(xensiv_pas_gas::executor &exec, uint32_t ms, int val) {
+    co_await exec.sleep_for_ms(ms);
+    co_return val;
+}
+
+xensiv_pas_gas::task<int> xensiv_pas_gas_coro_test_sum(xensiv_pas_gas::executor &exec) {
+    int a = co_await xensiv_pas_gas_coro_test_wait(exec, 10U, 2);
+    int b = co_await xensiv_pas_gas_coro_test_wait(exec, 20U, 3);
+    co_return a * b;
+}
+
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_test_product(xensiv_pas_gas::executor &exec, int &out) {
+    out = co_await xensiv_pas_gas_coro_test_sum(exec);
+}
+
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_test_sleeper(xensiv_pas_gas::executor &exec, uint32_t ms, std::vector<uint32_t> &order) {
+    co_await exec.sleep_for_ms(ms);
+    order.push_back(ms);
+}
+
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_test_measure(xensiv_pas_gas::sensor &sensor, xensiv_pas_gas_emul_t *emul, int32_t &res, uint16_t &val) {
+    res = co_await sensor.init(XENSIV_PAS_GAS_VARIANT_A2L, XENSIV_PAS_GAS_INTERFACE_I2C, emul);
+    if (XENSIV_PAS_GAS_OK != res) {
+        co_return;
+    }
+
+    res = xensiv_pas_gas_start_single_mode(sensor.get());
+    if (XENSIV_PAS_GAS_OK != res) {
+        co_return;
+    }
+
+    co_await sensor.get_executor().sleep_for_ms(XENSIV_PAS_GAS_CORO_TEST_RATE_S * 1000U);
+    std::pair<int32_t, uint16_t> result = co_await sensor.read_result();
+    res = result.first;
+    val = result.second;
+}
+
+xensiv_pas_gas::task<void> xensiv_pas_gas_coro_test_fcs(xensiv_pas_gas::sensor &sensor, int32_t &res) {
+    res = co_await sensor.forced_compensation(XENSIV_PAS_GAS_CORO_TEST_GAS);
+}
+
+/* A value returned by a nested task reaches the awaiting coroutine */
+void xensiv_pas_gas_coro_test_task() {
+    xensiv_pas_gas::executor exec;
+    int out = 0;
+
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    exec.spawn(xensiv_pas_gas_coro_test_product(exec, out));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, exec.waiting());
+    exec.run();
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(6, out);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, exec.waiting());
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_emul_now_us() - start_us >= 30000U);
+}
+
+/* The coroutines are resumed in the order of their due time, whatever the order they were spawned in */
+void xensiv_pas_gas_coro_test_order() {
+    xensiv_pas_gas::executor exec;
+    std::vector<uint32_t> order;
+
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    exec.spawn(xensiv_pas_gas_coro_test_sleeper(exec, 30U, order));
+    exec.spawn(xensiv_pas_gas_coro_test_sleeper(exec, 10U, order));
+    exec.spawn(xensiv_pas_gas_coro_test_sleeper(exec, 20U, order));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, exec.waiting());
+    exec.run();
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, order.size());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(10U, order[0]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(20U, order[1]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(30U, order[2]);
+
+    /* The waits overlap */
+    uint64_t elapsed_us = xensiv_pas_gas_emul_now_us() - start_us;
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us >= 30000U);
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us < 40000U);
+}
+
+/* Several sensors on one executor initialize and measure concurrently */
+void xensiv_pas_gas_coro_test_sensors() {
+    xensiv_pas_gas::executor exec;
+    std::vector<xensiv_pas_gas_emul_t> emuls(XENSIV_PAS_GAS_CORO_TEST_SENSORS);
+    std::vector<xensiv_pas_gas::sensor> sensors(XENSIV_PAS_GAS_CORO_TEST_SENSORS, xensiv_pas_gas::sensor(exec));
+    std::vector<int32_t> res(XENSIV_PAS_GAS_CORO_TEST_SENSORS, XENSIV_PAS_GAS_PENDING);
+    std::vector<uint16_t> val(XENSIV_PAS_GAS_CORO_TEST_SENSORS, 0U);
+
+    for (size_t i = 0U; i < emuls.size(); ++i)
+    {
+        xensiv_pas_gas_emul_init(&emuls[i], XENSIV_PAS_GAS_VARIANT_A2L);
+        xensiv_pas_gas_emul_set_gas(&emuls[i], (uint16_t)(XENSIV_PAS_GAS_CORO_TEST_GAS + i));
+    }
+
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    for (size_t i = 0U; i < sensors.size(); ++i)
+    {
+        exec.spawn(xensiv_pas_gas_coro_test_measure(sensors[i], &emuls[i], res[i], val[i]));
+    }
+    exec.run();
+
+    for (size_t i = 0U; i < sensors.size(); ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, res[i]);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_CORO_TEST_GAS + i, val[i]);
+    }
+
+    /* One measurement period for all the sensors, not one each */
+    uint64_t elapsed_us = xensiv_pas_gas_emul_now_us() - start_us;
+    uint64_t period_us = (uint64_t)XENSIV_PAS_GAS_CORO_TEST_RATE_S * 1000000U;
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us >= period_us);
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us < (2U * period_us));
+
+    /* A read without a new measurement completes with its error */
+    exec.spawn([](xensiv_pas_gas::sensor &sensor, int32_t &out) -> xensiv_pas_gas::task<void> {
+        std::pair<int32_t, uint16_t> result = co_await sensor.read_result();
+        out = result.first;
+    }(sensors[0], res[0]));
+    exec.run();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, res[0]);
+
+    for (xensiv_pas_gas_emul_t &emul : emuls)
+    {
+        xensiv_pas_gas_emul_deinit(&emul);
+    }
+}
+
+/* A forced compensation completes, and one the sensor never completes times out after timeout_cycles */
+void xensiv_pas_gas_coro_test_forced_compensation() {
+    xensiv_pas_gas::executor exec;
+    xensiv_pas_gas::sensor sensor(exec);
+    xensiv_pas_gas_emul_t emul;
+    int32_t res = XENSIV_PAS_GAS_PENDING;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(sensor.get(), XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    exec.spawn(xensiv_pas_gas_coro_test_fcs(sensor, res));
+    exec.run();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, res);
+    XENSIV_PAS_GAS_TEST_CHECK(emul.fcs_offset != 0);
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    xensiv_pas_gas_emul_timing_t timing;
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_get_default_timing(&timing);
+    timing.fcs_cycles = 200U;
+    xensiv_pas_gas_emul_set_timing(&emul, &timing);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(sensor.get(), XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+
+    uint64_t period_us = (uint64_t)sensor.get()->fcs_meas_rate_s * 1000000U;
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    res = XENSIV_PAS_GAS_PENDING;
+    exec.spawn(xensiv_pas_gas_coro_test_fcs(sensor, res));
+    exec.run();
+    uint64_t elapsed_us = xensiv_pas_gas_emul_now_us() - start_us;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_TIMEOUT, res);
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us >= ((XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES - 1U) * period_us));
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us <= ((XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES + 1U) * period_us));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_CORO_TEST_CFG_IDLE, xensiv_pas_gas_emul_peek(&emul, XENSIV_PAS_GAS_REG_MEAS_CFG));
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+} /* namespace */
+
+int main() {
+    xensiv_pas_gas_coro_test_task();
+    xensiv_pas_gas_coro_test_order();
+    xensiv_pas_gas_coro_test_sensors();
+    xensiv_pas_gas_coro_test_forced_compensation();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,136 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_early_test.c
+ *
+ * Description: Tests of the EARLY-to-DRDY offset learning of the EARLY driven acquisition.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_early.h"
+
+#define XENSIV_PAS_GAS_EARLY_TEST_RATE_S         (10U)
+#define XENSIV_PAS_GAS_EARLY_TEST_GAS            (321U)
+
+/* Application side of the acquisition: the INT pin edges and the reads */
+typedef struct
+{
+    xensiv_pas_gas_early_t acq;
+    bool edge;
+    uint64_t edge_us;
+    unsigned samples;
+    unsigned errors;
+} xensiv_pas_gas_early_test_app_t;
+
+static void xensiv_pas_gas_early_test_on_int(xensiv_pas_gas_emul_t *emul, bool level, uint64_t time_us, void *arg) {
+    xensiv_pas_gas_early_test_app_t *app = (xensiv_pas_gas_early_test_app_t *)arg;
+    (void)emul;
+
+    /* High active INT pin */
+    if (level) {
+        app->edge = true;
+        app->edge_us = time_us;
+    }
+}
+
+/* Runs the acquisition on the virtual clock for duration_us */
+static void xensiv_pas_gas_early_test_run(xensiv_pas_gas_early_test_app_t *app, uint64_t duration_us) {
+    uint64_t end_us = xensiv_pas_gas_emul_now_us() + duration_us;
+
+    while (xensiv_pas_gas_emul_now_us() < end_us)
+    {
+        uint64_t now_us = xensiv_pas_gas_emul_now_us();
+        uint64_t next_us = xensiv_pas_gas_emul_next_event_us();
+        uint64_t due_us = xensiv_pas_gas_early_get_due_us(&app->acq);
+
+        if (due_us < next_us) {
+            next_us = due_us;
+        }
+        if (next_us > end_us) {
+            next_us = end_us;
+        }
+        xensiv_pas_gas_emul_advance_us((next_us > now_us) ? (next_us - now_us) : 0U);
+
+        if (app->edge) {
+            app->edge = false;
+            (void)xensiv_pas_gas_early_on_edge(&app->acq, app->edge_us);
+        }
+
+        if (xensiv_pas_gas_early_get_due_us(&app->acq) <= xensiv_pas_gas_emul_now_us()) {
+            uint16_t val = 0U;
+            int32_t res = xensiv_pas_gas_early_read(&app->acq, xensiv_pas_gas_emul_now_us(), &val);
+            if (XENSIV_PAS_GAS_OK == res) {
+                XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_EARLY_TEST_GAS, val);
+                app->samples++;
+            } else if (XENSIV_PAS_GAS_READ_NRDY != res) {
+                app->errors++;
+            } else {
+                /* Read again at the new due time */
+            }
+        }
+    }
+}
+
+int main(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_emul_timing_t timing;
+    xensiv_pas_gas_early_config_t config;
+    static xensiv_pas_gas_early_test_app_t app;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_EARLY_TEST_GAS);
+    xensiv_pas_gas_emul_get_default_timing(&timing);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+
+    xensiv_pas_gas_interrupt_config_t int_cfg = { .u = 0U };
+    int_cfg.b.int_typ = XENSIV_PAS_GAS_INTERRUPT_TYPE_HIGH_ACTIVE;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_interrupt_config(&dev, int_cfg));
+    xensiv_pas_gas_emul_set_int_callback(&emul, xensiv_pas_gas_early_test_on_int, &app);
+
+    xensiv_pas_gas_early_get_default_config(&config);
+    config.poll_us = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_early_start(&app.acq, &dev, &config, XENSIV_PAS_GAS_EARLY_TEST_RATE_S));
+    xensiv_pas_gas_early_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_early_start(&app.acq, &dev, &config, XENSIV_PAS_GAS_EARLY_TEST_RATE_S));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_early_get_offset_us(&app.acq));
+
+    /* The offset is learned at the first measurement, within a poll interval of the real one */
+    xensiv_pas_gas_early_test_run(&app, 10ULL * 60ULL * 1000000ULL);
+    uint32_t offset_us = (timing.early_lead_ms + timing.meas_duration_ms) * 1000U;
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_early_get_offset_us(&app.acq) >= (offset_us - config.poll_us));
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_early_get_offset_us(&app.acq) <= (offset_us + config.poll_us));
+    XENSIV_PAS_GAS_TEST_CHECK(app.samples >= 59U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, app.errors);
+
+    /* A slower measurement sequence is followed */
+    timing.meas_duration_ms += 150U;
+    xensiv_pas_gas_emul_set_timing(&emul, &timing);
+    app.samples = 0U;
+    xensiv_pas_gas_early_test_run(&app, 10ULL * 60ULL * 1000000ULL);
+    offset_us = (timing.early_lead_ms + timing.meas_duration_ms) * 1000U;
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_early_get_offset_us(&app.acq) >= (offset_us - config.poll_us));
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_early_get_offset_us(&app.acq) <= (offset_us + config.poll_us));
+    XENSIV_PAS_GAS_TEST_CHECK(app.samples >= 59U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, app.errors);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    return xensiv_pas_gas_test_result();
+}
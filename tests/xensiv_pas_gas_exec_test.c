@@ -0,0 +1,198 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_exec_test.c
+ *
+ * Description: Runs jobs on several emulated buses with the worker threads of the executor: per-bus order
+ *              and mutual exclusion, stealing by idle workers and the resubmission from the callback.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _DEFAULT_SOURCE
+
+#include <unistd.h>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_exec.h"
+
+#define XENSIV_PAS_GAS_EXEC_TEST_WORKERS         (4U)
+#define XENSIV_PAS_GAS_EXEC_TEST_BUSES           (16U)
+#define XENSIV_PAS_GAS_EXEC_TEST_JOBS            (8U)
+
+/* Time a job keeps its bus busy outside of the emulator, so that the other workers run meanwhile */
+#define XENSIV_PAS_GAS_EXEC_TEST_HOLD_US         (2000U)
+
+/* Emulated bus with the record of the jobs run on it */
+typedef struct
+{
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_exec_bus_t bus;
+    xensiv_pas_gas_exec_job_t jobs[XENSIV_PAS_GAS_EXEC_TEST_JOBS];
+    uint8_t order[XENSIV_PAS_GAS_EXEC_TEST_JOBS];
+    uint8_t ran;
+    bool active;
+    bool overlap;
+    uint8_t resubmit;                       /* Number of times the callback submits the last job again */
+} xensiv_pas_gas_exec_test_bus_t;
+
+/* The emulator clock and bus statistics are shared by all emulated sensors, the workers access them in turn */
+static pthread_mutex_t xensiv_pas_gas_exec_test_lock = PTHREAD_MUTEX_INITIALIZER;
+static xensiv_pas_gas_exec_test_bus_t xensiv_pas_gas_exec_test_buses[XENSIV_PAS_GAS_EXEC_TEST_BUSES];
+static xensiv_pas_gas_exec_t xensiv_pas_gas_exec_test_exec;
+static uint32_t xensiv_pas_gas_exec_test_active;
+static uint32_t xensiv_pas_gas_exec_test_max_active;
+
+/* Writes a value specific to the bus and the job to the scratch pad and reads it back */
+static int32_t xensiv_pas_gas_exec_test_job(xensiv_pas_gas_exec_job_t *job) {
+    xensiv_pas_gas_exec_test_bus_t *tb = (xensiv_pas_gas_exec_test_bus_t *)job->arg;
+    uint8_t idx = (uint8_t)(job - tb->jobs);
+    uint8_t val = (uint8_t)(((tb - xensiv_pas_gas_exec_test_buses) << 4U) | idx);
+    uint8_t data = 0U;
+
+    (void)pthread_mutex_lock(&xensiv_pas_gas_exec_test_lock);
+    tb->overlap |= tb->active;
+    tb->active = true;
+    if (tb->ran < XENSIV_PAS_GAS_EXEC_TEST_JOBS) {
+        tb->order[tb->ran] = idx;
+    }
+    tb->ran++;
+    xensiv_pas_gas_exec_test_active++;
+    if (xensiv_pas_gas_exec_test_active > xensiv_pas_gas_exec_test_max_active) {
+        xensiv_pas_gas_exec_test_max_active = xensiv_pas_gas_exec_test_active;
+    }
+
+    int32_t res = xensiv_pas_gas_set_reg(job->dev, XENSIV_PAS_GAS_REG_SCRATCH_PAD, &val, 1U);
+    if (XENSIV_PAS_GAS_OK == res) {
+        res = xensiv_pas_gas_get_reg(job->dev, XENSIV_PAS_GAS_REG_SCRATCH_PAD, &data, 1U);
+    }
+    if ((XENSIV_PAS_GAS_OK == res) && (val != data)) {
+        res = XENSIV_PAS_GAS_ERR_COMM;
+    }
+    (void)pthread_mutex_unlock(&xensiv_pas_gas_exec_test_lock);
+
+    (void)usleep(XENSIV_PAS_GAS_EXEC_TEST_HOLD_US);
+
+    (void)pthread_mutex_lock(&xensiv_pas_gas_exec_test_lock);
+    xensiv_pas_gas_exec_test_active--;
+    tb->active = false;
+    (void)pthread_mutex_unlock(&xensiv_pas_gas_exec_test_lock);
+
+    return res;
+}
+
+/* Submits the job again from the worker thread while resubmissions are left */
+static void xensiv_pas_gas_exec_test_done(xensiv_pas_gas_exec_job_t *job, int32_t res) {
+    xensiv_pas_gas_exec_test_bus_t *tb = (xensiv_pas_gas_exec_test_bus_t *)job->arg;
+
+    if ((XENSIV_PAS_GAS_OK == res) && (tb->resubmit > 0U)) {
+        tb->resubmit--;
+        xensiv_pas_gas_exec_submit(&xensiv_pas_gas_exec_test_exec, &tb->bus, job);
+    }
+}
+
+/* Queues the jobs of the buses whose index is a multiple of step */
+static void xensiv_pas_gas_exec_test_submit(uint8_t step) {
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_EXEC_TEST_BUSES; i += step)
+    {
+        xensiv_pas_gas_exec_test_bus_t *tb = &xensiv_pas_gas_exec_test_buses[i];
+        tb->ran = 0U;
+        for (uint8_t j = 0U; j < XENSIV_PAS_GAS_EXEC_TEST_JOBS; ++j)
+        {
+            xensiv_pas_gas_exec_job_call(&tb->jobs[j], &tb->dev, xensiv_pas_gas_exec_test_job, tb);
+            xensiv_pas_gas_exec_submit(&xensiv_pas_gas_exec_test_exec, &tb->bus, &tb->jobs[j]);
+        }
+    }
+}
+
+/* Checks that the jobs of the buses whose index is a multiple of step ran one at a time and in order */
+static void xensiv_pas_gas_exec_test_check(uint8_t step) {
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_EXEC_TEST_BUSES; i += step)
+    {
+        xensiv_pas_gas_exec_test_bus_t *tb = &xensiv_pas_gas_exec_test_buses[i];
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_EXEC_TEST_JOBS, tb->ran);
+        XENSIV_PAS_GAS_TEST_CHECK(!tb->overlap);
+        for (uint8_t j = 0U; j < XENSIV_PAS_GAS_EXEC_TEST_JOBS; ++j)
+        {
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(j, tb->order[j]);
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, tb->jobs[j].res);
+        }
+    }
+}
+
+int main(void) {
+    static xensiv_pas_gas_exec_worker_t workers[XENSIV_PAS_GAS_EXEC_TEST_WORKERS];
+    xensiv_pas_gas_exec_t *exec = &xensiv_pas_gas_exec_test_exec;
+    xensiv_pas_gas_exec_stats_t stats;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_exec_init(exec, workers, 0U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_exec_init(exec, workers, XENSIV_PAS_GAS_EXEC_TEST_WORKERS));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_EXEC_TEST_WORKERS, exec->num_workers);
+
+    /* The buses are assigned to the workers round robin */
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_EXEC_TEST_BUSES; ++i)
+    {
+        xensiv_pas_gas_exec_test_bus_t *tb = &xensiv_pas_gas_exec_test_buses[i];
+        xensiv_pas_gas_emul_init(&tb->emul, XENSIV_PAS_GAS_VARIANT_A2L);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&tb->dev, XENSIV_PAS_GAS_INTERFACE_I2C, &tb->emul));
+        xensiv_pas_gas_exec_bus_init(exec, &tb->bus);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(i % XENSIV_PAS_GAS_EXEC_TEST_WORKERS, tb->bus.home);
+    }
+
+    /* Only the buses of the first worker have jobs: the other workers steal them and run them in parallel */
+    xensiv_pas_gas_exec_test_submit(XENSIV_PAS_GAS_EXEC_TEST_WORKERS);
+    xensiv_pas_gas_exec_wait(exec);
+    xensiv_pas_gas_exec_test_check(XENSIV_PAS_GAS_EXEC_TEST_WORKERS);
+
+    xensiv_pas_gas_exec_get_stats(exec, &stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((XENSIV_PAS_GAS_EXEC_TEST_BUSES / XENSIV_PAS_GAS_EXEC_TEST_WORKERS) * XENSIV_PAS_GAS_EXEC_TEST_JOBS, stats.jobs);
+    XENSIV_PAS_GAS_TEST_CHECK(stats.steals > 0U);
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_exec_test_max_active > 1U);
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_exec_test_max_active <= XENSIV_PAS_GAS_EXEC_TEST_WORKERS);
+
+    /* All buses, with a job submitted again from its callback */
+    xensiv_pas_gas_exec_test_submit(1U);
+    xensiv_pas_gas_exec_wait(exec);
+    xensiv_pas_gas_exec_test_check(1U);
+
+    xensiv_pas_gas_exec_test_bus_t *tb = &xensiv_pas_gas_exec_test_buses[1];
+    xensiv_pas_gas_exec_job_t *last = &tb->jobs[XENSIV_PAS_GAS_EXEC_TEST_JOBS - 1U];
+    tb->ran = 0U;
+    tb->resubmit = 2U;
+    xensiv_pas_gas_exec_job_call(last, &tb->dev, xensiv_pas_gas_exec_test_job, tb);
+    last->done = xensiv_pas_gas_exec_test_done;
+    xensiv_pas_gas_exec_submit(exec, &tb->bus, last);
+    xensiv_pas_gas_exec_wait(exec);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, tb->ran);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, tb->resubmit);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, last->res);
+
+    uint32_t before = stats.jobs;
+    xensiv_pas_gas_exec_get_stats(exec, &stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(before + (XENSIV_PAS_GAS_EXEC_TEST_BUSES * XENSIV_PAS_GAS_EXEC_TEST_JOBS) + 3U, stats.jobs);
+
+    xensiv_pas_gas_exec_deinit(exec);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, exec->num_workers);
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_EXEC_TEST_BUSES; ++i)
+    {
+        xensiv_pas_gas_emul_deinit(&xensiv_pas_gas_exec_test_buses[i].emul);
+    }
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,80 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_fixed_test.cpp
+ *
+ * Description: Instantiates the C++ facade for each communication interface and sensor variant, and
+ *              runs it against the emulator.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_fixed.hpp"
+
+#define XENSIV_PAS_GAS_FIXED_TEST_GAS            (420U)
+
+template<xensiv_pas_gas_interface_t Itf, xensiv_pas_gas_variant_t Variant>
+static void xensiv_pas_gas_fixed_test_sensor() {
+    using sensor_t = xensiv_pas_gas::fixed_sensor<Itf, Variant>;
+    static_assert(Itf == sensor_t::itf, "Interface of the facade");
+    static_assert(Variant == sensor_t::variant, "Variant of the facade");
+
+    xensiv_pas_gas_emul_t emul;
+    sensor_t sensor;
+    uint16_t val = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, Variant);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_FIXED_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.init(&emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(Variant, sensor.get()->variant);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, sensor.get_result(val));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_continuous_mode(sensor.get(), 10U));
+    xensiv_pas_gas_emul_advance_us(15000000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.get_result(val));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FIXED_TEST_GAS, val);
+
+    uint8_t prod_id = 0U;
+    const uint8_t scratch_pad = 0x5AU;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.get_reg(static_cast<uint8_t>(XENSIV_PAS_GAS_REG_PROD_ID), &prod_id, 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_emul_peek(&emul, static_cast<uint8_t>(XENSIV_PAS_GAS_REG_PROD_ID)), prod_id);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.set_reg(static_cast<uint8_t>(XENSIV_PAS_GAS_REG_SCRATCH_PAD), &scratch_pad, 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(scratch_pad, xensiv_pas_gas_emul_peek(&emul, static_cast<uint8_t>(XENSIV_PAS_GAS_REG_SCRATCH_PAD)));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.perform_forced_compensation(500U));
+
+    /* A configured sensor is adopted by a new facade without a reset */
+    sensor_t restarted;
+    bool warm = false;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_mark_configured(sensor.get()));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, restarted.attach(&emul, &warm));
+    XENSIV_PAS_GAS_TEST_CHECK(warm);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(Variant, restarted.get()->variant);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main() {
+    xensiv_pas_gas_fixed_test_sensor<XENSIV_PAS_GAS_INTERFACE_I2C, XENSIV_PAS_GAS_VARIANT_CO2>();
+    xensiv_pas_gas_fixed_test_sensor<XENSIV_PAS_GAS_INTERFACE_I2C, XENSIV_PAS_GAS_VARIANT_R290>();
+    xensiv_pas_gas_fixed_test_sensor<XENSIV_PAS_GAS_INTERFACE_I2C, XENSIV_PAS_GAS_VARIANT_A2L>();
+    xensiv_pas_gas_fixed_test_sensor<XENSIV_PAS_GAS_INTERFACE_UART, XENSIV_PAS_GAS_VARIANT_CO2>();
+    xensiv_pas_gas_fixed_test_sensor<XENSIV_PAS_GAS_INTERFACE_UART, XENSIV_PAS_GAS_VARIANT_R290>();
+    xensiv_pas_gas_fixed_test_sensor<XENSIV_PAS_GAS_INTERFACE_UART, XENSIV_PAS_GAS_VARIANT_A2L>();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,120 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_fleet_test.c
+ *
+ * Description: Tests of the forced compensation of a fleet of sensors.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_fleet.h"
+
+/* A CO2 sensor, an A2L sensor, an A2L sensor which never completes and a CO2 sensor which does not respond */
+#define XENSIV_PAS_GAS_FLEET_TEST_SENSORS        (4U)
+
+#define XENSIV_PAS_GAS_FLEET_TEST_GAS            (420U)
+#define XENSIV_PAS_GAS_FLEET_TEST_REF            (500U)
+
+/* MEAS_CFG of an idle sensor with the automatic BOC */
+#define XENSIV_PAS_GAS_FLEET_TEST_CFG_IDLE       ((uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS))
+
+static void xensiv_pas_gas_fleet_test_run(xensiv_pas_gas_fleet_t *fleet) {
+    while (XENSIV_PAS_GAS_PENDING == xensiv_pas_gas_fleet_step(fleet, xensiv_pas_gas_emul_now_us()))
+    {
+        uint64_t due_us = xensiv_pas_gas_fleet_get_due_us(fleet);
+        uint64_t now_us = xensiv_pas_gas_emul_now_us();
+        if (due_us > now_us) {
+            xensiv_pas_gas_emul_advance_us(due_us - now_us);
+        }
+    }
+}
+
+int main(void) {
+    static xensiv_pas_gas_emul_t emul[XENSIV_PAS_GAS_FLEET_TEST_SENSORS];
+    static xensiv_pas_gas_t dev[XENSIV_PAS_GAS_FLEET_TEST_SENSORS];
+    static xensiv_pas_gas_fleet_sensor_t sensor[XENSIV_PAS_GAS_FLEET_TEST_SENSORS];
+    static xensiv_pas_gas_fleet_t fleet;
+    xensiv_pas_gas_fleet_config_t config;
+    xensiv_pas_gas_fleet_progress_t progress;
+    xensiv_pas_gas_fleet_stats_t stats;
+    xensiv_pas_gas_emul_timing_t timing;
+
+    xensiv_pas_gas_fleet_get_default_config(&config);
+    config.timeout_cycles = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_fleet_init(&fleet, &config, NULL, NULL));
+    xensiv_pas_gas_fleet_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_fleet_init(&fleet, &config, NULL, NULL));
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_FLEET_TEST_SENSORS; ++i)
+    {
+        bool co2 = (0U == i) || (3U == i);
+        xensiv_pas_gas_emul_init(&emul[i], co2 ? XENSIV_PAS_GAS_VARIANT_CO2 : XENSIV_PAS_GAS_VARIANT_A2L);
+        xensiv_pas_gas_emul_set_gas(&emul[i], XENSIV_PAS_GAS_FLEET_TEST_GAS);
+        if (2U == i) {
+            xensiv_pas_gas_emul_get_default_timing(&timing);
+            timing.fcs_cycles = 200U;
+            xensiv_pas_gas_emul_set_timing(&emul[i], &timing);
+        }
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, co2 ? xensiv_pas_gas_co2_init(&dev[i], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[i]) :
+                                                              xensiv_pas_gas_a2l_init(&dev[i], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[i]));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_fleet_add(&fleet, &sensor[i], &dev[i], i / 2U, XENSIV_PAS_GAS_FLEET_TEST_REF));
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_fleet_add(&fleet, &sensor[0], &dev[0], XENSIV_PAS_GAS_FLEET_MAX_BUSES, XENSIV_PAS_GAS_FLEET_TEST_REF));
+    xensiv_pas_gas_emul_inject_comm_errors(&emul[3], UINT32_MAX);
+
+    xensiv_pas_gas_fleet_get_stats(&fleet, &stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FLEET_TEST_SENSORS, stats.queued);
+
+    xensiv_pas_gas_fleet_test_run(&fleet);
+
+    xensiv_pas_gas_fleet_get_stats(&fleet, &stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, stats.queued);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, stats.running);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(2U, stats.done);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, stats.failed);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, stats.timed_out);
+
+    /* The offset of the CO2 sensor is saved and survives a power cycle */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FLEET_STATE_DONE, sensor[0].state);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor[0].res);
+    xensiv_pas_gas_emul_power_cycle(&emul[0]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((int32_t)XENSIV_PAS_GAS_FLEET_TEST_REF - (int32_t)XENSIV_PAS_GAS_FLEET_TEST_GAS, emul[0].fcs_offset);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FLEET_STATE_DONE, sensor[1].state);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor[1].res);
+
+    /* The sensor which never completes is set to idle with the automatic BOC by its operation */
+    xensiv_pas_gas_fleet_get_progress(&fleet, &sensor[2], xensiv_pas_gas_emul_now_us(), &progress);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FLEET_STATE_TIMEOUT, progress.state);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_TIMEOUT, progress.res);
+    XENSIV_PAS_GAS_TEST_CHECK(progress.elapsed_us >= progress.timeout_us);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FLEET_TEST_CFG_IDLE, xensiv_pas_gas_emul_peek(&emul[2], (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_FLEET_STATE_FAILED, sensor[3].state);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, sensor[3].res);
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_FLEET_TEST_SENSORS; ++i)
+    {
+        xensiv_pas_gas_emul_deinit(&emul[i]);
+    }
+
+    return xensiv_pas_gas_test_result();
+}
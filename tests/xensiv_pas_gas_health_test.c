@@ -0,0 +1,189 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_health_test.c
+ *
+ * Description: Tests of the health monitor, checking one event per transition and the fleet bitmap.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_r290.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_health.h"
+
+/* A CO2 sensor, an R290 sensor, an A2L sensor and an A2L sensor over UART, which does not reach SELF_TEST */
+#define XENSIV_PAS_GAS_HEALTH_TEST_DEVS          (4U)
+
+#define XENSIV_PAS_GAS_HEALTH_TEST_PERIOD_US     (4000000ULL)
+
+#define XENSIV_PAS_GAS_HEALTH_TEST_ORVS          ((uint32_t)XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK << XENSIV_PAS_GAS_HEALTH_SENS_STS_POS)
+#define XENSIV_PAS_GAS_HEALTH_TEST_ORTMP         ((uint32_t)XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK << XENSIV_PAS_GAS_HEALTH_SENS_STS_POS)
+#define XENSIV_PAS_GAS_HEALTH_TEST_EMITTER       ((uint32_t)XENSIV_PAS_GAS_A2L_REG_SELF_TEST_EMITTER_ERR_MSK << XENSIV_PAS_GAS_HEALTH_SELF_TEST_POS)
+
+static xensiv_pas_gas_emul_t emul[XENSIV_PAS_GAS_HEALTH_TEST_DEVS];
+static xensiv_pas_gas_t dev[XENSIV_PAS_GAS_HEALTH_TEST_DEVS];
+
+/* Events of one sweep over all sensors */
+typedef struct
+{
+    uint32_t count[XENSIV_PAS_GAS_HEALTH_TEST_DEVS];
+    uint32_t changed[XENSIV_PAS_GAS_HEALTH_TEST_DEVS];
+} xensiv_pas_gas_health_test_events_t;
+
+/* Steps the monitor over one period, polling each sensor once, and collects the events */
+static void xensiv_pas_gas_health_test_sweep(xensiv_pas_gas_health_t *mon, xensiv_pas_gas_health_test_events_t *events) {
+    xensiv_pas_gas_health_event_t event;
+
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HEALTH_TEST_DEVS; ++i)
+    {
+        events->count[i] = 0U;
+        events->changed[i] = 0U;
+    }
+
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HEALTH_TEST_DEVS; ++i)
+    {
+        uint64_t due_us = xensiv_pas_gas_health_get_due_us(mon);
+        uint64_t now_us = xensiv_pas_gas_emul_now_us();
+        if (due_us > now_us) {
+            /* Nothing is read before the poll is due */
+            xensiv_pas_gas_emul_reset_bus_stats();
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_health_step(mon, now_us, &event));
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+            xensiv_pas_gas_emul_advance_us(due_us - now_us);
+        }
+
+        if (XENSIV_PAS_GAS_OK == xensiv_pas_gas_health_step(mon, xensiv_pas_gas_emul_now_us(), &event)) {
+            XENSIV_PAS_GAS_TEST_CHECK(event.dev_idx < XENSIV_PAS_GAS_HEALTH_TEST_DEVS);
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_health_get_health(mon, event.dev_idx), event.health);
+            events->count[event.dev_idx]++;
+            events->changed[event.dev_idx] |= event.changed;
+        }
+    }
+}
+
+static void xensiv_pas_gas_health_test_check_events(const xensiv_pas_gas_health_test_events_t *events,
+                                                    const uint32_t changed[XENSIV_PAS_GAS_HEALTH_TEST_DEVS]) {
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HEALTH_TEST_DEVS; ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ((changed[i] != 0U) ? 1U : 0U, events->count[i]);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(changed[i], events->changed[i]);
+    }
+}
+
+int main(void) {
+    static const xensiv_pas_gas_t *const devs[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = { &dev[0], &dev[1], &dev[2], &dev[3] };
+    static const uint32_t none[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = { 0U };
+    xensiv_pas_gas_health_t mon;
+    xensiv_pas_gas_health_config_t config;
+    xensiv_pas_gas_health_test_events_t events;
+    xensiv_pas_gas_a2l_self_test_clr_t self_test_clr = { .u = 0U };
+
+    xensiv_pas_gas_emul_init(&emul[0], XENSIV_PAS_GAS_VARIANT_CO2);
+    xensiv_pas_gas_emul_init(&emul[1], XENSIV_PAS_GAS_VARIANT_R290);
+    xensiv_pas_gas_emul_init(&emul[2], XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_init(&emul[3], XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev[0], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[0]));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_r290_init(&dev[1], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[1]));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev[2], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[2]));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev[3], XENSIV_PAS_GAS_INTERFACE_UART, &emul[3]));
+
+    xensiv_pas_gas_health_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_health_init(&mon, devs, 0U, &config));
+    config.period_us = XENSIV_PAS_GAS_HEALTH_TEST_PERIOD_US;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_health_init(&mon, devs, XENSIV_PAS_GAS_HEALTH_TEST_DEVS, &config));
+
+    /* The first poll of each sensor reports its initial health, which is not a fault */
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HEALTH_TEST_DEVS; ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, events.count[i]);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_health_get_health(&mon, i), events.changed[i]);
+        XENSIV_PAS_GAS_TEST_CHECK((events.changed[i] & XENSIV_PAS_GAS_HEALTH_SENS_STS_MSK) != 0U);
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_health_get_fleet(&mon));
+
+    /* A steady health is not reported again */
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, none);
+
+    /* Setting fault bits gives one event per sensor, two bits changing together included; SELF_TEST is not read over UART */
+    xensiv_pas_gas_emul_set_bits(&emul[1], (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ORVS_MSK);
+    xensiv_pas_gas_emul_set_bits(&emul[2], (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK);
+    xensiv_pas_gas_emul_set_bits(&emul[2], (uint8_t)XENSIV_PAS_GAS_A2L_REG_SELF_TEST, XENSIV_PAS_GAS_A2L_REG_SELF_TEST_EMITTER_ERR_MSK);
+    xensiv_pas_gas_emul_set_bits(&emul[3], (uint8_t)XENSIV_PAS_GAS_A2L_REG_SELF_TEST, XENSIV_PAS_GAS_A2L_REG_SELF_TEST_EMITTER_ERR_MSK);
+    const uint32_t set[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = {
+        0U, XENSIV_PAS_GAS_HEALTH_TEST_ORVS, XENSIV_PAS_GAS_HEALTH_TEST_ORTMP | XENSIV_PAS_GAS_HEALTH_TEST_EMITTER, 0U
+    };
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, set);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((1UL << 1U) | (1UL << 2U), xensiv_pas_gas_health_get_fleet(&mon));
+
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, none);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((1UL << 1U) | (1UL << 2U), xensiv_pas_gas_health_get_fleet(&mon));
+
+    /* Clearing one of two faults gives an event, the sensor stays in the fleet bitmap */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_clear_status(&dev[2], XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_CLR_MSK));
+    const uint32_t cleared_one[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = { 0U, 0U, XENSIV_PAS_GAS_HEALTH_TEST_ORTMP, 0U };
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, cleared_one);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((1UL << 1U) | (1UL << 2U), xensiv_pas_gas_health_get_fleet(&mon));
+
+    /* Clearing the remaining faults gives one event per sensor and empties the fleet bitmap */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_clear_status(&dev[1], XENSIV_PAS_GAS_REG_SENS_STS_ORVS_CLR_MSK));
+    self_test_clr.b.emitter_err_clr = 1U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_clr_self_test(&dev[2], self_test_clr));
+    const uint32_t cleared[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = { 0U, XENSIV_PAS_GAS_HEALTH_TEST_ORVS, XENSIV_PAS_GAS_HEALTH_TEST_EMITTER, 0U };
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, cleared);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_health_get_fleet(&mon));
+
+    /* A sensor which cannot be read is reported once when it fails and once when it recovers */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul[0], UINT32_MAX);
+    const uint32_t comm[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = { XENSIV_PAS_GAS_HEALTH_COMM_ERR_MSK, 0U, 0U, 0U };
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, comm);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1UL << 0U, xensiv_pas_gas_health_get_fleet(&mon));
+
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, none);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1UL << 0U, xensiv_pas_gas_health_get_fleet(&mon));
+
+    xensiv_pas_gas_emul_inject_comm_errors(&emul[0], 0U);
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, comm);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_health_get_fleet(&mon));
+
+    /* A bit outside fault_mask is reported without marking the sensor as faulty */
+    config.fault_mask = XENSIV_PAS_GAS_HEALTH_TEST_ORVS;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_health_init(&mon, devs, XENSIV_PAS_GAS_HEALTH_TEST_DEVS, &config));
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_emul_set_bits(&emul[3], (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ORTMP_MSK);
+    const uint32_t masked[XENSIV_PAS_GAS_HEALTH_TEST_DEVS] = { 0U, 0U, 0U, XENSIV_PAS_GAS_HEALTH_TEST_ORTMP };
+    xensiv_pas_gas_health_test_sweep(&mon, &events);
+    xensiv_pas_gas_health_test_check_events(&events, masked);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_health_get_fleet(&mon));
+
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HEALTH_TEST_DEVS; ++i)
+    {
+        xensiv_pas_gas_emul_deinit(&emul[i]);
+    }
+
+    return xensiv_pas_gas_test_result();
+}
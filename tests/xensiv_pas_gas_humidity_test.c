@@ -0,0 +1,154 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_humidity_test.c
+ *
+ * Description: Tests of the humidity compensation feed of the A2L sensors.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_humidity.h"
+
+#define XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS        (3U)
+
+#define XENSIV_PAS_GAS_HUMIDITY_TEST_HC_ENABLE   (1U << XENSIV_PAS_GAS_A2L_REG_HC_CTRL_ENABLE_POS)
+#define XENSIV_PAS_GAS_HUMIDITY_TEST_HC_STALE    (1U << XENSIV_PAS_GAS_A2L_REG_HC_CTRL_STALE_HUM_POS)
+
+/* Checks an absolute humidity against the Magnus formula value, in mg/m³, within 0.5 % */
+static void xensiv_pas_gas_humidity_test_abs(uint16_t rh, int16_t temp, uint32_t expected_mg) {
+    uint32_t abs_mg = xensiv_pas_gas_humidity_abs_from_rel(rh, temp);
+    uint32_t delta = (abs_mg > expected_mg) ? (abs_mg - expected_mg) : (expected_mg - abs_mg);
+
+    XENSIV_PAS_GAS_TEST_CHECK((delta * 200U) <= expected_mg);
+}
+
+static void xensiv_pas_gas_humidity_test_feed(void) {
+    static xensiv_pas_gas_emul_t emul[XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS];
+    static xensiv_pas_gas_t dev[XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS];
+    const xensiv_pas_gas_t *devs[XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS];
+    xensiv_pas_gas_humidity_feed_t feed;
+    xensiv_pas_gas_humidity_feed_config_t config;
+
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS; ++i)
+    {
+        xensiv_pas_gas_emul_init(&emul[i], XENSIV_PAS_GAS_VARIANT_A2L);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev[i], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[i]));
+        devs[i] = &dev[i];
+    }
+
+    xensiv_pas_gas_humidity_feed_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_humidity_feed_init(&feed, devs, 0U, &config));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_init(&feed, devs, XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS, &config));
+
+    /* The first reading writes the reference, rounded to g/m³, and enables the compensation */
+    uint64_t time_us = 0U;
+    uint16_t ref = (uint16_t)((xensiv_pas_gas_humidity_abs_from_rel(4500U, 2350) + 500U) / 1000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_update(&feed, time_us, 4500U, 2350));
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS; ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(ref, xensiv_pas_gas_test_peek16(&emul[i], (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H));
+        XENSIV_PAS_GAS_TEST_CHECK((xensiv_pas_gas_emul_peek(&emul[i], (uint8_t)XENSIV_PAS_GAS_A2L_REG_HC_CTRL) &
+                                   XENSIV_PAS_GAS_HUMIDITY_TEST_HC_ENABLE) != 0U);
+    }
+
+    /* Changes below the threshold are not written */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    for (uint16_t k = 0U; k < 60U; ++k)
+    {
+        time_us += 1000000U;
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_update(&feed, time_us, (uint16_t)(4500U + (k % 10U)), 2350));
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+
+    /* A large change is written once to each sensor */
+    time_us += 1000000U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_update(&feed, time_us, 8000U, 4000));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS, xensiv_pas_gas_test_transfers());
+    ref = (uint16_t)((xensiv_pas_gas_humidity_abs_from_rel(8000U, 4000) + 500U) / 1000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(ref, xensiv_pas_gas_test_peek16(&emul[1], (uint8_t)XENSIV_PAS_GAS_A2L_REG_ABS_HUM_REF_H));
+
+    /* A sensor reporting a stale reference is written and enabled again at the next reading */
+    xensiv_pas_gas_emul_set_bits(&emul[2], (uint8_t)XENSIV_PAS_GAS_A2L_REG_HC_CTRL, XENSIV_PAS_GAS_HUMIDITY_TEST_HC_STALE);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_check(&feed));
+    xensiv_pas_gas_emul_reset_bus_stats();
+    time_us += 1000000U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_update(&feed, time_us, 8000U, 4000));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(2U, xensiv_pas_gas_test_transfers());
+    XENSIV_PAS_GAS_TEST_CHECK((xensiv_pas_gas_emul_peek(&emul[2], (uint8_t)XENSIV_PAS_GAS_A2L_REG_HC_CTRL) &
+                               XENSIV_PAS_GAS_HUMIDITY_TEST_HC_ENABLE) != 0U);
+
+    /* Stopping disables the compensation */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_humidity_feed_stop(&feed));
+    for (size_t i = 0U; i < XENSIV_PAS_GAS_HUMIDITY_TEST_DEVS; ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK((xensiv_pas_gas_emul_peek(&emul[i], (uint8_t)XENSIV_PAS_GAS_A2L_REG_HC_CTRL) &
+                                   XENSIV_PAS_GAS_HUMIDITY_TEST_HC_ENABLE) == 0U);
+        xensiv_pas_gas_emul_deinit(&emul[i]);
+    }
+}
+
+static void xensiv_pas_gas_humidity_test_limit(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    uint16_t ref = 0U;
+
+    /* A reference above the range of the sensor is rejected, not truncated to the 10-bit field */
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_set_absolute_humidity_ref(&dev, XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_get_absolute_humidity_ref(&dev, &ref));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX, ref);
+
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_a2l_set_absolute_humidity_ref(&dev, XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX + 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_a2l_set_absolute_humidity_ref(&dev, 0x0400U + 12U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_get_absolute_humidity_ref(&dev, &ref));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_ABS_HUM_REF_MAX, ref);
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_humidity_test_uart(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    const xensiv_pas_gas_t *devs[1] = { &dev };
+    xensiv_pas_gas_humidity_feed_t feed;
+    xensiv_pas_gas_humidity_feed_config_t config;
+
+    /* ABS_HUM_REF and HC_CTRL are beyond the UART register range */
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_UART, &emul));
+    xensiv_pas_gas_humidity_feed_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_humidity_feed_init(&feed, devs, 1U, &config));
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    /* Magnus formula values */
+    xensiv_pas_gas_humidity_test_abs(4500U, 2350, 9495U);
+    xensiv_pas_gas_humidity_test_abs(8000U, 4000, 40786U);
+    xensiv_pas_gas_humidity_test_abs(3000U, -1000, 709U);
+
+    xensiv_pas_gas_humidity_test_feed();
+    xensiv_pas_gas_humidity_test_limit();
+    xensiv_pas_gas_humidity_test_uart();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,225 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_inventory_test.c
+ *
+ * Description: Tests of the sensor inventory: record, warm attach and the invalidation of the records.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_r290.h"
+#include "src/xensiv_pas_gas_inventory.h"
+
+#define XENSIV_PAS_GAS_INVENTORY_TEST_CAPACITY   (4U)
+
+static uint8_t xensiv_pas_gas_inventory_test_image[XENSIV_PAS_GAS_INVENTORY_SIZE(XENSIV_PAS_GAS_INVENTORY_TEST_CAPACITY)];
+
+static const uint8_t xensiv_pas_gas_inventory_test_id[8] = { 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U };
+
+static const uint8_t xensiv_pas_gas_inventory_test_profile[3] = { 1U, 2U, 3U };
+
+static void xensiv_pas_gas_inventory_test_attach(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_inventory_t inv;
+    xensiv_pas_gas_inventory_entry_t entry;
+    xensiv_pas_gas_unique_id_t unique_id;
+    bool formatted = false;
+    bool match = true;
+    xensiv_pas_gas_inventory_key_t key = { .bus = 1U, .mux_channel = 3U, .itf = XENSIV_PAS_GAS_INTERFACE_I2C };
+    uint32_t hash = xensiv_pas_gas_inventory_hash(xensiv_pas_gas_inventory_test_profile, sizeof(xensiv_pas_gas_inventory_test_profile));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_inventory_open(&inv, xensiv_pas_gas_inventory_test_image, 10U, &formatted));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_open(&inv, xensiv_pas_gas_inventory_test_image,
+                                                                                  sizeof(xensiv_pas_gas_inventory_test_image), &formatted));
+    XENSIV_PAS_GAS_TEST_CHECK(formatted);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVENTORY_TEST_CAPACITY, inv.capacity);
+
+    /* Without a record the bus is not accessed */
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_set_device_id(&emul, xensiv_pas_gas_inventory_test_id);
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(!match);
+    xensiv_pas_gas_emul_bus_stats_t stats;
+    xensiv_pas_gas_emul_get_bus_stats(&stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, stats.i2c_transfers);
+
+    /* Provisioning */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, key.itf, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_get_unique_id(&dev, &unique_id));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_continuous_mode(&dev, 30U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_mark_configured(&dev));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_record(&inv, &key, &dev, hash));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, inv.count);
+
+    /* After a restart of the host the sensor is attached with three transfers */
+    formatted = true;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_open(&inv, xensiv_pas_gas_inventory_test_image,
+                                                                                  sizeof(xensiv_pas_gas_inventory_test_image), &formatted));
+    XENSIV_PAS_GAS_TEST_CHECK(!formatted);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, inv.count);
+    memset(&dev, 0, sizeof(dev));
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(match);
+    xensiv_pas_gas_emul_get_bus_stats(&stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, stats.i2c_transfers);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_VARIANT_A2L, dev.variant);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(sizeof(xensiv_pas_gas_inventory_test_id), dev.unique_id.len);
+    XENSIV_PAS_GAS_TEST_CHECK(memcmp(dev.unique_id.id, xensiv_pas_gas_inventory_test_id, sizeof(xensiv_pas_gas_inventory_test_id)) == 0);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_lookup(&inv, &key, &entry));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_VARIANT_A2L, entry.variant);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(30U, entry.meas_rate);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(hash, entry.config_hash);
+
+    /* Another expected configuration does not match */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash + 1U, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(!match);
+
+    /* Neither does a sensor that lost its configuration */
+    xensiv_pas_gas_emul_power_cycle(&emul);
+    xensiv_pas_gas_emul_advance_us(3000000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(!match);
+
+    /* A torn record is detected by its CRC and ignored */
+    xensiv_pas_gas_inventory_test_image[XENSIV_PAS_GAS_INVENTORY_HDR_SIZE + 5U] ^= 0x01U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_inventory_lookup(&inv, &key, &entry));
+    match = true;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(!match);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+/* Provisions an emulated sensor over I2C, reading its unique device ID */
+static void xensiv_pas_gas_inventory_test_provision(xensiv_pas_gas_emul_t *emul, xensiv_pas_gas_t *dev, xensiv_pas_gas_variant_t variant) {
+    xensiv_pas_gas_unique_id_t unique_id;
+
+    if (XENSIV_PAS_GAS_VARIANT_A2L == variant) {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(dev, XENSIV_PAS_GAS_INTERFACE_I2C, emul));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_get_unique_id(dev, &unique_id));
+    } else {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_r290_init(dev, XENSIV_PAS_GAS_INTERFACE_I2C, emul));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_r290_get_unique_id(dev, &unique_id));
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_continuous_mode(dev, 30U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_mark_configured(dev));
+}
+
+static void xensiv_pas_gas_inventory_test_swap(xensiv_pas_gas_variant_t variant) {
+    static const uint8_t other_id[8] = { 0xA1U, 0xA2U, 0xA3U, 0xA4U, 0xA5U, 0xA6U, 0xA7U, 0xA8U };
+    static uint8_t image[XENSIV_PAS_GAS_INVENTORY_SIZE(1U)];
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_emul_t other;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_inventory_t inv;
+    bool match = false;
+    xensiv_pas_gas_inventory_key_t key = { .bus = 0U, .mux_channel = 1U, .itf = XENSIV_PAS_GAS_INTERFACE_I2C };
+    uint32_t hash = xensiv_pas_gas_inventory_hash(xensiv_pas_gas_inventory_test_profile, sizeof(xensiv_pas_gas_inventory_test_profile));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_open(&inv, image, sizeof(image), NULL));
+    xensiv_pas_gas_emul_init(&emul, variant);
+    xensiv_pas_gas_emul_set_device_id(&emul, xensiv_pas_gas_inventory_test_id);
+    xensiv_pas_gas_inventory_test_provision(&emul, &dev, variant);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_record(&inv, &key, &dev, hash));
+
+    /* A sensor with another device ID, provisioned alike, is swapped in at the location */
+    xensiv_pas_gas_emul_init(&other, variant);
+    xensiv_pas_gas_emul_set_device_id(&other, other_id);
+    xensiv_pas_gas_inventory_test_provision(&other, &dev, variant);
+
+    /* It is not adopted, but initialized and recorded again by the application */
+    memset(&dev, 0, sizeof(dev));
+    match = true;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &other, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(!match);
+    xensiv_pas_gas_inventory_test_provision(&other, &dev, variant);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_record(&inv, &key, &dev, hash));
+
+    memset(&dev, 0, sizeof(dev));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &other, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(match);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(other_id[0], dev.unique_id.id[0]);
+
+    /* Now the first sensor is the stranger */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(!match);
+
+    xensiv_pas_gas_emul_deinit(&other);
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_inventory_test_uart(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_inventory_t inv;
+    bool formatted = false;
+    bool match = false;
+    xensiv_pas_gas_inventory_key_t key = { .bus = 2U, .mux_channel = 0U, .itf = XENSIV_PAS_GAS_INTERFACE_UART };
+    uint32_t hash = xensiv_pas_gas_inventory_hash(xensiv_pas_gas_inventory_test_profile, sizeof(xensiv_pas_gas_inventory_test_profile));
+
+    /* The record of a sensor connected over UART */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_open(&inv, xensiv_pas_gas_inventory_test_image,
+                                                                                  sizeof(xensiv_pas_gas_inventory_test_image), &formatted));
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_CO2);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev, key.itf, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_continuous_mode(&dev, 60U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_mark_configured(&dev));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_record(&inv, &key, &dev, hash));
+
+    memset(&dev, 0, sizeof(dev));
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_attach(&inv, &key, &dev, &emul, hash, &match));
+    XENSIV_PAS_GAS_TEST_CHECK(match);
+    xensiv_pas_gas_emul_bus_stats_t stats;
+    xensiv_pas_gas_emul_get_bus_stats(&stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, stats.i2c_transfers);
+    XENSIV_PAS_GAS_TEST_CHECK(stats.uart_writes > 0U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_VARIANT_CO2, dev.variant);
+
+    /* The image holds a bounded number of records, freed by a removal */
+    xensiv_pas_gas_inventory_key_t other = key;
+    for (uint8_t i = 1U; i < XENSIV_PAS_GAS_INVENTORY_TEST_CAPACITY; ++i)
+    {
+        other.mux_channel = i;
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_record(&inv, &other, &dev, hash));
+    }
+    other.mux_channel = XENSIV_PAS_GAS_INVENTORY_TEST_CAPACITY;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_inventory_record(&inv, &other, &dev, hash));
+    xensiv_pas_gas_inventory_remove(&inv, &key);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_inventory_record(&inv, &other, &dev, hash));
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    xensiv_pas_gas_inventory_test_attach();
+    xensiv_pas_gas_inventory_test_swap(XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_inventory_test_swap(XENSIV_PAS_GAS_VARIANT_R290);
+    xensiv_pas_gas_inventory_test_uart();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,251 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_linux_test.c
+ *
+ * Description: Steps UART operations of the Linux platform from an event loop, with a sensor served on
+ *              the master side of a pseudo-terminal by the same thread, so that a step waiting for the
+ *              sensor response could never receive it.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 700
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_linux.h"
+
+#define XENSIV_PAS_GAS_LINUX_TEST_GAS            (0x1234U)
+#define XENSIV_PAS_GAS_LINUX_TEST_REGS           (XENSIV_PAS_GAS_REG_SENS_RST + 1U)
+#define XENSIV_PAS_GAS_LINUX_TEST_ACK            (0x06U)
+
+/* Time after which the event loop gives up on an operation */
+#define XENSIV_PAS_GAS_LINUX_TEST_STUCK_MS       (1000)
+
+/* Upper limit of the duration of a step, well below the UART response timeout */
+#define XENSIV_PAS_GAS_LINUX_TEST_STEP_MAX_US    (20000U)
+
+/* Sensor answering the UART commands on the master side of the pseudo-terminal */
+typedef struct
+{
+    int fd;
+    uint8_t regs[XENSIV_PAS_GAS_LINUX_TEST_REGS];
+    char cmd[16];
+    size_t cmd_len;
+    uint8_t out[64];
+    size_t out_len;
+    bool silent;                            /* Commands are not answered */
+    uint32_t commands;
+} xensiv_pas_gas_linux_test_sensor_t;
+
+/* Statistics of the steps of an operation */
+typedef struct
+{
+    uint32_t steps;
+    uint32_t port_waits;                    /* Steps which returned to wait for a UART response */
+    uint64_t max_step_us;
+} xensiv_pas_gas_linux_test_run_t;
+
+static uint8_t xensiv_pas_gas_linux_test_from_hex(char c) {
+    return (uint8_t)((c <= '9') ? (c - '0') : ((c | 0x20) - 'a' + 10));
+}
+
+static void xensiv_pas_gas_linux_test_handle(xensiv_pas_gas_linux_test_sensor_t *sensor) {
+    static const char hex[] = "0123456789ABCDEF";
+    uint8_t reg = (uint8_t)((xensiv_pas_gas_linux_test_from_hex(sensor->cmd[2]) << 4U) | xensiv_pas_gas_linux_test_from_hex(sensor->cmd[3]));
+
+    sensor->commands++;
+    if (sensor->silent || (reg >= XENSIV_PAS_GAS_LINUX_TEST_REGS)) {
+        return;
+    }
+
+    if (('w' == sensor->cmd[0]) && (sensor->cmd_len >= 7U)) {
+        sensor->regs[reg] = (uint8_t)((xensiv_pas_gas_linux_test_from_hex(sensor->cmd[5]) << 4U) | xensiv_pas_gas_linux_test_from_hex(sensor->cmd[6]));
+        sensor->out[sensor->out_len++] = XENSIV_PAS_GAS_LINUX_TEST_ACK;
+        sensor->out[sensor->out_len++] = (uint8_t)'\n';
+    } else if ('r' == sensor->cmd[0]) {
+        sensor->out[sensor->out_len++] = (uint8_t)hex[sensor->regs[reg] >> 4U];
+        sensor->out[sensor->out_len++] = (uint8_t)hex[sensor->regs[reg] & 0x0FU];
+        sensor->out[sensor->out_len++] = (uint8_t)'\n';
+        if (XENSIV_PAS_GAS_REG_MEAS_STS == reg) {
+            sensor->regs[reg] &= (uint8_t)~XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK;
+        }
+    }
+}
+
+/* Consumes the commands received, then sends at most one byte of the responses */
+static void xensiv_pas_gas_linux_test_serve(xensiv_pas_gas_linux_test_sensor_t *sensor) {
+    char c;
+
+    while (1 == read(sensor->fd, &c, 1U))
+    {
+        if ('\n' == c) {
+            xensiv_pas_gas_linux_test_handle(sensor);
+            sensor->cmd_len = 0U;
+        } else if (sensor->cmd_len < sizeof(sensor->cmd)) {
+            sensor->cmd[sensor->cmd_len++] = c;
+        }
+    }
+
+    if ((sensor->out_len > 0U) && (1 == write(sensor->fd, sensor->out, 1U))) {
+        sensor->out_len--;
+        (void)memmove(sensor->out, &sensor->out[1], sensor->out_len);
+    }
+}
+
+/* Steps the operation whenever the bus file descriptor is readable, serving the sensor in between */
+static int32_t xensiv_pas_gas_linux_test_run(xensiv_pas_gas_linux_bus_t *bus, xensiv_pas_gas_linux_test_sensor_t *sensor,
+                                             xensiv_pas_gas_async_t *op, xensiv_pas_gas_linux_test_run_t *run) {
+    int32_t res = xensiv_pas_gas_linux_bus_start(bus, op);
+    if (XENSIV_PAS_GAS_OK != res) {
+        return res;
+    }
+
+    (void)memset(run, 0, sizeof(*run));
+    res = XENSIV_PAS_GAS_PENDING;
+    while (XENSIV_PAS_GAS_PENDING == res)
+    {
+        struct pollfd pfds[2] = {
+            { .fd = xensiv_pas_gas_linux_bus_get_fd(bus), .events = POLLIN, .revents = 0 },
+            { .fd = sensor->fd, .events = POLLIN, .revents = 0 }
+        };
+
+        /* Pending responses are trickled out one byte per iteration */
+        int ret = poll(pfds, 2U, (sensor->out_len > 0U) ? 0 : XENSIV_PAS_GAS_LINUX_TEST_STUCK_MS);
+        if ((0 == ret) && (0U == sensor->out_len)) {
+            return XENSIV_PAS_GAS_TIMEOUT;
+        }
+
+        xensiv_pas_gas_linux_test_serve(sensor);
+
+        if (0 != (pfds[0].revents & POLLIN)) {
+            uint64_t start_us = xensiv_pas_gas_plat_get_time_us();
+            res = xensiv_pas_gas_linux_bus_step(bus);
+            uint64_t step_us = xensiv_pas_gas_plat_get_time_us() - start_us;
+
+            run->steps++;
+            run->max_step_us = (step_us > run->max_step_us) ? step_us : run->max_step_us;
+            if ((XENSIV_PAS_GAS_PENDING == res) && (EPOLLIN == bus->uart_events)) {
+                run->port_waits++;
+            }
+        }
+    }
+
+    XENSIV_PAS_GAS_TEST_CHECK(!xensiv_pas_gas_linux_bus_is_busy(bus));
+
+    return res;
+}
+
+/* Reads the result through two accesses, the second one of two UART commands, whose responses trickle in */
+static void xensiv_pas_gas_linux_test_read(xensiv_pas_gas_linux_bus_t *bus, xensiv_pas_gas_linux_test_sensor_t *sensor, xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_async_t op;
+    xensiv_pas_gas_linux_test_run_t run;
+    uint16_t val = 0U;
+
+    sensor->regs[XENSIV_PAS_GAS_REG_MEAS_STS] = XENSIV_PAS_GAS_REG_MEAS_STS_DRDY_MSK;
+    sensor->regs[XENSIV_PAS_GAS_REG_GASCONC_H] = (uint8_t)(XENSIV_PAS_GAS_LINUX_TEST_GAS >> 8U);
+    sensor->regs[XENSIV_PAS_GAS_REG_GASCONC_H + 1U] = (uint8_t)(XENSIV_PAS_GAS_LINUX_TEST_GAS & 0xFFU);
+    sensor->commands = 0U;
+
+    xensiv_pas_gas_async_read_result(&op, dev, &val);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_linux_test_run(bus, sensor, &op, &run));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_LINUX_TEST_GAS, val);
+
+    /* Each command is sent once, although its step is repeated until the response is complete */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, sensor->commands);
+    XENSIV_PAS_GAS_TEST_CHECK(run.port_waits >= 3U);
+    XENSIV_PAS_GAS_TEST_CHECK(run.max_step_us < XENSIV_PAS_GAS_LINUX_TEST_STEP_MAX_US);
+
+    /* No new result */
+    xensiv_pas_gas_async_read_result(&op, dev, &val);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_linux_test_run(bus, sensor, &op, &run));
+}
+
+static void xensiv_pas_gas_linux_test_write(xensiv_pas_gas_linux_bus_t *bus, xensiv_pas_gas_linux_test_sensor_t *sensor, xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_async_t op;
+    xensiv_pas_gas_linux_test_run_t run;
+    const uint8_t rate[2] = { 0x01U, 0x2CU };
+
+    sensor->commands = 0U;
+    xensiv_pas_gas_async_set_reg(&op, dev, XENSIV_PAS_GAS_REG_MEAS_RATE_H, rate, 2U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_linux_test_run(bus, sensor, &op, &run));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(rate[0], sensor->regs[XENSIV_PAS_GAS_REG_MEAS_RATE_H]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(rate[1], sensor->regs[XENSIV_PAS_GAS_REG_MEAS_RATE_H + 1U]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(2U, sensor->commands);
+    XENSIV_PAS_GAS_TEST_CHECK(run.port_waits >= 2U);
+    XENSIV_PAS_GAS_TEST_CHECK(run.max_step_us < XENSIV_PAS_GAS_LINUX_TEST_STEP_MAX_US);
+}
+
+/* A sensor which does not respond fails the access after timeout_ms, without a step waiting for it */
+static void xensiv_pas_gas_linux_test_silent(xensiv_pas_gas_linux_bus_t *bus, xensiv_pas_gas_linux_test_sensor_t *sensor, xensiv_pas_gas_t *dev) {
+    xensiv_pas_gas_async_t op;
+    xensiv_pas_gas_linux_test_run_t run;
+    uint8_t data = 0U;
+
+    sensor->silent = true;
+    sensor->commands = 0U;
+
+    uint64_t start_us = xensiv_pas_gas_plat_get_time_us();
+    xensiv_pas_gas_async_get_reg(&op, dev, XENSIV_PAS_GAS_REG_SENS_STS, &data, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_linux_test_run(bus, sensor, &op, &run));
+    uint64_t elapsed_us = xensiv_pas_gas_plat_get_time_us() - start_us;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, sensor->commands);
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us >= ((uint64_t)bus->timeout_ms * 1000U));
+    XENSIV_PAS_GAS_TEST_CHECK(run.max_step_us < XENSIV_PAS_GAS_LINUX_TEST_STEP_MAX_US);
+
+    sensor->silent = false;
+}
+
+int main(void) {
+    xensiv_pas_gas_linux_test_sensor_t sensor;
+    xensiv_pas_gas_linux_bus_t bus;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_async_t op;
+
+    (void)memset(&sensor, 0, sizeof(sensor));
+    sensor.fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((sensor.fd < 0) || (0 != grantpt(sensor.fd)) || (0 != unlockpt(sensor.fd)) ||
+        (0 != fcntl(sensor.fd, F_SETFL, O_NONBLOCK))) {
+        /* No pseudo-terminal in this environment */
+        fprintf(stderr, "pseudo-terminal not available, test skipped\n");
+        return 0;
+    }
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_linux_uart_open(&bus, ptsname(sensor.fd)));
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_linux_bus_get_io_fd(&bus) >= 0);
+
+    /* Only sets the device structure up; the soft reset of the initialization is not needed here */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_async_init(&op, &dev, XENSIV_PAS_GAS_VARIANT_CO2, XENSIV_PAS_GAS_INTERFACE_UART, &bus));
+
+    xensiv_pas_gas_linux_test_read(&bus, &sensor, &dev);
+    xensiv_pas_gas_linux_test_write(&bus, &sensor, &dev);
+    xensiv_pas_gas_linux_test_silent(&bus, &sensor, &dev);
+    xensiv_pas_gas_linux_test_read(&bus, &sensor, &dev);
+
+    xensiv_pas_gas_linux_bus_close(&bus);
+    (void)close(sensor.fd);
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,170 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_multigas_test.c
+ *
+ * Description: Tests of the multi-gas scheduler, its round robin and the retry of a failed gas switch.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_multigas.h"
+
+#define XENSIV_PAS_GAS_MULTIGAS_TEST_GAS         (420U)
+#define XENSIV_PAS_GAS_MULTIGAS_TEST_RATE_S      (10U)
+#define XENSIV_PAS_GAS_MULTIGAS_TEST_SAMPLES     (2U)
+
+/* Measurements of the round robin, three turns of each gas */
+#define XENSIV_PAS_GAS_MULTIGAS_TEST_POLLS       (12U)
+
+#define XENSIV_PAS_GAS_MULTIGAS_TEST_RATE_US     ((uint64_t)XENSIV_PAS_GAS_MULTIGAS_TEST_RATE_S * 1000000U)
+
+static uint8_t xensiv_pas_gas_multigas_test_gas_sel(const xensiv_pas_gas_emul_t *emul) {
+    return (uint8_t)(xensiv_pas_gas_emul_peek(emul, (uint8_t)XENSIV_PAS_GAS_A2L_REG_GAS_CFG) & XENSIV_PAS_GAS_A2L_REG_GAS_CFG_GAS_SEL_MASK);
+}
+
+/* Waits for the next result and polls it, counting the bus transactions of the poll */
+static int32_t xensiv_pas_gas_multigas_test_poll(xensiv_pas_gas_multigas_t *sched, xensiv_pas_gas_multigas_sample_t *sample, uint32_t *transfers) {
+    xensiv_pas_gas_emul_advance_us(XENSIV_PAS_GAS_MULTIGAS_TEST_RATE_US);
+    xensiv_pas_gas_emul_reset_bus_stats();
+    int32_t res = xensiv_pas_gas_multigas_poll(sched, sample);
+    *transfers = xensiv_pas_gas_test_transfers();
+
+    return res;
+}
+
+static void xensiv_pas_gas_multigas_test_config(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_multigas_t sched;
+    xensiv_pas_gas_multigas_config_t config;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+
+    xensiv_pas_gas_multigas_get_default_config(&config);
+    config.gas_mask = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_multigas_start(&sched, &dev, &config));
+    xensiv_pas_gas_multigas_get_default_config(&config);
+    config.samples_per_gas = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_multigas_start(&sched, &dev, &config));
+
+    /* Only R454B and R32 are available on the emulated sensor */
+    xensiv_pas_gas_multigas_get_default_config(&config);
+    config.gas_mask |= XENSIV_PAS_GAS_MULTIGAS_GAS_BIT(2U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_multigas_start(&sched, &dev, &config));
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    /* GAS_CFG is beyond the UART register range */
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_UART, &emul));
+    xensiv_pas_gas_multigas_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_multigas_start(&sched, &dev, &config));
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_multigas_test_round_robin(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_multigas_t sched;
+    xensiv_pas_gas_multigas_config_t config;
+    xensiv_pas_gas_multigas_sample_t sample;
+    uint32_t transfers;
+    uint32_t seq[XENSIV_PAS_GAS_MULTIGAS_MAX_GASES] = { 0U };
+    uint16_t val = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_MULTIGAS_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+
+    xensiv_pas_gas_multigas_get_default_config(&config);
+    config.samples_per_gas = XENSIV_PAS_GAS_MULTIGAS_TEST_SAMPLES;
+    config.rate_s = XENSIV_PAS_GAS_MULTIGAS_TEST_RATE_S;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_start(&sched, &dev, &config));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, xensiv_pas_gas_multigas_get_gas(&sched));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_multigas_poll(&sched, &sample));
+
+    /* Polled on DRDY, right after each measurement and well before the next one starts */
+    xensiv_pas_gas_emul_advance_us(2000000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_poll(&sched, &sample));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, sample.gas);
+    seq[XENSIV_PAS_GAS_A2L_GAS_R454B]++;
+
+    /* Each gas is measured samples_per_gas times in turn; a switch costs a single write of the cached GAS_CFG */
+    for (uint32_t i = 1U; i < XENSIV_PAS_GAS_MULTIGAS_TEST_POLLS; ++i)
+    {
+        uint8_t gas = (uint8_t)((i / XENSIV_PAS_GAS_MULTIGAS_TEST_SAMPLES) % 2U);
+        bool last = ((i + 1U) % XENSIV_PAS_GAS_MULTIGAS_TEST_SAMPLES) == 0U;
+
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_test_poll(&sched, &sample, &transfers));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(gas, sample.gas);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_MULTIGAS_TEST_GAS, sample.val);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(seq[gas], sample.seq);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(last ? 3U : 2U, transfers);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(last ? (gas ^ 1U) : gas, xensiv_pas_gas_multigas_test_gas_sel(&emul));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_get_switch_status(&sched));
+        seq[gas]++;
+    }
+
+    /* The streams keep the newest samples of each gas */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_MULTIGAS_TEST_POLLS / 2U, seq[XENSIV_PAS_GAS_A2L_GAS_R454B]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_MULTIGAS_TEST_POLLS / 2U, seq[XENSIV_PAS_GAS_A2L_GAS_R32]);
+    for (uint32_t i = 0U; i < (XENSIV_PAS_GAS_MULTIGAS_TEST_POLLS / 2U); ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_read_stream(&sched, XENSIV_PAS_GAS_A2L_GAS_R32, &val));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_MULTIGAS_TEST_GAS, val);
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_multigas_read_stream(&sched, XENSIV_PAS_GAS_A2L_GAS_R32, &val));
+
+    /* R454B is selected and has one result; a failed switch after the second one still delivers it */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_test_poll(&sched, &sample, &transfers));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, sample.gas);
+    xensiv_pas_gas_emul_inject_write_errors(&emul, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_test_poll(&sched, &sample, &transfers));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, sample.gas);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_MULTIGAS_TEST_GAS, sample.val);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_multigas_get_switch_status(&sched));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, xensiv_pas_gas_multigas_get_gas(&sched));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, xensiv_pas_gas_multigas_test_gas_sel(&emul));
+
+    /* The next result is measured with the kept gas, then the switch is written again */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_test_poll(&sched, &sample, &transfers));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R454B, sample.gas);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, transfers);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_get_switch_status(&sched));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R32, xensiv_pas_gas_multigas_get_gas(&sched));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R32, xensiv_pas_gas_multigas_test_gas_sel(&emul));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_multigas_test_poll(&sched, &sample, &transfers));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R32, sample.gas);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(seq[XENSIV_PAS_GAS_A2L_GAS_R32], sample.seq);
+
+    /* A failed read is returned, without a switch */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_multigas_test_poll(&sched, &sample, &transfers));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_A2L_GAS_R32, xensiv_pas_gas_multigas_test_gas_sel(&emul));
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    xensiv_pas_gas_multigas_test_config();
+    xensiv_pas_gas_multigas_test_round_robin();
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,162 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_pressure_test.c
+ *
+ * Description: Tests of the pressure compensation feed, counting the PRESS_REF writes of each sensor.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_pressure.h"
+
+#define XENSIV_PAS_GAS_PRESSURE_TEST_DEVS        (3U)
+
+#define XENSIV_PAS_GAS_PRESSURE_TEST_DEADBAND    (2U)
+#define XENSIV_PAS_GAS_PRESSURE_TEST_MAX_AGE_US  (60000000ULL)
+
+/* PRESS_REF value which the feed never writes, marking a register not written since */
+#define XENSIV_PAS_GAS_PRESSURE_TEST_UNWRITTEN   (0xFFFFU)
+
+static xensiv_pas_gas_emul_t emul[XENSIV_PAS_GAS_PRESSURE_TEST_DEVS];
+static xensiv_pas_gas_t dev[XENSIV_PAS_GAS_PRESSURE_TEST_DEVS];
+static uint32_t writes[XENSIV_PAS_GAS_PRESSURE_TEST_DEVS];
+
+/* Passes a reading to the feed and counts the sensors whose PRESS_REF was written with the value given */
+static int32_t xensiv_pas_gas_pressure_test_update(xensiv_pas_gas_pressure_feed_t *feed, uint64_t time_us, uint16_t pressure_hpa,
+                                                   uint16_t expected_hpa) {
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_PRESSURE_TEST_DEVS; ++i)
+    {
+        xensiv_pas_gas_emul_set_bits(&emul[i], (uint8_t)XENSIV_PAS_GAS_REG_PRESS_REF_H, 0xFFU);
+        xensiv_pas_gas_emul_set_bits(&emul[i], (uint8_t)XENSIV_PAS_GAS_REG_PRESS_REF_L, 0xFFU);
+    }
+
+    int32_t res = xensiv_pas_gas_pressure_feed_update(feed, time_us, pressure_hpa);
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_PRESSURE_TEST_DEVS; ++i)
+    {
+        uint16_t press_ref = xensiv_pas_gas_test_peek16(&emul[i], (uint8_t)XENSIV_PAS_GAS_REG_PRESS_REF_H);
+        if (XENSIV_PAS_GAS_PRESSURE_TEST_UNWRITTEN != press_ref) {
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(expected_hpa, press_ref);
+            writes[i]++;
+        }
+    }
+
+    return res;
+}
+
+static void xensiv_pas_gas_pressure_test_check_writes(uint32_t dev0, uint32_t dev1, uint32_t dev2) {
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(dev0, writes[0]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(dev1, writes[1]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(dev2, writes[2]);
+}
+
+int main(void) {
+    static const xensiv_pas_gas_t *const devs[XENSIV_PAS_GAS_PRESSURE_TEST_DEVS] = { &dev[0], &dev[1], &dev[2] };
+    xensiv_pas_gas_pressure_feed_t feed;
+    xensiv_pas_gas_pressure_feed_config_t config;
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_PRESSURE_TEST_DEVS; ++i)
+    {
+        xensiv_pas_gas_emul_init(&emul[i], XENSIV_PAS_GAS_VARIANT_CO2);
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev[i], XENSIV_PAS_GAS_INTERFACE_I2C, &emul[i]));
+    }
+
+    xensiv_pas_gas_pressure_feed_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_pressure_feed_init(&feed, devs, 0U, &config));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_pressure_feed_init(&feed, devs, XENSIV_PAS_GAS_PRESSURE_FEED_MAX_DEVS + 1U, &config));
+    config.filter_shift = XENSIV_PAS_GAS_PRESSURE_FEED_MAX_SHIFT + 1U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_pressure_feed_init(&feed, devs, XENSIV_PAS_GAS_PRESSURE_TEST_DEVS, &config));
+
+    /* Unfiltered readings, so that each reading is the value compared against the deadband */
+    config.deadband_hpa = XENSIV_PAS_GAS_PRESSURE_TEST_DEADBAND;
+    config.max_age_us = XENSIV_PAS_GAS_PRESSURE_TEST_MAX_AGE_US;
+    config.filter_shift = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_feed_init(&feed, devs, XENSIV_PAS_GAS_PRESSURE_TEST_DEVS, &config));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_pressure_feed_get_pressure(&feed));
+
+    /* A reading out of range is discarded without bus traffic */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_pressure_feed_update(&feed, 0U, XENSIV_PAS_GAS_PRESSURE_FEED_MIN_HPA - 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER,
+                                 xensiv_pas_gas_pressure_feed_update(&feed, 0U, XENSIV_PAS_GAS_PRESSURE_FEED_MAX_HPA + 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_pressure_feed_get_pressure(&feed));
+
+    /* The first reading is written to all sensors, one burst each */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 0U, 1013U, 1013U));
+    xensiv_pas_gas_pressure_test_check_writes(1U, 1U, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_PRESSURE_TEST_DEVS, xensiv_pas_gas_test_transfers());
+
+    /* Below the deadband nothing is written, in either direction */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 1000000U, 1014U, 0U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 2000000U, 1012U, 0U));
+    xensiv_pas_gas_pressure_test_check_writes(1U, 1U, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_test_transfers());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1012U, xensiv_pas_gas_pressure_feed_get_pressure(&feed));
+
+    /* At the deadband all sensors are written once */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 3000000U, 1015U, 1015U));
+    xensiv_pas_gas_pressure_test_check_writes(2U, 2U, 2U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_PRESSURE_TEST_DEVS, xensiv_pas_gas_test_transfers());
+
+    /* A steady pressure is written again once max_age_us after the last write, not before */
+    uint64_t written_us = 3000000U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK,
+                                 xensiv_pas_gas_pressure_test_update(&feed, written_us + XENSIV_PAS_GAS_PRESSURE_TEST_MAX_AGE_US - 1U, 1016U, 0U));
+    xensiv_pas_gas_pressure_test_check_writes(2U, 2U, 2U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK,
+                                 xensiv_pas_gas_pressure_test_update(&feed, written_us + XENSIV_PAS_GAS_PRESSURE_TEST_MAX_AGE_US, 1016U, 1016U));
+    xensiv_pas_gas_pressure_test_check_writes(3U, 3U, 3U);
+    written_us += XENSIV_PAS_GAS_PRESSURE_TEST_MAX_AGE_US;
+
+    /* A sensor whose write failed is written again at the next reading, without writing the others */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul[1], UINT32_MAX);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_pressure_test_update(&feed, written_us + 1000000U, 1020U, 1020U));
+    xensiv_pas_gas_pressure_test_check_writes(4U, 3U, 4U);
+    xensiv_pas_gas_emul_inject_comm_errors(&emul[1], 0U);
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, written_us + 2000000U, 1020U, 1020U));
+    xensiv_pas_gas_pressure_test_check_writes(4U, 4U, 4U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, xensiv_pas_gas_test_transfers());
+
+    /* A filtered step is written once the average has moved by the deadband */
+    xensiv_pas_gas_pressure_feed_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_feed_init(&feed, devs, XENSIV_PAS_GAS_PRESSURE_TEST_DEVS, &config));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 0U, 1000U, 1000U));
+    xensiv_pas_gas_pressure_test_check_writes(5U, 5U, 5U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 1000000U, 1004U, 0U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1001U, xensiv_pas_gas_pressure_feed_get_pressure(&feed));
+    xensiv_pas_gas_pressure_test_check_writes(5U, 5U, 5U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_pressure_test_update(&feed, 2000000U, 1004U, 1002U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1002U, xensiv_pas_gas_pressure_feed_get_pressure(&feed));
+    xensiv_pas_gas_pressure_test_check_writes(6U, 6U, 6U);
+
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_PRESSURE_TEST_DEVS; ++i)
+    {
+        xensiv_pas_gas_emul_deinit(&emul[i]);
+    }
+
+    return xensiv_pas_gas_test_result();
+}
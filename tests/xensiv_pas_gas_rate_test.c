@@ -0,0 +1,216 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_rate_test.c
+ *
+ * Description: Tests of the rate switches of the adaptive measurement rate controller.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_rate.h"
+
+/* Number of samples after which the default controller has settled on a constant concentration */
+#define XENSIV_PAS_GAS_RATE_TEST_SETTLE_SAMPLES  (64U)
+
+#define XENSIV_PAS_GAS_RATE_TEST_ALARM_TH        (1000U)
+#define XENSIV_PAS_GAS_RATE_TEST_BASELINE        (400U)
+#define XENSIV_PAS_GAS_RATE_TEST_LEAK            (3000U)
+
+/* Application side of the controller: the DRDY edges, the reads and the updates */
+typedef struct
+{
+    xensiv_pas_gas_rate_ctrl_t ctrl;
+    xensiv_pas_gas_t *dev;
+    bool drdy;
+    uint64_t last_sample_us;
+    uint16_t last_val;
+} xensiv_pas_gas_rate_test_app_t;
+
+static void xensiv_pas_gas_rate_test_feed(xensiv_pas_gas_rate_ctrl_t *ctrl, uint16_t val, unsigned samples) {
+    for (unsigned i = 0U; i < samples; ++i)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_rate_ctrl_update(ctrl, val));
+    }
+}
+
+static void xensiv_pas_gas_rate_test_on_int(xensiv_pas_gas_emul_t *emul, bool level, uint64_t time_us, void *arg) {
+    xensiv_pas_gas_rate_test_app_t *app = (xensiv_pas_gas_rate_test_app_t *)arg;
+    (void)emul;
+    (void)time_us;
+
+    /* High active INT pin */
+    if (level) {
+        app->drdy = true;
+    }
+}
+
+/* Runs the controller on the virtual clock until the duration elapsed or a sample exceeds stop_val */
+static void xensiv_pas_gas_rate_test_run(xensiv_pas_gas_rate_test_app_t *app, uint64_t duration_us, uint16_t stop_val) {
+    uint64_t end_us = xensiv_pas_gas_emul_now_us() + duration_us;
+
+    while (xensiv_pas_gas_emul_now_us() < end_us)
+    {
+        uint64_t now_us = xensiv_pas_gas_emul_now_us();
+        uint64_t next_us = xensiv_pas_gas_emul_next_event_us();
+        xensiv_pas_gas_emul_advance_us(((next_us < end_us) ? ((next_us > now_us) ? next_us : now_us) : end_us) - now_us);
+
+        if (app->drdy) {
+            app->drdy = false;
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_result(app->dev, &app->last_val));
+            XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_rate_ctrl_update(&app->ctrl, app->last_val));
+            app->last_sample_us = xensiv_pas_gas_emul_now_us();
+            if (app->last_val > stop_val) {
+                break;
+            }
+        }
+    }
+}
+
+/* Checks the detection latency of a sudden leak, starting phase eighths into a slow measurement period, and the bus budget */
+static void xensiv_pas_gas_rate_test_latency(uint8_t phase) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_emul_timing_t timing;
+    xensiv_pas_gas_rate_ctrl_config_t config;
+    static xensiv_pas_gas_rate_test_app_t app;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_get_default_timing(&timing);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_RATE_TEST_BASELINE);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_alarm_threshold(&dev, XENSIV_PAS_GAS_RATE_TEST_ALARM_TH));
+    xensiv_pas_gas_interrupt_config_t int_cfg = { .u = 0U };
+    int_cfg.b.int_func = XENSIV_PAS_GAS_INTERRUPT_FUNCTION_DRDY;
+    int_cfg.b.int_typ = XENSIV_PAS_GAS_INTERRUPT_TYPE_HIGH_ACTIVE;
+    int_cfg.b.alarm_typ = XENSIV_PAS_GAS_ALARM_TYPE_LOW_TO_HIGH;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_interrupt_config(&dev, int_cfg));
+    xensiv_pas_gas_emul_set_int_callback(&emul, xensiv_pas_gas_rate_test_on_int, &app);
+
+    app.dev = &dev;
+    app.drdy = false;
+    xensiv_pas_gas_rate_ctrl_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_rate_ctrl_init(&app.ctrl, &dev, &config));
+    uint64_t slow_us = (uint64_t)config.rate_slow_s * 1000000U;
+
+    /* Settled on a stable concentration, each slow period costs one result read */
+    xensiv_pas_gas_rate_test_run(&app, 3600ULL * 1000000ULL, UINT16_MAX);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(config.rate_slow_s, xensiv_pas_gas_rate_ctrl_get_rate(&app.ctrl));
+    xensiv_pas_gas_emul_reset_bus_stats();
+    xensiv_pas_gas_rate_test_run(&app, 3600ULL * 1000000ULL, UINT16_MAX);
+    uint32_t quiet_transfers = xensiv_pas_gas_test_transfers();
+    XENSIV_PAS_GAS_TEST_CHECK(quiet_transfers <= (2U * ((3600U / config.rate_slow_s) + 1U)));
+
+    /* A leak is seen within one slow period and a measurement sequence, whenever it starts */
+    xensiv_pas_gas_rate_test_run(&app, (app.last_sample_us + ((slow_us * phase) / 8U)) - xensiv_pas_gas_emul_now_us(), UINT16_MAX);
+    uint64_t onset_us = xensiv_pas_gas_emul_now_us();
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_RATE_TEST_LEAK);
+    xensiv_pas_gas_rate_test_run(&app, 2U * slow_us, XENSIV_PAS_GAS_RATE_TEST_ALARM_TH);
+    XENSIV_PAS_GAS_TEST_CHECK(app.last_val > XENSIV_PAS_GAS_RATE_TEST_ALARM_TH);
+    XENSIV_PAS_GAS_TEST_CHECK((app.last_sample_us - onset_us) <= (slow_us + ((uint64_t)timing.meas_duration_ms * 1000U)));
+
+    /* A leak far beyond the alarm threshold backs off again instead of holding the fast rate */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    xensiv_pas_gas_rate_test_run(&app, 3600ULL * 1000000ULL, UINT16_MAX);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(config.rate_slow_s, xensiv_pas_gas_rate_ctrl_get_rate(&app.ctrl));
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_test_transfers() <= (2U * quiet_transfers));
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_rate_test_switches(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_rate_ctrl_t ctrl;
+    xensiv_pas_gas_rate_ctrl_config_t config;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_alarm_threshold(&dev, 1000U));
+    xensiv_pas_gas_interrupt_config_t int_cfg = { .u = 0U };
+    int_cfg.b.alarm_typ = XENSIV_PAS_GAS_ALARM_TYPE_LOW_TO_HIGH;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_interrupt_config(&dev, int_cfg));
+
+    xensiv_pas_gas_rate_ctrl_get_default_config(&config);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(60U, config.rate_slow_s);
+
+    /* The fast rate is raised to the limit of the sensor and programmed in continuous mode */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_rate_ctrl_init(&ctrl, &dev, &config));
+    uint16_t fast_s = xensiv_pas_gas_rate_ctrl_get_rate(&ctrl);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((config.rate_fast_s > dev.meas_rate_min) ? config.rate_fast_s : dev.meas_rate_min, fast_s);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s, xensiv_pas_gas_test_peek16(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OP_MODE_CONTINUOUS,
+                                 xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_CFG) & XENSIV_PAS_GAS_REG_MEAS_CFG_OP_MODE_MSK);
+
+    /* A stable concentration backs off after stable_samples changes, step by step up to the slow rate */
+    xensiv_pas_gas_rate_test_feed(&ctrl, 400U, config.stable_samples);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+    xensiv_pas_gas_rate_test_feed(&ctrl, 400U, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s * config.backoff_multiplier, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+    xensiv_pas_gas_rate_test_feed(&ctrl, 400U, XENSIV_PAS_GAS_RATE_TEST_SETTLE_SAMPLES);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(config.rate_slow_s, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(config.rate_slow_s, xensiv_pas_gas_test_peek16(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H));
+
+    /* A jump of delta_enter returns to the fast rate at once */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_rate_ctrl_update(&ctrl, 400U + config.delta_enter));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s, xensiv_pas_gas_test_peek16(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H));
+
+    /* Close to the alarm threshold the fast rate is kept even when stable */
+    xensiv_pas_gas_rate_test_feed(&ctrl, 1000U - (config.alarm_margin / 2U), XENSIV_PAS_GAS_RATE_TEST_SETTLE_SAMPLES);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+    xensiv_pas_gas_rate_test_feed(&ctrl, 1000U + (config.alarm_margin / 2U), XENSIV_PAS_GAS_RATE_TEST_SETTLE_SAMPLES);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(fast_s, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+
+    /* Far beyond the threshold a stable concentration backs off */
+    xensiv_pas_gas_rate_test_feed(&ctrl, 1000U + (2U * config.alarm_margin), XENSIV_PAS_GAS_RATE_TEST_SETTLE_SAMPLES);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(config.rate_slow_s, xensiv_pas_gas_rate_ctrl_get_rate(&ctrl));
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_rate_test_config(void) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_rate_ctrl_t ctrl;
+    xensiv_pas_gas_rate_ctrl_config_t config;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+
+    xensiv_pas_gas_rate_ctrl_get_default_config(&config);
+    config.delta_exit = config.delta_enter;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_rate_ctrl_init(&ctrl, &dev, &config));
+
+    xensiv_pas_gas_rate_ctrl_get_default_config(&config);
+    config.backoff_multiplier = 1U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_rate_ctrl_init(&ctrl, &dev, &config));
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    xensiv_pas_gas_rate_test_switches();
+    xensiv_pas_gas_rate_test_config();
+    for (uint8_t phase = 0U; phase < 8U; ++phase)
+    {
+        xensiv_pas_gas_rate_test_latency(phase);
+    }
+
+    return xensiv_pas_gas_test_result();
+}
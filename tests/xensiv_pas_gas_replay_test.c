@@ -0,0 +1,165 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_replay_test.c
+ *
+ * Description: Records the register transfers of a device and replays the recording: a transfer is
+ *              answered by the matching record closest to its time, a diverged transfer by the last
+ *              register values, and a recording made during a replay replays without divergence on a
+ *              second replay with its own clock.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include <string.h>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+#include "src/xensiv_pas_gas_regs.h"
+#include "src/xensiv_pas_gas_record.h"
+#include "src/xensiv_pas_gas_replay.h"
+
+#define XENSIV_PAS_GAS_REPLAY_TEST_BUF_SIZE      (1024U)
+#define XENSIV_PAS_GAS_REPLAY_TEST_DUR_US        (100U)
+#define XENSIV_PAS_GAS_REPLAY_TEST_PROD_ID       (0x42U)
+#define XENSIV_PAS_GAS_REPLAY_TEST_MEAS_CFG      (0x02U)
+#define XENSIV_PAS_GAS_REPLAY_TEST_FILLER        (XENSIV_PAS_GAS_REPLAY_LOOKAHEAD + 1U)
+
+/* Transfers of the device initialization, none of them recorded */
+#define XENSIV_PAS_GAS_REPLAY_TEST_INIT_TRANSFERS (4U)
+
+/* Recording kept in memory */
+typedef struct
+{
+    uint8_t data[XENSIV_PAS_GAS_REPLAY_TEST_BUF_SIZE];
+    size_t len;
+} xensiv_pas_gas_replay_test_buf_t;
+
+static int32_t xensiv_pas_gas_replay_test_write(void *ctx, const uint8_t *data, size_t len) {
+    xensiv_pas_gas_replay_test_buf_t *buf = (xensiv_pas_gas_replay_test_buf_t *)ctx;
+
+    if ((buf->len + len) > sizeof(buf->data)) {
+        return XENSIV_PAS_GAS_ERR_COMM;
+    }
+    (void)memcpy(&buf->data[buf->len], data, len);
+    buf->len += len;
+
+    return XENSIV_PAS_GAS_OK;
+}
+
+/* Records a successful register read at the given time after the start of the recording */
+static void xensiv_pas_gas_replay_test_read(const xensiv_pas_gas_t *dev, uint8_t reg_addr, uint8_t hi, uint8_t lo, uint8_t len, uint64_t start_us) {
+    const uint8_t data[2] = { hi, lo };
+    xensiv_pas_gas_record_access(dev, false, reg_addr, data, len, XENSIV_PAS_GAS_OK, start_us, start_us + XENSIV_PAS_GAS_REPLAY_TEST_DUR_US);
+}
+
+/*
+ * Three readings of the gas concentration, at 1, 2 and 6 ms, then MEAS_CFG and enough readings to put the
+ * only record of PROD_ID beyond the lookahead of a replay which matched the first three records.
+ */
+static void xensiv_pas_gas_replay_test_record(xensiv_pas_gas_replay_test_buf_t *buf) {
+    xensiv_pas_gas_record_t rec;
+    xensiv_pas_gas_t dev;
+
+    (void)memset(&dev, 0, sizeof(dev));
+    buf->len = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_record_start(&rec, xensiv_pas_gas_replay_test_write, buf));
+    xensiv_pas_gas_record_attach(&dev, &rec, 0U);
+
+    xensiv_pas_gas_replay_test_read(&dev, XENSIV_PAS_GAS_REG_GASCONC_H, 0x01U, 0x90U, 2U, 1000U);
+    xensiv_pas_gas_replay_test_read(&dev, XENSIV_PAS_GAS_REG_GASCONC_H, 0x01U, 0xF4U, 2U, 2000U);
+    xensiv_pas_gas_replay_test_read(&dev, XENSIV_PAS_GAS_REG_GASCONC_H, 0x02U, 0x58U, 2U, 6000U);
+    xensiv_pas_gas_replay_test_read(&dev, XENSIV_PAS_GAS_REG_MEAS_CFG, XENSIV_PAS_GAS_REPLAY_TEST_MEAS_CFG, 0U, 1U, 10000U);
+    for (uint8_t i = 0U; i < XENSIV_PAS_GAS_REPLAY_TEST_FILLER; ++i)
+    {
+        xensiv_pas_gas_replay_test_read(&dev, XENSIV_PAS_GAS_REG_GASCONC_H, 0x03U, i, 2U, 20000U + (5000U * (uint64_t)i));
+    }
+    xensiv_pas_gas_replay_test_read(&dev, XENSIV_PAS_GAS_REG_PROD_ID, XENSIV_PAS_GAS_REPLAY_TEST_PROD_ID, 0U, 1U, 100000U);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_record_get_result(&rec));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(14U, xensiv_pas_gas_record_get_count(&rec));
+}
+
+/* The accesses of the application, the same in both replays */
+static void xensiv_pas_gas_replay_test_access(const xensiv_pas_gas_t *dev) {
+    uint8_t data[2];
+    const uint8_t alarm[2] = { 0x12U, 0x34U };
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_reg(dev, XENSIV_PAS_GAS_REG_GASCONC_H, data, 2U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x01U, data[0]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x90U, data[1]);
+
+    /* After the communication delay of the driver, the reading at 6 ms is closer than the one at 2 ms */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_reg(dev, XENSIV_PAS_GAS_REG_GASCONC_H, data, 2U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x02U, data[0]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x58U, data[1]);
+
+    /* A write the recording does not know reads back from the register values of the replay */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_reg(dev, XENSIV_PAS_GAS_REG_ALARM_TH_H, alarm, 2U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_reg(dev, XENSIV_PAS_GAS_REG_ALARM_TH_H, data, 2U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x12U, data[0]);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x34U, data[1]);
+
+    /* A register first recorded beyond the lookahead reads its first recorded value */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_reg(dev, XENSIV_PAS_GAS_REG_PROD_ID, data, 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_REPLAY_TEST_PROD_ID, data[0]);
+
+    /* The diverged transfers left the recording at its position */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_reg(dev, XENSIV_PAS_GAS_REG_MEAS_CFG, data, 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_REPLAY_TEST_MEAS_CFG, data[0]);
+}
+
+int main(void) {
+    static xensiv_pas_gas_replay_test_buf_t first;
+    static xensiv_pas_gas_replay_test_buf_t second;
+    xensiv_pas_gas_replay_t replay;
+    xensiv_pas_gas_replay_t rereplay;
+    xensiv_pas_gas_replay_stats_t stats;
+    xensiv_pas_gas_record_t rec;
+    xensiv_pas_gas_t dev;
+
+    xensiv_pas_gas_replay_test_record(&first);
+
+    /* The initialization diverges but succeeds, the accesses are recorded again */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_replay_init(&replay, first.data, first.len, 0U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &replay));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_record_start(&rec, xensiv_pas_gas_replay_test_write, &second));
+    xensiv_pas_gas_record_attach(&dev, &rec, 0U);
+    xensiv_pas_gas_replay_test_access(&dev);
+
+    xensiv_pas_gas_replay_get_stats(&replay, &stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, stats.matched);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, stats.skipped);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_REPLAY_TEST_INIT_TRANSFERS + 3U, stats.diverged);
+    XENSIV_PAS_GAS_TEST_CHECK(!xensiv_pas_gas_replay_is_done(&replay));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(6U, xensiv_pas_gas_record_get_count(&rec));
+    uint64_t replay_us = xensiv_pas_gas_replay_get_time_us(&replay);
+
+    /* The second replay, over UART, starts its own clock and answers every access from its recording */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_replay_init(&rereplay, second.data, second.len, 0U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, xensiv_pas_gas_plat_get_time_us());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev, XENSIV_PAS_GAS_INTERFACE_UART, &rereplay));
+    xensiv_pas_gas_replay_test_access(&dev);
+
+    xensiv_pas_gas_replay_get_stats(&rereplay, &stats);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(6U, stats.matched);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, stats.skipped);
+    XENSIV_PAS_GAS_TEST_CHECK(xensiv_pas_gas_replay_is_done(&rereplay));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(replay_us, xensiv_pas_gas_replay_get_time_us(&replay));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_replay_get_time_us(&rereplay), xensiv_pas_gas_plat_get_time_us());
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,124 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_retry_test.c
+ *
+ * Description: Tests of the retry policy and the SENS_STS.ICCERR recovery, blocking and non-blocking,
+ *              over I2C and UART.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_co2.h"
+
+static void xensiv_pas_gas_retry_test_comm_errors(xensiv_pas_gas_interface_t itf) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_retry_policy_t policy;
+    xensiv_pas_gas_status_t status;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_CO2);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev, itf, &emul));
+
+    /* Without a policy the first error is returned */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_get_status(&dev, &status));
+
+    xensiv_pas_gas_get_default_retry_policy(&policy);
+    xensiv_pas_gas_set_retry_policy(&dev, &policy);
+
+    /* Errors below max_attempts are absorbed, on reads and on idempotent writes */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, policy.max_attempts - 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_status(&dev, &status));
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, policy.max_attempts - 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_scratch_pad(&dev, 0x5AU));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0x5AU, xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SCRATCH_PAD));
+
+    /* A successful write costs a single transaction */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_scratch_pad(&dev, 0xA5U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, xensiv_pas_gas_test_transfers());
+
+    /* The last error is returned once the attempts are exhausted */
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, policy.max_attempts);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_get_status(&dev, &status));
+
+    /* MEAS_STS clears DRDY on read, so its read is not repeated */
+    uint8_t meas_sts;
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, 1U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_COMM, xensiv_pas_gas_get_reg(&dev, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_STS, &meas_sts, 1U));
+
+    xensiv_pas_gas_emul_inject_comm_errors(&emul, 0U);
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_retry_test_iccerr(xensiv_pas_gas_interface_t itf) {
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+    xensiv_pas_gas_retry_policy_t policy;
+    xensiv_pas_gas_status_t status;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_CO2);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_co2_init(&dev, itf, &emul));
+    xensiv_pas_gas_get_default_retry_policy(&policy);
+    policy.clear_iccerr = true;
+    xensiv_pas_gas_set_retry_policy(&dev, &policy);
+
+    /* A read of SENS_STS reporting ICCERR clears it and reads again */
+    xensiv_pas_gas_emul_set_bits(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_status(&dev, &status));
+    XENSIV_PAS_GAS_TEST_CHECK((status.u & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) == 0U);
+    XENSIV_PAS_GAS_TEST_CHECK((xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS) & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) == 0U);
+
+    /* A write flagged with ICCERR is written again after clearing it, at the cost of a SENS_STS read after each write */
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_measurement_rate(&dev, 20U));
+    uint32_t transfers = xensiv_pas_gas_test_transfers();
+    xensiv_pas_gas_emul_set_bits(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK);
+    xensiv_pas_gas_emul_reset_bus_stats();
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_set_measurement_rate(&dev, 30U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ((2U * transfers) + 1U, xensiv_pas_gas_test_transfers());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(30U, xensiv_pas_gas_test_peek16(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H));
+    XENSIV_PAS_GAS_TEST_CHECK((xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS) & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) == 0U);
+
+    /* The same through the non-blocking operation */
+    xensiv_pas_gas_async_t op;
+    const uint8_t rate[2] = { 0U, 40U };
+    xensiv_pas_gas_emul_set_bits(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK);
+    xensiv_pas_gas_async_set_reg(&op, &dev, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H, rate, 2U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_test_run_async(&op));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(40U, xensiv_pas_gas_test_peek16(&emul, (uint8_t)XENSIV_PAS_GAS_REG_MEAS_RATE_H));
+    XENSIV_PAS_GAS_TEST_CHECK((xensiv_pas_gas_emul_peek(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS) & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) == 0U);
+
+    /* With the default policy the flag is left to the application */
+    xensiv_pas_gas_get_default_retry_policy(&policy);
+    xensiv_pas_gas_set_retry_policy(&dev, &policy);
+    xensiv_pas_gas_emul_set_bits(&emul, (uint8_t)XENSIV_PAS_GAS_REG_SENS_STS, XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_get_status(&dev, &status));
+    XENSIV_PAS_GAS_TEST_CHECK((status.u & XENSIV_PAS_GAS_REG_SENS_STS_ICCER_MSK) != 0U);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    xensiv_pas_gas_retry_test_comm_errors(XENSIV_PAS_GAS_INTERFACE_I2C);
+    xensiv_pas_gas_retry_test_comm_errors(XENSIV_PAS_GAS_INTERFACE_UART);
+    xensiv_pas_gas_retry_test_iccerr(XENSIV_PAS_GAS_INTERFACE_I2C);
+    xensiv_pas_gas_retry_test_iccerr(XENSIV_PAS_GAS_INTERFACE_UART);
+
+    return xensiv_pas_gas_test_result();
+}
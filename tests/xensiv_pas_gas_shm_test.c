@@ -0,0 +1,263 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_shm_test.c
+ *
+ * Description: Runs the shared-memory sample broadcast with a writer thread publishing while a reader
+ *              thread reads: no torn record is accepted, and records read plus records lost account for
+ *              all records published. Also covers the creation over an existing name and the overruns.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#define _DEFAULT_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_a2l.h"
+#include "src/xensiv_pas_gas_shm.h"
+
+#define XENSIV_PAS_GAS_SHM_TEST_CAPACITY         (16U)
+#define XENSIV_PAS_GAS_SHM_TEST_RECORDS          (200000U)
+#define XENSIV_PAS_GAS_SHM_TEST_GAS              (420U)
+
+/* Reader thread state, inspected once both threads joined */
+typedef struct
+{
+    const char *name;
+    bool peek;                              /* Reads in place with peek and release instead of copying */
+    uint64_t received;
+    uint64_t torn;                          /* Records accepted whose fields do not belong together */
+    uint64_t disorder;                      /* Records accepted out of order */
+    uint64_t lost;
+    int32_t open_res;
+} xensiv_pas_gas_shm_test_reader_t;
+
+static volatile bool xensiv_pas_gas_shm_test_reader_ready;
+
+/* All the fields of record n derive from n, so a record mixing two writes is detected */
+static void xensiv_pas_gas_shm_test_make(uint64_t n, xensiv_pas_gas_shm_sample_t *sample) {
+    sample->time_us = n;
+    sample->sensor = (uint16_t)(n >> 16U);
+    sample->val = (uint16_t)n;
+    sample->res = (int32_t)(n & 0x7U);
+}
+
+static bool xensiv_pas_gas_shm_test_intact(const xensiv_pas_gas_shm_sample_t *sample) {
+    xensiv_pas_gas_shm_sample_t expected;
+    xensiv_pas_gas_shm_test_make(sample->time_us, &expected);
+
+    return (expected.sensor == sample->sensor) && (expected.val == sample->val) && (expected.res == sample->res);
+}
+
+static void *xensiv_pas_gas_shm_test_read(void *arg) {
+    xensiv_pas_gas_shm_test_reader_t *state = (xensiv_pas_gas_shm_test_reader_t *)arg;
+    xensiv_pas_gas_shm_reader_t reader;
+    uint64_t next = 0U;
+
+    state->open_res = xensiv_pas_gas_shm_open(&reader, state->name);
+    xensiv_pas_gas_shm_test_reader_ready = true;
+    if (XENSIV_PAS_GAS_OK != state->open_res) {
+        return NULL;
+    }
+
+    while (next < XENSIV_PAS_GAS_SHM_TEST_RECORDS)
+    {
+        xensiv_pas_gas_shm_sample_t copy;
+        const xensiv_pas_gas_shm_sample_t *sample = &copy;
+        int32_t res;
+
+        if (state->peek) {
+            res = xensiv_pas_gas_shm_peek(&reader, &sample);
+            if (XENSIV_PAS_GAS_OK == res) {
+                copy = *sample;
+                sample = &copy;
+                res = xensiv_pas_gas_shm_release(&reader);
+            }
+        } else {
+            res = xensiv_pas_gas_shm_read(&reader, &copy);
+        }
+
+        if (XENSIV_PAS_GAS_OK == res) {
+            state->received++;
+            state->torn += xensiv_pas_gas_shm_test_intact(sample) ? 0U : 1U;
+            state->disorder += (sample->time_us >= next) ? 0U : 1U;
+            next = sample->time_us + 1U;
+        } else if (XENSIV_PAS_GAS_READ_NRDY == res) {
+            (void)sched_yield();
+        }
+    }
+
+    state->lost = xensiv_pas_gas_shm_get_lost(&reader);
+    xensiv_pas_gas_shm_close(&reader);
+
+    return NULL;
+}
+
+/* A writer thread publishes while a reader thread reads */
+static void xensiv_pas_gas_shm_test_concurrent(const char *name, bool peek) {
+    xensiv_pas_gas_shm_t shm;
+    xensiv_pas_gas_shm_test_reader_t state = { .name = name, .peek = peek };
+    pthread_t thread;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_create(&shm, name, XENSIV_PAS_GAS_SHM_TEST_CAPACITY, false));
+
+    xensiv_pas_gas_shm_test_reader_ready = false;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0, pthread_create(&thread, NULL, xensiv_pas_gas_shm_test_read, &state));
+    while (!xensiv_pas_gas_shm_test_reader_ready)
+    {
+        (void)sched_yield();
+    }
+
+    for (uint64_t n = 0U; n < XENSIV_PAS_GAS_SHM_TEST_RECORDS; ++n)
+    {
+        xensiv_pas_gas_shm_sample_t sample;
+        xensiv_pas_gas_shm_test_make(n, &sample);
+        xensiv_pas_gas_shm_publish(&shm, &sample);
+        if (0U == (n % 64U)) {
+            (void)sched_yield();
+        }
+    }
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0, pthread_join(thread, NULL));
+    xensiv_pas_gas_shm_destroy(&shm);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, state.open_res);
+    XENSIV_PAS_GAS_TEST_CHECK(state.received > 0U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, state.torn);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(0U, state.disorder);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_SHM_TEST_RECORDS, state.received + state.lost);
+}
+
+/* Overruns and a record overwritten between peek and release, on one thread */
+static void xensiv_pas_gas_shm_test_overrun(const char *name) {
+    xensiv_pas_gas_shm_t shm;
+    xensiv_pas_gas_shm_reader_t reader;
+    xensiv_pas_gas_shm_sample_t sample;
+    const xensiv_pas_gas_shm_sample_t *rec;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_create(&shm, name, XENSIV_PAS_GAS_SHM_TEST_CAPACITY, false));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_open(&reader, name));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_shm_read(&reader, &sample));
+
+    /* The oldest record left intact is the one after the slot being overwritten next */
+    for (uint64_t n = 0U; n < (XENSIV_PAS_GAS_SHM_TEST_CAPACITY + 3U); ++n)
+    {
+        xensiv_pas_gas_shm_test_make(n, &sample);
+        xensiv_pas_gas_shm_publish(&shm, &sample);
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OVERRUN, xensiv_pas_gas_shm_read(&reader, &sample));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(4U, xensiv_pas_gas_shm_get_lost(&reader));
+    for (uint64_t n = 4U; n < (XENSIV_PAS_GAS_SHM_TEST_CAPACITY + 3U); ++n)
+    {
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_read(&reader, &sample));
+        XENSIV_PAS_GAS_TEST_CHECK_EQ(n, sample.time_us);
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_shm_read(&reader, &sample));
+
+    /* The writer laps the record held in place */
+    xensiv_pas_gas_shm_test_make(100U, &sample);
+    xensiv_pas_gas_shm_publish(&shm, &sample);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_peek(&reader, &rec));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(100U, rec->time_us);
+    for (uint32_t n = 0U; n < XENSIV_PAS_GAS_SHM_TEST_CAPACITY; ++n)
+    {
+        xensiv_pas_gas_shm_publish(&shm, &sample);
+    }
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OVERRUN, xensiv_pas_gas_shm_release(&reader));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(5U, xensiv_pas_gas_shm_get_lost(&reader));
+
+    xensiv_pas_gas_shm_close(&reader);
+    xensiv_pas_gas_shm_destroy(&shm);
+}
+
+/* An existing ring is only replaced on request */
+static void xensiv_pas_gas_shm_test_create(const char *name) {
+    xensiv_pas_gas_shm_t shm;
+    xensiv_pas_gas_shm_t other;
+    xensiv_pas_gas_shm_reader_t reader;
+    xensiv_pas_gas_shm_sample_t sample;
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_shm_create(&shm, name, 12U, false));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_NOT_READY, xensiv_pas_gas_shm_open(&reader, name));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_create(&shm, name, XENSIV_PAS_GAS_SHM_TEST_CAPACITY, false));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_open(&reader, name));
+
+    /* A second writer of the same name fails, the first one keeps publishing to its readers */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, xensiv_pas_gas_shm_create(&other, name, XENSIV_PAS_GAS_SHM_TEST_CAPACITY, false));
+    xensiv_pas_gas_shm_test_make(7U, &sample);
+    xensiv_pas_gas_shm_publish(&shm, &sample);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_read(&reader, &sample));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(7U, sample.time_us);
+    xensiv_pas_gas_shm_close(&reader);
+
+    /* Replacing it, as after a writer crashed without destroying the ring */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_create(&other, name, XENSIV_PAS_GAS_SHM_TEST_CAPACITY, true));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_open(&reader, name));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_shm_read(&reader, &sample));
+    xensiv_pas_gas_shm_close(&reader);
+    xensiv_pas_gas_shm_destroy(&other);
+    xensiv_pas_gas_shm_destroy(&shm);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_ERR_NOT_READY, xensiv_pas_gas_shm_open(&reader, name));
+}
+
+/* A result read from a sensor is published, nothing is published while no new result is ready */
+static void xensiv_pas_gas_shm_test_acquire(const char *name) {
+    xensiv_pas_gas_shm_t shm;
+    xensiv_pas_gas_shm_reader_t reader;
+    xensiv_pas_gas_shm_sample_t sample;
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas_t dev;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_SHM_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_a2l_init(&dev, XENSIV_PAS_GAS_INTERFACE_I2C, &emul));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_create(&shm, name, XENSIV_PAS_GAS_SHM_TEST_CAPACITY, false));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_open(&reader, name));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_shm_acquire(&shm, &dev, 3U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, xensiv_pas_gas_shm_read(&reader, &sample));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_start_single_mode(&dev));
+    xensiv_pas_gas_emul_advance_us(10000000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_acquire(&shm, &dev, 3U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, xensiv_pas_gas_shm_read(&reader, &sample));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(3U, sample.sensor);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_SHM_TEST_GAS, sample.val);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sample.res);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_emul_now_us(), sample.time_us);
+
+    xensiv_pas_gas_shm_close(&reader);
+    xensiv_pas_gas_shm_destroy(&shm);
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main(void) {
+    char name[64];
+    (void)snprintf(name, sizeof(name), "/xensiv_pas_gas_shm_test_%ld", (long)getpid());
+
+    xensiv_pas_gas_shm_test_create(name);
+    xensiv_pas_gas_shm_test_overrun(name);
+    xensiv_pas_gas_shm_test_acquire(name);
+    xensiv_pas_gas_shm_test_concurrent(name, false);
+    xensiv_pas_gas_shm_test_concurrent(name, true);
+
+    return xensiv_pas_gas_test_result();
+}
@@ -0,0 +1,99 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_test.h
+ *
+ * Description: Minimal check macros and helpers shared by the emulator backed tests.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#ifndef XENSIV_PAS_GAS_TEST_H_
+#define XENSIV_PAS_GAS_TEST_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "src/xensiv_pas_gas.h"
+#include "src/xensiv_pas_gas_async.h"
+#include "src/xensiv_pas_gas_emul.h"
+
+/* Number of failed checks of the test program */
+static unsigned xensiv_pas_gas_test_failures = 0U;
+
+/* Records a failed check without stopping the test, so that all failures of a run are reported */
+#define XENSIV_PAS_GAS_TEST_CHECK(cond) \
+    xensiv_pas_gas_test_check((cond), #cond, __FILE__, __LINE__)
+
+/* Checks that two integer values are equal */
+#define XENSIV_PAS_GAS_TEST_CHECK_EQ(expected, actual) \
+    xensiv_pas_gas_test_check_eq((long long)(expected), (long long)(actual), #actual, __FILE__, __LINE__)
+
+static inline void xensiv_pas_gas_test_check(bool ok, const char *expr, const char *file, int line) {
+    if (!ok) {
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+        xensiv_pas_gas_test_failures++;
+    }
+}
+
+static inline void xensiv_pas_gas_test_check_eq(long long expected, long long actual, const char *expr, const char *file, int line) {
+    if (expected != actual) {
+        fprintf(stderr, "%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expr, actual, expected);
+        xensiv_pas_gas_test_failures++;
+    }
+}
+
+/* Exit status of the test program */
+static inline int xensiv_pas_gas_test_result(void) {
+    if (xensiv_pas_gas_test_failures != 0U) {
+        fprintf(stderr, "%u check(s) failed\n", xensiv_pas_gas_test_failures);
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Drives a non-blocking operation to its end on the virtual clock of the emulator */
+static inline int32_t xensiv_pas_gas_test_run_async(xensiv_pas_gas_async_t *op) {
+    int32_t res;
+
+    while (XENSIV_PAS_GAS_PENDING == (res = xensiv_pas_gas_async_step(op, xensiv_pas_gas_emul_now_us())))
+    {
+        uint64_t due_us = xensiv_pas_gas_async_get_due_us(op);
+        uint64_t now_us = xensiv_pas_gas_emul_now_us();
+        if (due_us > now_us) {
+            xensiv_pas_gas_emul_advance_us(due_us - now_us);
+        }
+    }
+
+    return res;
+}
+
+/* Number of bus transactions issued since the last reset of the bus statistics, I2C transfers or UART commands */
+static inline uint32_t xensiv_pas_gas_test_transfers(void) {
+    xensiv_pas_gas_emul_bus_stats_t stats;
+    xensiv_pas_gas_emul_get_bus_stats(&stats);
+
+    return stats.i2c_transfers + stats.uart_writes;
+}
+
+/* Reads a 16-bit register pair of the emulated sensor, high byte first */
+static inline uint16_t xensiv_pas_gas_test_peek16(const xensiv_pas_gas_emul_t *emul, uint8_t reg_addr) {
+    return (uint16_t)(((uint16_t)xensiv_pas_gas_emul_peek(emul, reg_addr) << 8U) | xensiv_pas_gas_emul_peek(emul, (uint8_t)(reg_addr + 1U)));
+}
+
+#endif /* XENSIV_PAS_GAS_TEST_H_ */
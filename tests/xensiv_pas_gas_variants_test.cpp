@@ -0,0 +1,131 @@
+/***********************************************************************************************//**
+ * \file xensiv_pas_gas_variants_test.cpp
+ *
+ * Description: Instantiates the C++ variant classes for each transport, and runs them against the emulator.
+ *
+ ***************************************************************************************************
+ * \copyright
+ * Copyright 2025-2026 Infineon Technologies AG
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **************************************************************************************************/
+
+#include "tests/xensiv_pas_gas_test.h"
+#include "src/xensiv_pas_gas_variants.hpp"
+
+#define XENSIV_PAS_GAS_VARIANTS_TEST_GAS         (420U)
+
+/* MEAS_CFG of an idle sensor with the automatic BOC */
+#define XENSIV_PAS_GAS_VARIANTS_TEST_CFG_IDLE    ((uint8_t)(XENSIV_PAS_GAS_BOC_CFG_AUTOMATIC << XENSIV_PAS_GAS_REG_MEAS_CFG_BOC_CFG_POS))
+
+namespace transport = xensiv_pas_gas::transport;
+
+/* All members of the classes whose registers the transport reaches */
+template class xensiv_pas_gas::pas_co2<transport::i2c>;
+template class xensiv_pas_gas::pas_r290<transport::i2c>;
+template class xensiv_pas_gas::pas_a2l<transport::i2c>;
+template class xensiv_pas_gas::pas_co2<transport::emulator>;
+template class xensiv_pas_gas::pas_r290<transport::emulator>;
+template class xensiv_pas_gas::pas_a2l<transport::emulator>;
+template class xensiv_pas_gas::pas_co2<transport::uart>;
+template class xensiv_pas_gas::detail::pas_sensor<transport::uart, xensiv_pas_gas::r290_regs>;
+template class xensiv_pas_gas::detail::pas_sensor<transport::uart, xensiv_pas_gas::a2l_regs>;
+
+template<typename Sensor>
+static void xensiv_pas_gas_variants_test_sensor() {
+    using regs = typename Sensor::regs;
+
+    xensiv_pas_gas_emul_t emul;
+    Sensor sensor(&emul);
+    uint16_t val = 0U;
+
+    xensiv_pas_gas_emul_init(&emul, regs::variant);
+    xensiv_pas_gas_emul_set_gas(&emul, XENSIV_PAS_GAS_VARIANTS_TEST_GAS);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.init());
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_READ_NRDY, sensor.get_result(val));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.template start_continuous_mode<10U>());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(10U, xensiv_pas_gas_test_peek16(&emul, regs::meas_rate_h));
+    xensiv_pas_gas_emul_advance_us(15000000U);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.get_result(val));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_VARIANTS_TEST_GAS, val);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, (sensor.template set_field<typename regs::int_typ, 1U>()));
+    uint8_t int_typ = 0U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.template get_field<typename regs::int_typ>(int_typ));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(1U, int_typ);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.perform_forced_compensation(500U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OP_MODE_IDLE, xensiv_pas_gas_emul_peek(&emul, regs::meas_cfg) & regs::op_mode::mask);
+    XENSIV_PAS_GAS_TEST_CHECK(emul.fcs_offset != 0);
+
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+static void xensiv_pas_gas_variants_test_a2l() {
+    using regs = xensiv_pas_gas::a2l_regs;
+
+    xensiv_pas_gas_emul_t emul;
+    xensiv_pas_gas::pas_a2l<transport::emulator> sensor(&emul);
+    uint8_t self_test = 0xFFU;
+
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.init());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.get_self_test(self_test));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(xensiv_pas_gas_emul_peek(&emul, regs::self_test), self_test);
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.set_alarm_hysteresis<100U>());
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(100U, xensiv_pas_gas_test_peek16(&emul, regs::alarm_hys_h));
+
+    /* A humidity reference above the range of the sensor is rejected without a write */
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.set_absolute_humidity_ref(regs::abs_hum_ref_max));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(regs::abs_hum_ref_max, xensiv_pas_gas_test_peek16(&emul, regs::abs_hum_ref_h));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.set_absolute_humidity_ref(12U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(12U, xensiv_pas_gas_test_peek16(&emul, regs::abs_hum_ref_h));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_INVALID_PARAMETER, sensor.set_absolute_humidity_ref(regs::abs_hum_ref_max + 1U));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(12U, xensiv_pas_gas_test_peek16(&emul, regs::abs_hum_ref_h));
+
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.save_config());
+    xensiv_pas_gas_emul_deinit(&emul);
+
+    /* A sensor which never completes the forced compensation is left idle with the automatic BOC */
+    xensiv_pas_gas_emul_timing_t timing;
+    xensiv_pas_gas_emul_init(&emul, XENSIV_PAS_GAS_VARIANT_A2L);
+    xensiv_pas_gas_emul_get_default_timing(&timing);
+    timing.fcs_cycles = 200U;
+    xensiv_pas_gas_emul_set_timing(&emul, &timing);
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_OK, sensor.init());
+
+    uint64_t start_us = xensiv_pas_gas_emul_now_us();
+    uint64_t timeout_us = (uint64_t)XENSIV_PAS_GAS_ASYNC_FCS_TIMEOUT_CYCLES * regs::fcs_meas_rate_s * 1000000U;
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_TIMEOUT, sensor.perform_forced_compensation(500U));
+    uint64_t elapsed_us = xensiv_pas_gas_emul_now_us() - start_us;
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us >= (timeout_us - ((uint64_t)regs::fcs_meas_rate_s * 1000000U)));
+    XENSIV_PAS_GAS_TEST_CHECK(elapsed_us <= (timeout_us + ((uint64_t)regs::fcs_meas_rate_s * 1000000U)));
+    XENSIV_PAS_GAS_TEST_CHECK_EQ(XENSIV_PAS_GAS_VARIANTS_TEST_CFG_IDLE, xensiv_pas_gas_emul_peek(&emul, regs::meas_cfg));
+    xensiv_pas_gas_emul_deinit(&emul);
+}
+
+int main() {
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_co2<transport::emulator>>();
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_r290<transport::emulator>>();
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_a2l<transport::emulator>>();
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_co2<transport::i2c>>();
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_co2<transport::uart>>();
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_r290<transport::uart>>();
+    xensiv_pas_gas_variants_test_sensor<xensiv_pas_gas::pas_a2l<transport::uart>>();
+    xensiv_pas_gas_variants_test_a2l();
+
+    return xensiv_pas_gas_test_result();
+}